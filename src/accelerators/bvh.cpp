@@ -40,6 +40,19 @@ namespace pbrt{
         int splitAxis, firstPrimOffset, nPrimitives;
     };
 
+    // The tree in depth-first order: a node's first child follows it, so
+    // interior nodes only store the offset of the second
+    struct LinearBVHNode {
+        Bounds3f bounds;
+        union {
+            int primitivesOffset;   // leaf
+            int secondChildOffset;  // interior
+        };
+        uint16_t nPrimitives;  // 0 -> interior node
+        uint8_t axis;          // interior node: xyz
+        uint8_t pad[1];        // ensure 32 byte total size
+    };
+
     BVHAccel::BVHAccel(std::vector<std::shared_ptr<Primitive>> p, int maxPrimsInNode,
                       SplitMethod splitMethod):
                       maxPrimsInNode(std::min(255, maxPrimsInNode)),
@@ -54,7 +67,7 @@ namespace pbrt{
             primitiveInfo[i] = {i, primitives[i]->WorldBound()};
 
         // Build BVH tree for primitives using _primitiveInfo_
-        MemoryArena arena(1024 * 1024);
+        MemoryArena arena(1024 * 1024, MemoryCategory::BVH);
         int totalNodes = 0;
         std::vector<std::shared_ptr<Primitive>> orderedPrims;
         orderedPrims.reserve(primitives.size());
@@ -64,7 +77,18 @@ namespace pbrt{
                               &totalNodes, orderedPrims);
         primitives.swap(orderedPrims);
         primitiveInfo.resize(0);
+        primitivesMemory.Set(primitives.capacity() * sizeof(primitives[0]));
 
+        // Compute representation of depth-first traversal of BVH tree
+        nodes = AllocAligned<LinearBVHNode>(totalNodes, MemoryCategory::BVH);
+        int offset = 0;
+        flattenBVHTree(root, &offset);
+    }
+
+    BVHAccel::~BVHAccel() { FreeAligned(nodes); }
+
+    Bounds3f BVHAccel::WorldBound() const {
+        return nodes ? nodes[0].bounds : Bounds3f();
     }
 
     BVHBuildNode *
@@ -122,6 +146,7 @@ namespace pbrt{
                         // to EqualCounts.
                         if (mid != start && mid != end) break;
                     }
+                    // Fall through
                     case SplitMethod::EqualCounts: {
                         // Partition primitives into equally-sized subsets
                         mid = (start + end) / 2;
@@ -145,4 +170,98 @@ namespace pbrt{
         } //end if/else nPrimitives == 1
         return node;
     }
-}
\ No newline at end of file
+
+    int BVHAccel::flattenBVHTree(BVHBuildNode *node, int *offset) {
+        LinearBVHNode *linearNode = &nodes[*offset];
+        linearNode->bounds = node->bounds;
+        int myOffset = (*offset)++;
+        if (node->nPrimitives > 0) {
+            linearNode->primitivesOffset = node->firstPrimOffset;
+            linearNode->nPrimitives = node->nPrimitives;
+        } else {
+            // Create interior flattened BVH node
+            linearNode->axis = node->splitAxis;
+            linearNode->nPrimitives = 0;
+            flattenBVHTree(node->children[0], offset);
+            linearNode->secondChildOffset =
+                    flattenBVHTree(node->children[1], offset);
+        }
+        return myOffset;
+    }
+
+    bool BVHAccel::Intersect(const Ray &ray, SurfaceInteraction *isect) const {
+        if (!nodes) return false;
+        bool hit = false;
+        Vector3f invDir(1 / ray.d.x, 1 / ray.d.y, 1 / ray.d.z);
+        int dirIsNeg[3] = {invDir.x < 0, invDir.y < 0, invDir.z < 0};
+        // Follow ray through BVH nodes to find primitive intersections
+        int toVisitOffset = 0, currentNodeIndex = 0;
+        int nodesToVisit[64];
+        while (true) {
+            const LinearBVHNode *node = &nodes[currentNodeIndex];
+            // Check ray against BVH node
+            if (node->bounds.IntersectP(ray, invDir, dirIsNeg)) {
+                if (node->nPrimitives > 0) {
+                    // Intersect ray with primitives in leaf BVH node
+                    for (int i = 0; i < node->nPrimitives; ++i)
+                        if (primitives[node->primitivesOffset + i]->Intersect(
+                                ray, isect))
+                            hit = true;
+                    if (toVisitOffset == 0) break;
+                    currentNodeIndex = nodesToVisit[--toVisitOffset];
+                } else {
+                    // Put far BVH node on _nodesToVisit_ stack, advance to near
+                    // node
+                    if (dirIsNeg[node->axis]) {
+                        nodesToVisit[toVisitOffset++] = currentNodeIndex + 1;
+                        currentNodeIndex = node->secondChildOffset;
+                    } else {
+                        nodesToVisit[toVisitOffset++] = node->secondChildOffset;
+                        currentNodeIndex = currentNodeIndex + 1;
+                    }
+                }
+            } else {
+                if (toVisitOffset == 0) break;
+                currentNodeIndex = nodesToVisit[--toVisitOffset];
+            }
+        }
+        return hit;
+    }
+
+    bool BVHAccel::IntersectP(const Ray &ray) const {
+        if (!nodes) return false;
+        Vector3f invDir(1.f / ray.d.x, 1.f / ray.d.y, 1.f / ray.d.z);
+        int dirIsNeg[3] = {invDir.x < 0, invDir.y < 0, invDir.z < 0};
+        int nodesToVisit[64];
+        int toVisitOffset = 0, currentNodeIndex = 0;
+        while (true) {
+            const LinearBVHNode *node = &nodes[currentNodeIndex];
+            if (node->bounds.IntersectP(ray, invDir, dirIsNeg)) {
+                // Process BVH node _node_ for traversal
+                if (node->nPrimitives > 0) {
+                    for (int i = 0; i < node->nPrimitives; ++i) {
+                        if (primitives[node->primitivesOffset + i]->IntersectP(
+                                ray)) {
+                            return true;
+                        }
+                    }
+                    if (toVisitOffset == 0) break;
+                    currentNodeIndex = nodesToVisit[--toVisitOffset];
+                } else {
+                    if (dirIsNeg[node->axis]) {
+                        /// second child first
+                        nodesToVisit[toVisitOffset++] = currentNodeIndex + 1;
+                        currentNodeIndex = node->secondChildOffset;
+                    } else {
+                        nodesToVisit[toVisitOffset++] = node->secondChildOffset;
+                        currentNodeIndex = currentNodeIndex + 1;
+                    }
+                }
+            } else {
+                if (toVisitOffset == 0) break;
+                currentNodeIndex = nodesToVisit[--toVisitOffset];
+            }
+        }
+        return false;
+    }
+}
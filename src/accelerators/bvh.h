@@ -7,12 +7,14 @@
 
 #include "main.h"
 #include "primitive.h"
+#include "memory.h"
 #include <atomic>
 
 namespace pbrt{
     struct BVHBuildNode;
 
     struct BVHPrimitiveInfo;
+    struct LinearBVHNode;
 
     class BVHAccel: public Aggregate{
     public:
@@ -20,6 +22,10 @@ namespace pbrt{
         BVHAccel(std::vector<std::shared_ptr<Primitive>> p,
                  int maxPrimsInNode = 1,
                  SplitMethod splitMethod = SplitMethod::Middle);
+        ~BVHAccel();
+        Bounds3f WorldBound() const;
+        bool Intersect(const Ray &ray, SurfaceInteraction *isect) const;
+        bool IntersectP(const Ray &ray) const;
         BVHBuildNode *recursiveBuild(
                 MemoryArena &arena, std::vector<BVHPrimitiveInfo> &primitiveInfo,
                 int start, int end, int *totalNodes,
@@ -27,6 +33,12 @@ namespace pbrt{
         const int maxPrimsInNode;
         const SplitMethod splitMethod;
         std::vector<std::shared_ptr<Primitive>> primitives;
+
+    private:
+        int flattenBVHTree(BVHBuildNode *node, int *offset);
+
+        TrackedMemory primitivesMemory{MemoryCategory::Primitives};
+        LinearBVHNode *nodes = nullptr;
     };
 }
 #endif //PBRT_WHITTED_BVH_H
@@ -3,6 +3,7 @@
 //
 
 #include "orthographic.h"
+#include "paramset.h"
 #include "sampler.h"
 
 namespace pbrt {
@@ -14,8 +15,11 @@ namespace pbrt {
         return 1;
     }
 
-    OrthographicCamera *CreateOrthographicCamera(const Transform &cam2world, Film *film) {
-        float frame = float(film->fullResolution.x)/float(film->fullResolution.y);
+    OrthographicCamera *CreateOrthographicCamera(const ParamSet &params,
+                                                 const Transform &cam2world, Film *film) {
+        float frame = params.FindOneFloat(
+                "frameaspectratio",
+                float(film->fullResolution.x)/float(film->fullResolution.y));
 
         Bounds2f screen;
         if (frame > 1.f) {
@@ -29,6 +33,17 @@ namespace pbrt {
             screen.pMin.y = -1.f / frame;
             screen.pMax.y = 1.f / frame;
         }
+        int swi;
+        const float *sw = params.FindFloat("screenwindow", &swi);
+        if (sw) {
+            if (swi == 4) {
+                screen.pMin.x = sw[0];
+                screen.pMax.x = sw[1];
+                screen.pMin.y = sw[2];
+                screen.pMax.y = sw[3];
+            } else
+                std::cerr << "\"screenwindow\" should have four values" << std::endl;
+        }
 
         return new OrthographicCamera(cam2world,screen,film);
     }
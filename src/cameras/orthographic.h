@@ -25,7 +25,8 @@ namespace pbrt{
         Vector3f dxCamera, dyCamera;
     };
 
-    OrthographicCamera *CreateOrthographicCamera(const Transform &cam2world, Film *film);
+    OrthographicCamera *CreateOrthographicCamera(const ParamSet &params,
+                                                 const Transform &cam2world, Film *film);
 }
 
 #endif //PBRT_WHITTED_ORTHOGRAPHIC_H
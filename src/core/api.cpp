@@ -3,26 +3,41 @@
 //
 
 #include "api.h"
+#include "paramset.h"
 #include "spectrum.h"
 #include "scene.h"
 #include "film.h"
+#include "lowdiscrepancy.h"
+#include "parallel.h"
+
+#include "accelerators/bvh.h"
 
 #include "cameras/orthographic.h"
 #include "filters/box.h"
+#include "filters/gaussian.h"
+#include "filters/mitchell.h"
+#include "filters/sinc.h"
 #include "integrators/whitted.h"
 #include "lights/point.h"
 #include "materials/matte.h"
 #include "samplers/random.h"
+#include "samplers/sobol.h"
+#include "samplers/halton.h"
+#include "samplers/zerotwosequence.h"
+#include "samplers/bluenoisesampler.h"
 #include "shapes/sphere.h"
 #include "textures/constant.h"
 
+#include <algorithm>
 #include <map>
 
 
 namespace pbrt {
-    Options PbrtOptions;
+    thread_local Options PbrtOptions;
 
     constexpr int MaxTransforms = 2;
+    constexpr int StartTransformBits = 1 << 0;
+    constexpr int EndTransformBits = 1 << 1;
     constexpr int AllTransformsBits = (1 << MaxTransforms) - 1;
 
     struct TransformSet{
@@ -43,17 +58,42 @@ namespace pbrt {
         Transform t[MaxTransforms];
     };
 
+    struct CameraDescription {
+        // Empty for the camera of a _Camera_ statement without a _name_
+        std::string name;
+        std::string type = "orthographic";
+        ParamSet params;
+        TransformSet CameraToWorld;
+    };
+
     struct RenderOptions {
-        Integrator *MakeIntegrator() const;
+        // With a _viewName_, the image and backing file names get it as a
+        // suffix
+        SamplerIntegrator *MakeIntegrator(const CameraDescription &camera,
+                                          const std::string &viewName) const;
+        // One per named camera if there are any, and otherwise one for
+        // _camera_
+        std::vector<std::unique_ptr<SamplerIntegrator>> MakeIntegrators() const;
         Scene *MakeScene();
-        Camera *MakeCamera() const;
+        Camera *MakeCamera(const CameraDescription &camera,
+                           const std::string &viewName) const;
+        // Identifies the scene, the camera and the settings an image is
+        // rendered with, for _Checkpoint_ to check
+        uint64_t RenderHash(const CameraDescription &camera,
+                            const std::string &viewName) const;
 
         std::string FilterName = "box";
+        ParamSet FilterParams;
         std::string FilmName = "image";
+        ParamSet FilmParams;
         std::string SamplerName = "random";
+        ParamSet SamplerParams;
         std::string IntegratorName = "whitted";
-        std::string CameraName = "orthographic";
-        TransformSet CameraToWorld;
+        ParamSet IntegratorParams;
+        // The last _Camera_ without a _name_ parameter, and those with one
+        // in the order they were first declared
+        CameraDescription camera;
+        std::vector<CameraDescription> namedCameras;
         std::vector<std::shared_ptr<Primitive>> primitives;
         std::vector<std::shared_ptr<Light>> lights;
 
@@ -73,6 +113,9 @@ namespace pbrt {
                 : floatTextures(std::make_shared<FloatTextureMap>()),
                   spectrumTextures(std::make_shared<SpectrumTextureMap>()),
                   namedMaterials(std::make_shared<NamedMaterialMap>()) {
+            ParamSet empty;
+            currentMaterial = std::make_shared<MaterialInstance>(
+                    "matte", std::shared_ptr<Material>(CreateMatteMaterial(empty)));
         }
 
         std::shared_ptr<Material> GetMaterialForShape();
@@ -97,261 +140,777 @@ namespace pbrt {
         return currentMaterial->material;
     }
 
-            class TransformCache{
+    // Shares one copy of each distinct transform between the shapes that use
+    // it. The table is split into _nStripes_ open-addressing tables, picked by
+    // the top bits of the hash and each with its own lock, so that shapes can
+    // be created from several threads; returned pointers stay valid as long
+    // as the cache.
+    class TransformCache {
     public:
-        TransformCache()
-                : hashTable(512), hashTableOccupancy(0) {}
-
-        Transform *Lookup(const Transform &t) {
-
-            int offset = Hash(t) & (hashTable.size() - 1);
-            int step = 1;
-            while (true) {
-                // Keep looking until we find the Transform or determine that
-                // it's not present.
-                if (!hashTable[offset] || *hashTable[offset] == t)
-                    break;
-                // Advance using quadratic probing.
-                offset = (offset + step * step) & (hashTable.size() - 1);
-                ++step;
-            }
-            Transform *tCached = hashTable[offset];
-            if (tCached){}
-            else {
-                tCached = arena.Alloc<Transform>();
-                *tCached = t;
-                Insert(tCached);
-            }
-            return tCached;
+        TransformCache() {
+            for (Stripe &stripe : stripes)
+                stripe.tableMemory.Set(stripe.hashTable.size() * sizeof(Transform *));
         }
+        Transform *Lookup(const Transform &t);
+        void PrintStats() const;
 
     private:
-        void Insert(Transform *tNew);
-        void Grow();
+        static constexpr int nStripes = 64;
+        struct Stripe {
+            std::mutex mutex;
+            std::vector<Transform *> hashTable = std::vector<Transform *>(16);
+            int occupancy = 0;
+            int64_t lookups = 0, hits = 0;
+            MemoryArena arena{16384, MemoryCategory::Transforms};
+            TrackedMemory tableMemory{MemoryCategory::Transforms};
+        };
 
+        // Mixes the matrix eight bytes at a time
         static uint64_t Hash(const Transform &t) {
-            const char *ptr = (const char *)(&t.GetMatrix());
-            size_t size = sizeof(Matrix4x4);
-            uint64_t hash = 14695981039346656037ull;
-            while (size > 0) {
-                hash ^= *ptr;
-                hash *= 1099511628211ull;
-                ++ptr;
-                --size;
-            }
-            return hash;
+            uint64_t words[sizeof(Matrix4x4) / sizeof(uint64_t)];
+            memcpy(words, &t.GetMatrix(), sizeof(words));
+            uint64_t hash = 0;
+            for (uint64_t w : words) hash = (hash ^ w) * 0x9e3779b97f4a7c15ull;
+            return MixBits(hash);
         }
+        static void Insert(std::vector<Transform *> &hashTable, Transform *tNew,
+                           uint64_t hash);
 
-        std::vector<Transform *> hashTable;
-        int hashTableOccupancy;
-        MemoryArena arena;
+        Stripe stripes[nStripes];
     };
 
-    void TransformCache::Insert(Transform *tNew) {
-        if (++hashTableOccupancy == hashTable.size() / 2)
-            Grow();
-
-        int offset = Hash(*tNew) & (hashTable.size() - 1);
-        int step = 1;
-        while (true) {
-            if (hashTable[offset] == nullptr) {
-                hashTable[offset] = tNew;
-                return;
+    Transform *TransformCache::Lookup(const Transform &t) {
+        uint64_t hash = Hash(t);
+        Stripe &stripe = stripes[hash >> 58];
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        ++stripe.lookups;
+        size_t mask = stripe.hashTable.size() - 1;
+        size_t offset = hash & mask;
+        // Triangular probing visits every slot of a power-of-two table
+        for (size_t step = 1; stripe.hashTable[offset]; ++step) {
+            if (*stripe.hashTable[offset] == t) {
+                ++stripe.hits;
+                return stripe.hashTable[offset];
             }
-            // Advance using quadratic probing.
-            offset = (offset + step * step) & (hashTable.size() - 1);
-            ++step;
+            offset = (offset + step) & mask;
         }
-    }
 
-    void TransformCache::Grow() {
-        std::vector<Transform *> newTable(2 * hashTable.size());
+        Transform *tCached = stripe.arena.Alloc<Transform>();
+        *tCached = t;
+        stripe.hashTable[offset] = tCached;
+        if (++stripe.occupancy * 2 >= (int)stripe.hashTable.size()) {
+            std::vector<Transform *> newTable(2 * stripe.hashTable.size());
+            for (Transform *tEntry : stripe.hashTable)
+                if (tEntry) Insert(newTable, tEntry, Hash(*tEntry));
+            std::swap(stripe.hashTable, newTable);
+            stripe.tableMemory.Set(stripe.hashTable.size() * sizeof(Transform *));
+        }
+        return tCached;
+    }
 
-        // Insert current elements into newTable.
-        for (Transform *tEntry : hashTable) {
-            if (!tEntry) continue;
+    void TransformCache::Insert(std::vector<Transform *> &hashTable,
+                                Transform *tNew, uint64_t hash) {
+        size_t mask = hashTable.size() - 1;
+        size_t offset = hash & mask;
+        for (size_t step = 1; hashTable[offset]; ++step)
+            offset = (offset + step) & mask;
+        hashTable[offset] = tNew;
+    }
 
-            int offset = Hash(*tEntry) & (newTable.size() - 1);
-            int step = 1;
-            while (true) {
-                if (newTable[offset] == nullptr) {
-                    newTable[offset] = tEntry;
-                    break;
-                }
-                // Advance using quadratic probing.
-                offset = (offset + step * step) & (hashTable.size() - 1);
-                ++step;
-            }
+    void TransformCache::PrintStats() const {
+        int64_t lookups = 0, hits = 0, transforms = 0;
+        size_t bytes = 0;
+        for (const Stripe &stripe : stripes) {
+            lookups += stripe.lookups;
+            hits += stripe.hits;
+            transforms += stripe.occupancy;
+            bytes += stripe.arena.TotalAllocated() +
+                     stripe.hashTable.size() * sizeof(Transform *);
         }
-
-        std::swap(hashTable, newTable);
+        if (lookups == 0) return;
+        std::cout << "Transform cache: " << transforms << " transforms, "
+                  << 100. * hits / lookups << "% of " << lookups
+                  << " lookups hit, " << bytes / 1024 << " kB" << std::endl;
     }
 
+    // The state behind the pbrt*() calls; see api.h
+    class RenderContext {
+    public:
+        explicit RenderContext(const Options &options)
+                : options(options), renderOptions(new RenderOptions) {}
+
+        const Options options;
+        GraphicsState graphicsState;
+        std::unique_ptr<RenderOptions> renderOptions;
+        TransformSet curTransform;
+        uint32_t activeTransformBits = AllTransformsBits;
+        std::map<std::string, TransformSet> namedCoordinateSystems;
+        std::vector<GraphicsState> pushedGraphicsStates;
+        std::vector<TransformSet> pushedTransforms;
+        std::vector<uint32_t> pushedActiveTransformBits;
+        TransformCache transformCache;
+        std::shared_ptr<const ResidentScene> residentScene;
+        // Of every scene file and string parsed in this context so far
+        uint64_t sceneHash = 0;
+    };
+
+    class ResidentScene {
+    public:
+        Options options;
+        // The descriptions of everything but the shapes and lights, which
+        // are in _scene_
+        RenderOptions renderOptions;
+        std::unique_ptr<Scene> scene;
+        uint64_t sceneHash;
+    };
+
     // API Static Data
-    static GraphicsState graphicsState;
-    static std::unique_ptr<RenderOptions> renderOptions;
-    static TransformSet curTransform;
-    static uint32_t activeTransformBits = AllTransformsBits;
-    static std::map<std::string, TransformSet> namedCoordinateSystems;
-    static std::vector<GraphicsState> pushedGraphicsStates;
-    static std::vector<TransformSet> pushedTransforms;
-    static std::vector<uint32_t> pushedActiveTransformBits;
-    static TransformCache transformCache;
+    static thread_local RenderContext *context = nullptr;
 
-#define FOR_ACTIVE_TRANSFORMS(expr)           \
-    for (int i = 0; i < MaxTransforms; ++i)   \
-        if (activeTransformBits & (1 << i)) { \
-            expr                              \
+#define FOR_ACTIVE_TRANSFORMS(expr)                        \
+    for (int i = 0; i < MaxTransforms; ++i)                \
+        if (context->activeTransformBits & (1 << i)) {     \
+            expr                                           \
         }
 
 
     std::vector<std::shared_ptr<Shape>> MakeShapes(const std::string &name,
                                                    const Transform *object2world,
-                                                   const Transform *world2object){
+                                                   const Transform *world2object,
+                                                   const ParamSet &paramSet){
         std::vector<std::shared_ptr<Shape>> shapes;
         std::shared_ptr<Shape> s;
         if (name == "sphere")
-            s = CreateSphereShape(object2world, world2object);
+            s = CreateSphereShape(object2world, world2object, paramSet);
+        else
+            std::cerr << "Shape \"" << name << "\" unknown." << std::endl;
+        if (s) shapes.push_back(s);
         return shapes;
     }
 
+    std::shared_ptr<Material> MakeMaterial(const std::string &name,
+                                           const ParamSet &params) {
+        Material *material = nullptr;
+        if (name == "" || name == "none")
+            return nullptr;
+        else if (name == "matte")
+            material = CreateMatteMaterial(params);
+        else {
+            std::cerr << "Material \"" << name << "\" unknown; using matte"
+                      << std::endl;
+            material = CreateMatteMaterial(params);
+        }
+        params.ReportUnused();
+        return std::shared_ptr<Material>(material);
+    }
+
+    void pbrtIdentity() {
+        FOR_ACTIVE_TRANSFORMS(context->curTransform[i] = Transform();)
+    }
+
+    void pbrtRotate(float angle, float dx, float dy, float dz) {
+        FOR_ACTIVE_TRANSFORMS(context->curTransform[i] =
+                                      context->curTransform[i] *
+                                      Rotate(angle, Vector3f(dx, dy, dz));)
+    }
+
+    void pbrtScale(float sx, float sy, float sz) {
+        FOR_ACTIVE_TRANSFORMS(context->curTransform[i] =
+                                      context->curTransform[i] * Scale(sx, sy, sz);)
+    }
+
     void pbrtLookAt(float ex, float ey, float ez, float lx, float ly, float lz,
                     float ux, float uy, float uz) {
         Transform lookAt = LookAt(Point3f(ex,ey,ez),Point3f(lx,ly,lz),Vector3f(ux,uy,uz));
-        FOR_ACTIVE_TRANSFORMS(curTransform[i] = curTransform[i] * lookAt;);
+        FOR_ACTIVE_TRANSFORMS(context->curTransform[i] =
+                                      context->curTransform[i] * lookAt;);
+    }
+
+    // Scene files give matrices column by column
+    static Transform MatrixTransform(const float tr[16]) {
+        return Transform(Transpose(
+                Matrix4x4(tr[0], tr[1], tr[2], tr[3], tr[4], tr[5], tr[6], tr[7],
+                          tr[8], tr[9], tr[10], tr[11], tr[12], tr[13], tr[14],
+                          tr[15])));
+    }
+
+    void pbrtTransform(const float tr[16]) {
+        Transform t = MatrixTransform(tr);
+        FOR_ACTIVE_TRANSFORMS(context->curTransform[i] = t;)
+    }
+
+    void pbrtConcatTransform(const float tr[16]) {
+        Transform t = MatrixTransform(tr);
+        FOR_ACTIVE_TRANSFORMS(context->curTransform[i] =
+                                      context->curTransform[i] * t;)
+    }
+
+    void pbrtCoordinateSystem(const std::string &name) {
+        context->namedCoordinateSystems[name] = context->curTransform;
+    }
+
+    void pbrtCoordSysTransform(const std::string &name) {
+        auto iter = context->namedCoordinateSystems.find(name);
+        if (iter != context->namedCoordinateSystems.end())
+            context->curTransform = iter->second;
+        else
+            std::cerr << "Couldn't find named coordinate system \"" << name
+                      << "\"" << std::endl;
+    }
+
+    void pbrtActiveTransformAll() {
+        context->activeTransformBits = AllTransformsBits;
+    }
+
+    void pbrtActiveTransformEndTime() {
+        context->activeTransformBits = EndTransformBits;
+    }
+
+    void pbrtActiveTransformStartTime() {
+        context->activeTransformBits = StartTransformBits;
     }
 
     std::shared_ptr<Light> MakeLight(const std::string &name,
+                                     const ParamSet &paramSet,
                                      const Transform &light2world) {
         std::shared_ptr<Light> light;
         if (name == "point")
-            light = CreatePointLight(light2world);
+            light = CreatePointLight(light2world, paramSet);
+        else
+            std::cerr << "Light \"" << name << "\" unknown." << std::endl;
+        paramSet.ReportUnused();
         return light;
 
     }
 
     void pbrtInit(const Options &opt) {
-        PbrtOptions = opt;
-        renderOptions.reset(new RenderOptions);
-        graphicsState = GraphicsState();
+        pbrtSetContext(pbrtCreateContext(opt));
+        InitLowDiscrepancyTables();
+#ifdef PBRT_SAMPLED_SPECTRUM
+        SampledSpectrum::Init();
+#endif
+        InstallMemoryReportHandler();
+        ParallelInit();
+    }
+
+    RenderContext *pbrtCreateContext(const Options &opt) {
+        return new RenderContext(opt);
+    }
+
+    void pbrtDestroyContext(RenderContext *ctx) {
+        if (ctx == context) pbrtSetContext(nullptr);
+        delete ctx;
+    }
+
+    void pbrtSetContext(RenderContext *ctx) {
+        context = ctx;
+        PbrtOptions = ctx ? ctx->options : Options();
+    }
+
+    RenderContext *pbrtGetContext() { return context; }
+
+    void pbrtCamera(const std::string &name, const ParamSet &params) {
+        CameraDescription camera;
+        camera.name = params.FindOneString("name", "");
+        camera.type = name;
+        camera.params = params;
+        camera.CameraToWorld = Inverse(context->curTransform);
+        context->namedCoordinateSystems["camera"] = camera.CameraToWorld;
+
+        RenderOptions &renderOptions = *context->renderOptions;
+        if (camera.name.empty()) {
+            renderOptions.camera = camera;
+            return;
+        }
+        for (CameraDescription &named : renderOptions.namedCameras)
+            if (named.name == camera.name) {
+                std::cerr << "Camera \"" << camera.name << "\" redefined."
+                          << std::endl;
+                named = camera;
+                return;
+            }
+        renderOptions.namedCameras.push_back(camera);
     }
 
-    void pbrtCamera(const std::string &name) {
-        renderOptions->CameraName = name;
-        renderOptions->CameraToWorld = Inverse(curTransform);
-        namedCoordinateSystems["camera"] = renderOptions->CameraToWorld;
+    void pbrtIntegrator(const std::string &name, const ParamSet &params) {
+        context->renderOptions->IntegratorName = name;
+        context->renderOptions->IntegratorParams = params;
     }
 
-    void pbrtIntegrator(const std::string &name) {
-        renderOptions->IntegratorName = name;
+    void pbrtFilm(const std::string &type, const ParamSet &params) {
+        context->renderOptions->FilmName = type;
+        context->renderOptions->FilmParams = params;
+    }
 
+    void pbrtPixelFilter(const std::string &name, const ParamSet &params) {
+        context->renderOptions->FilterName = name;
+        context->renderOptions->FilterParams = params;
     }
 
-    void pbrtFilm(const std::string &type) {
-        renderOptions->FilmName = type;
+    void pbrtSampler(const std::string &name, const ParamSet &params) {
+        context->renderOptions->SamplerName = name;
+        context->renderOptions->SamplerParams = params;
     }
 
     void pbrtWorldBegin() {
-        for (int i = 0; i < MaxTransforms; ++i) curTransform[i] = Transform();
-        activeTransformBits = AllTransformsBits;
-        namedCoordinateSystems["world"] = curTransform;
+        for (int i = 0; i < MaxTransforms; ++i)
+            context->curTransform[i] = Transform();
+        context->activeTransformBits = AllTransformsBits;
+        context->namedCoordinateSystems["world"] = context->curTransform;
+    }
+
+    void pbrtAttributeBegin() {
+        context->pushedGraphicsStates.push_back(context->graphicsState);
+        GraphicsState &graphicsState = context->graphicsState;
+        graphicsState.floatTexturesShared = graphicsState.spectrumTexturesShared =
+                graphicsState.namedMaterialsShared = true;
+        context->pushedTransforms.push_back(context->curTransform);
+        context->pushedActiveTransformBits.push_back(context->activeTransformBits);
+    }
+
+    void pbrtAttributeEnd() {
+        if (context->pushedGraphicsStates.empty()) {
+            std::cerr << "Unmatched pbrtAttributeEnd() encountered. Ignoring it."
+                      << std::endl;
+            return;
+        }
+        context->graphicsState = std::move(context->pushedGraphicsStates.back());
+        context->pushedGraphicsStates.pop_back();
+        context->curTransform = context->pushedTransforms.back();
+        context->pushedTransforms.pop_back();
+        context->activeTransformBits = context->pushedActiveTransformBits.back();
+        context->pushedActiveTransformBits.pop_back();
+    }
+
+    void pbrtTransformBegin() {
+        context->pushedTransforms.push_back(context->curTransform);
+        context->pushedActiveTransformBits.push_back(context->activeTransformBits);
+    }
+
+    void pbrtTransformEnd() {
+        if (context->pushedTransforms.empty()) {
+            std::cerr << "Unmatched pbrtTransformEnd() encountered. Ignoring it."
+                      << std::endl;
+            return;
+        }
+        context->curTransform = context->pushedTransforms.back();
+        context->pushedTransforms.pop_back();
+        context->activeTransformBits = context->pushedActiveTransformBits.back();
+        context->pushedActiveTransformBits.pop_back();
+    }
+
+    void pbrtMaterial(const std::string &name, const ParamSet &params) {
+        std::shared_ptr<Material> mtl = MakeMaterial(name, params);
+        context->graphicsState.currentMaterial =
+                std::make_shared<MaterialInstance>(name, mtl);
+    }
+
+    void pbrtMakeNamedMaterial(const std::string &name, const ParamSet &params) {
+        std::string matName = params.FindOneString("type", "");
+        if (matName == "") {
+            std::cerr << "No parameter string \"type\" found in "
+                         "MakeNamedMaterial" << std::endl;
+            return;
+        }
+        // The map may be shared with an enclosing attribute block
+        if (context->graphicsState.namedMaterialsShared) {
+            context->graphicsState.namedMaterials =
+                    std::make_shared<GraphicsState::NamedMaterialMap>(
+                            *context->graphicsState.namedMaterials);
+            context->graphicsState.namedMaterialsShared = false;
+        }
+        if (context->graphicsState.namedMaterials->find(name) !=
+            context->graphicsState.namedMaterials->end())
+            std::cerr << "Named material \"" << name << "\" redefined."
+                      << std::endl;
+        std::shared_ptr<Material> mtl = MakeMaterial(matName, params);
+        (*context->graphicsState.namedMaterials)[name] =
+                std::make_shared<MaterialInstance>(matName, mtl);
+    }
+
+    void pbrtNamedMaterial(const std::string &name) {
+        auto iter = context->graphicsState.namedMaterials->find(name);
+        if (iter == context->graphicsState.namedMaterials->end()) {
+            std::cerr << "NamedMaterial \"" << name << "\" unknown."
+                      << std::endl;
+            return;
+        }
+        context->graphicsState.currentMaterial = iter->second;
     }
 
     void pbrtWorldEnd() {
-        std::unique_ptr<Integrator> integrator(renderOptions->MakeIntegrator());
-        std::unique_ptr<Scene> scene(renderOptions->MakeScene());
-        if (scene && integrator) integrator->Render(*scene);
+        // Ensure there are no pushed graphics states
+        while (!context->pushedGraphicsStates.empty()) {
+            std::cerr << "Missing end to pbrtAttributeBegin()" << std::endl;
+            context->pushedGraphicsStates.pop_back();
+            context->pushedTransforms.pop_back();
+            context->pushedActiveTransformBits.pop_back();
+        }
+        while (!context->pushedTransforms.empty()) {
+            std::cerr << "Missing end to pbrtTransformBegin()" << std::endl;
+            context->pushedTransforms.pop_back();
+            context->pushedActiveTransformBits.pop_back();
+        }
 
+        if (context->options.retainScene) {
+            std::shared_ptr<ResidentScene> resident =
+                    std::make_shared<ResidentScene>();
+            resident->options = context->options;
+            resident->sceneHash = context->sceneHash;
+            resident->scene.reset(context->renderOptions->MakeScene());
+            resident->renderOptions = std::move(*context->renderOptions);
+            context->residentScene = resident;
+        } else {
+            std::vector<std::unique_ptr<SamplerIntegrator>> integrators =
+                    context->renderOptions->MakeIntegrators();
+            std::unique_ptr<Scene> scene(context->renderOptions->MakeScene());
+            // All views are rendered together; the scene is built only once
+            std::vector<SamplerIntegrator *> views;
+            for (const auto &integrator : integrators)
+                views.push_back(integrator.get());
+            if (scene && !views.empty())
+                SamplerIntegrator::RenderViews(*scene, views);
+        }
+        context->transformCache.PrintStats();
+        ReportMemoryUsage(std::cout);
+
+        // A scene file may describe several images
+        context->graphicsState = GraphicsState();
+        context->renderOptions.reset(new RenderOptions);
+        for (int i = 0; i < MaxTransforms; ++i)
+            context->curTransform[i] = Transform();
+        context->activeTransformBits = AllTransformsBits;
+        context->namedCoordinateSystems.clear();
     }
 
-    void pbrtLightSource(const std::string &name) {
-        std::shared_ptr<Light> lt = MakeLight(name, curTransform[0]);
-        renderOptions->lights.push_back(lt);
+    void pbrtHashSceneInput(const void *data, size_t size) {
+        context->sceneHash = HashBuffer(data, size, context->sceneHash);
+    }
 
+    std::shared_ptr<const ResidentScene> pbrtResidentScene() {
+        return context->residentScene;
     }
 
-    void pbrtShape(const std::string &name) {
-        std::vector<std::shared_ptr<Primitive>> prims;
-        Transform *ObjToWorld = transformCache.Lookup(curTransform[0]);
-        Transform *WorldToObj = transformCache.Lookup(Inverse(curTransform[0]));
+    bool pbrtRenderView(const ResidentScene &resident, const SceneView &view) {
+        Options options = resident.options;
+        if (!view.imageFile.empty()) {
+            // Views rendered at once must not share a checkpoint or backing
+            // file, so each follows the view's image
+            options.imageFile = view.imageFile;
+            if (!options.checkpointFile.empty())
+                options.checkpointFile = view.imageFile + ".checkpoint";
+            if (!options.filmBackingFile.empty())
+                options.filmBackingFile = view.imageFile + ".backing";
+        }
+        if (view.pixelSamples > 0) options.pixelSamples = view.pixelSamples;
+        RenderOptions renderOptions = resident.renderOptions;
+        // Without a name, the first named camera if there are any
+        CameraDescription camera = renderOptions.camera;
+        if (!view.camera.empty() || !renderOptions.namedCameras.empty()) {
+            auto iter = std::find_if(
+                    renderOptions.namedCameras.begin(),
+                    renderOptions.namedCameras.end(),
+                    [&](const CameraDescription &c) {
+                        return view.camera.empty() || c.name == view.camera;
+                    });
+            if (iter == renderOptions.namedCameras.end()) {
+                std::cerr << "Camera \"" << view.camera << "\" unknown."
+                          << std::endl;
+                return false;
+            }
+            camera = *iter;
+        }
+        if (view.hasCropWindow) {
+            std::unique_ptr<float[]> crop(new float[4]);
+            for (int i = 0; i < 4; ++i) crop[i] = view.cropWindow[i];
+            renderOptions.FilmParams.AddFloat("cropwindow", std::move(crop), 4);
+        }
+        if (view.hasLookAt) {
+            const float *la = view.lookAt;
+            Transform cameraToWorld = Inverse(
+                    LookAt(Point3f(la[0], la[1], la[2]), Point3f(la[3], la[4], la[5]),
+                           Vector3f(la[6], la[7], la[8])));
+            for (int i = 0; i < MaxTransforms; ++i)
+                camera.CameraToWorld[i] = cameraToWorld;
+        }
+
+        // The camera, film and sampler read the options of the current
+        // context, so the view is rendered in one of its own
+        RenderContext *previous = context;
+        RenderContext viewContext(options);
+        viewContext.sceneHash = resident.sceneHash;
+        pbrtSetContext(&viewContext);
+        std::unique_ptr<Integrator> integrator(
+                renderOptions.MakeIntegrator(camera, ""));
+        if (integrator) integrator->Render(*resident.scene);
+        pbrtSetContext(previous);
+        return integrator != nullptr;
+    }
+
+    void pbrtLightSource(const std::string &name, const ParamSet &params) {
+        std::shared_ptr<Light> lt =
+                MakeLight(name, params, context->curTransform[0]);
+        if (!lt)
+            std::cerr << "pbrtLightSource: light type \"" << name
+                      << "\" unknown." << std::endl;
+        else
+            context->renderOptions->lights.push_back(lt);
+
+    }
+
+    void pbrtShape(const std::string &name, const ParamSet &params) {
+        TransformCache &transformCache = context->transformCache;
+        Transform *ObjToWorld = transformCache.Lookup(context->curTransform[0]);
+        Transform *WorldToObj =
+                transformCache.Lookup(Inverse(context->curTransform[0]));
         std::vector<std::shared_ptr<Shape>> shapes =
-                MakeShapes(name, ObjToWorld, WorldToObj);
+                MakeShapes(name, ObjToWorld, WorldToObj, params);
+        params.ReportUnused();
         if (shapes.empty()) return;
-        std::shared_ptr<Material> mtl = graphicsState.GetMaterialForShape();
-        prims.reserve(shapes.size());
+        std::shared_ptr<Material> mtl =
+                context->graphicsState.GetMaterialForShape();
         for (auto s : shapes) {
-            prims.push_back(std::make_shared<GeometricPrimitive>(s, mtl));
+            context->renderOptions->primitives.push_back(
+                    std::make_shared<GeometricPrimitive>(s, mtl));
+        }
+    }
+
+    void pbrtShapes(const std::string &name, const ParamSet &params,
+                    const std::vector<std::string> &valueNames,
+                    const float *entries, size_t count) {
+        if (count == 0) return;
+        const size_t stride = 16 + valueNames.size();
+        std::shared_ptr<Material> mtl =
+                context->graphicsState.GetMaterialForShape();
+        // The worker threads have no context of their own
+        TransformCache &transformCache = context->transformCache;
+        // Replaces the values of the previous entry in _ps_
+        auto setValues = [&](ParamSet &ps, size_t i) {
+            const float *values = entries + i * stride + 16;
+            for (size_t j = 0; j < valueNames.size(); ++j) {
+                std::unique_ptr<float[]> v(new float[1]);
+                v[0] = values[j];
+                ps.AddFloat(valueNames[j], std::move(v), 1);
+            }
+        };
+        auto makePrimitives = [&](size_t i, const ParamSet &ps,
+                                  std::vector<std::shared_ptr<Primitive>> &prims) {
+            Transform objToWorld = MatrixTransform(entries + i * stride);
+            Transform *ObjToWorld = transformCache.Lookup(objToWorld);
+            Transform *WorldToObj = transformCache.Lookup(Inverse(objToWorld));
+            for (auto s : MakeShapes(name, ObjToWorld, WorldToObj, ps))
+                prims.push_back(std::make_shared<GeometricPrimitive>(s, mtl));
+        };
+
+        // The first shape is made here so that an unknown shape type or an
+        // unused parameter is reported once rather than for every shape
+        ParamSet firstParams = params;
+        setValues(firstParams, 0);
+        std::vector<std::shared_ptr<Primitive>> firstPrims;
+        makePrimitives(0, firstParams, firstPrims);
+        firstParams.ReportUnused();
+        if (firstPrims.empty()) return;
+
+        // Make the others in chunks on the thread pool
+        const size_t chunkSize = 4096;
+        size_t nChunks = (count - 1 + chunkSize - 1) / chunkSize;
+        std::vector<std::vector<std::shared_ptr<Primitive>>> chunkPrims(nChunks);
+        ParallelFor([&](int64_t chunk) {
+            size_t start = 1 + chunk * chunkSize;
+            size_t end = std::min(count, start + chunkSize);
+            ParamSet ps = params;
+            chunkPrims[chunk].reserve(end - start);
+            for (size_t i = start; i < end; ++i) {
+                setValues(ps, i);
+                makePrimitives(i, ps, chunkPrims[chunk]);
+            }
+        }, nChunks);
+
+        // Append them in entry order, whichever thread made them
+        std::vector<std::shared_ptr<Primitive>> &primitives =
+                context->renderOptions->primitives;
+        size_t total = primitives.size() + firstPrims.size();
+        for (const auto &prims : chunkPrims) total += prims.size();
+        primitives.reserve(total);
+        primitives.insert(primitives.end(), firstPrims.begin(), firstPrims.end());
+        for (auto &prims : chunkPrims) {
+            primitives.insert(primitives.end(),
+                              std::make_move_iterator(prims.begin()),
+                              std::make_move_iterator(prims.end()));
+            prims = std::vector<std::shared_ptr<Primitive>>();
         }
     }
 
     void pbrtTranslate(float dx, float dy, float dz) {
-        FOR_ACTIVE_TRANSFORMS(curTransform[i] = curTransform[i] *
+        FOR_ACTIVE_TRANSFORMS(context->curTransform[i] = context->curTransform[i] *
                                                 Translate(Vector3f(dx, dy, dz));)
     }
 
     void pbrtCleanup() {
-
+        ParallelCleanup();
+        pbrtDestroyContext(context);
     }
 
 
     std::shared_ptr<Sampler> MakeSampler(const std::string &name,
+                                         const ParamSet &paramSet,
                                          const Film *film) {
         Sampler *sampler = nullptr;
         if (name == "random")
-            sampler = CreateRandomSampler();
+            sampler = CreateRandomSampler(paramSet);
+        else if (name == "sobol")
+            sampler = CreateSobolSampler(paramSet, film->GetSampleBounds());
+        else if (name == "halton")
+            sampler = CreateHaltonSampler(paramSet, film->GetSampleBounds());
+        else if (name == "02sequence" || name == "lowdiscrepancy")
+            sampler = CreateZeroTwoSequenceSampler(paramSet);
+        else if (name == "bluenoise")
+            sampler = CreateBlueNoiseSampler(paramSet);
+        else {
+            std::cerr << "Sampler \"" << name << "\" unknown; using random" << std::endl;
+            sampler = CreateRandomSampler(paramSet);
+        }
+        paramSet.ReportUnused();
         return std::shared_ptr<Sampler>(sampler);
 
     }
-    Camera *MakeCamera(const std::string &name, const TransformSet &cam2worldSet, Film *film) {
+    Camera *MakeCamera(const std::string &name, const ParamSet &paramSet,
+                       const TransformSet &cam2worldSet, Film *film) {
         Camera *camera = nullptr;
         Transform *cam2world[2] = {
-                transformCache.Lookup(cam2worldSet[0]),
-                transformCache.Lookup(cam2worldSet[1])
+                context->transformCache.Lookup(cam2worldSet[0]),
+                context->transformCache.Lookup(cam2worldSet[1])
         };
-        Transform *c2w = transformCache.Lookup(cam2worldSet[0]);
-        camera = CreateOrthographicCamera(*c2w, film);
+        if (name == "orthographic")
+            camera = CreateOrthographicCamera(paramSet, *cam2world[0], film);
+        else
+            std::cerr << "Camera \"" << name << "\" unknown." << std::endl;
+        paramSet.ReportUnused();
         return camera;
     }
 
-    std::unique_ptr<Filter> MakeFilter(const std::string &name) {
+    std::unique_ptr<Filter> MakeFilter(const std::string &name,
+                                       const ParamSet &paramSet) {
         Filter *filter = nullptr;
         if (name == "box")
-            filter = CreateBoxFilter();
+            filter = CreateBoxFilter(paramSet);
+        else if (name == "gaussian")
+            filter = CreateGaussianFilter(paramSet);
+        else if (name == "mitchell")
+            filter = CreateMitchellFilter(paramSet);
+        else if (name == "sinc")
+            filter = CreateSincFilter(paramSet);
+        else {
+            std::cerr << "Filter \"" << name << "\" unknown; using box" << std::endl;
+            filter = CreateBoxFilter(paramSet);
+        }
+        paramSet.ReportUnused();
         return std::unique_ptr<Filter>(filter);
     }
 
 
-    Film *MakeFilm(const std::string &name, std::unique_ptr<Filter> filter){
+    Film *MakeFilm(const std::string &name, const ParamSet &paramSet,
+                   std::unique_ptr<Filter> filter, const std::string &viewName){
         Film *film = nullptr;
         if (name == "image")
-            film = CreateFilm(std::move(filter));
+            film = CreateFilm(paramSet, std::move(filter), viewName);
+        else
+            std::cerr << "Film \"" << name << "\" unknown." << std::endl;
+        paramSet.ReportUnused();
         return film;
     }
 
-    Integrator *RenderOptions::MakeIntegrator() const {
-        std::shared_ptr<const Camera> camera(MakeCamera());
+    SamplerIntegrator *RenderOptions::MakeIntegrator(
+            const CameraDescription &cameraDescription,
+            const std::string &viewName) const {
+        std::shared_ptr<const Camera> camera(
+                MakeCamera(cameraDescription, viewName));
+        if (!camera) {
+            std::cerr << "Unable to create camera" << std::endl;
+            return nullptr;
+        }
         std::shared_ptr<Sampler> sampler =
-                MakeSampler(SamplerName, camera->film);
-        Integrator *integrator = nullptr;
+                MakeSampler(SamplerName, SamplerParams, camera->film);
+        SamplerIntegrator *integrator = nullptr;
         if (IntegratorName == "whitted")
-            integrator = CreateWhittedIntegrator(sampler, camera);
+            integrator = CreateWhittedIntegrator(IntegratorParams, sampler, camera);
+        else
+            std::cerr << "Integrator \"" << IntegratorName << "\" unknown."
+                      << std::endl;
+        IntegratorParams.ReportUnused();
+        if (integrator)
+            integrator->renderHash = RenderHash(cameraDescription, viewName);
 
         return integrator;
     }
 
-    Camera *RenderOptions::MakeCamera() const {
-        std::unique_ptr<Filter> filter = MakeFilter(FilterName);
-        Film *film = MakeFilm(FilmName, std::move(filter));
-        Camera *camera = pbrt::MakeCamera(CameraName,CameraToWorld,film);
+    uint64_t RenderOptions::RenderHash(const CameraDescription &cameraDescription,
+                                       const std::string &viewName) const {
+        uint64_t hash = context->sceneHash;
+        auto hashString = [&](const std::string &str) {
+            hash = HashBuffer(str.data(), str.size(), hash);
+        };
+        hashString(viewName);
+        hashString(cameraDescription.type);
+        hash = cameraDescription.params.Hash(hash);
+        for (int i = 0; i < MaxTransforms; ++i) {
+            const Matrix4x4 &m = cameraDescription.CameraToWorld[i].GetMatrix();
+            hash = HashBuffer(m.m, sizeof(m.m), hash);
+        }
+        hashString(FilterName);
+        hash = FilterParams.Hash(hash);
+        hashString(FilmName);
+        hash = FilmParams.Hash(hash);
+        hashString(SamplerName);
+        hash = SamplerParams.Hash(hash);
+        hashString(IntegratorName);
+        hash = IntegratorParams.Hash(hash);
+
+        // The options that change which samples are taken or how they are
+        // weighted; the output file names do not
+        const Options &o = PbrtOptions;
+        hash = HashBuffer(o.cropWindow, sizeof(o.cropWindow), hash);
+        int32_t ints[4] = {o.pixelSamples, o.sampleFilter, o.progressive,
+                           o.adaptiveMinSamples};
+        hash = HashBuffer(ints, sizeof(ints), hash);
+        return HashBuffer(&o.adaptiveThreshold, sizeof(float), hash);
+    }
+
+    std::vector<std::unique_ptr<SamplerIntegrator>>
+    RenderOptions::MakeIntegrators() const {
+        std::vector<std::unique_ptr<SamplerIntegrator>> integrators;
+        if (namedCameras.empty()) {
+            SamplerIntegrator *integrator = MakeIntegrator(camera, "");
+            if (integrator) integrators.emplace_back(integrator);
+        }
+        for (const CameraDescription &named : namedCameras) {
+            SamplerIntegrator *integrator = MakeIntegrator(named, named.name);
+            if (integrator) integrators.emplace_back(integrator);
+        }
+        return integrators;
+    }
+
+    Camera *RenderOptions::MakeCamera(const CameraDescription &cameraDescription,
+                                      const std::string &viewName) const {
+        std::unique_ptr<Filter> filter = MakeFilter(FilterName, FilterParams);
+        Film *film = MakeFilm(FilmName, FilmParams, std::move(filter), viewName);
+        if (!film) {
+            std::cerr << "Unable to create film." << std::endl;
+            return nullptr;
+        }
+        Camera *camera = pbrt::MakeCamera(cameraDescription.type,
+                                          cameraDescription.params,
+                                          cameraDescription.CameraToWorld, film);
         return camera;
     }
 
     Scene *RenderOptions::MakeScene() {
-        std::shared_ptr<Primitive> accelerator;
+        std::shared_ptr<Primitive> accelerator =
+                std::make_shared<BVHAccel>(std::move(primitives));
         Scene *scene = new Scene(accelerator,lights);
         primitives.clear();
         lights.clear();
         return scene;
     }
 
-}
\ No newline at end of file
+}
@@ -9,20 +9,96 @@
 
 namespace pbrt{
 
+    // Starts the thread pool and makes a context with _opt_ current on the
+    // calling thread; _pbrtCleanup()_ stops the pool and destroys it
     void pbrtInit(const Options &opt);
     void pbrtCleanup();
+
+    // The graphics state, transforms and scene under construction that the
+    // pbrt*() calls work on, with the _Options_ the scene is rendered with.
+    // Each thread has its own current context, so scenes in separate
+    // contexts can be described and rendered concurrently on the shared
+    // thread pool. A context must be current on at most one thread.
+    class RenderContext;
+    RenderContext *pbrtCreateContext(const Options &opt);
+    void pbrtDestroyContext(RenderContext *ctx);
+    // Also makes the context's options the thread's _PbrtOptions_
+    void pbrtSetContext(RenderContext *ctx);
+    RenderContext *pbrtGetContext();
+
+    void pbrtIdentity();
     void pbrtTranslate(float dx, float dy, float dz);
-    void pbrtFilm(const std::string &type);
+    void pbrtRotate(float angle, float ax, float ay, float az);
+    void pbrtScale(float sx, float sy, float sz);
     void pbrtLookAt(float ex, float ey, float ez, float lx, float ly, float lz,
                     float ux, float uy, float uz);
-    void pbrtIntegrator(const std::string &name);
-    void pbrtCamera(const std::string &name);
+    void pbrtConcatTransform(const float transform[16]);
+    void pbrtTransform(const float transform[16]);
+    void pbrtCoordinateSystem(const std::string &);
+    void pbrtCoordSysTransform(const std::string &);
+    void pbrtActiveTransformAll();
+    void pbrtActiveTransformEndTime();
+    void pbrtActiveTransformStartTime();
+    void pbrtPixelFilter(const std::string &name, const ParamSet &params);
+    void pbrtFilm(const std::string &type, const ParamSet &params);
+    void pbrtSampler(const std::string &name, const ParamSet &params);
+    void pbrtIntegrator(const std::string &name, const ParamSet &params);
+    void pbrtCamera(const std::string &name, const ParamSet &cameraParams);
 
     void pbrtWorldBegin();
-
-    void pbrtLightSource(const std::string &name);
-    void pbrtShape(const std::string &name);
+    void pbrtAttributeBegin();
+    void pbrtAttributeEnd();
+    void pbrtTransformBegin();
+    void pbrtTransformEnd();
+    void pbrtMaterial(const std::string &name, const ParamSet &params);
+    void pbrtMakeNamedMaterial(const std::string &name, const ParamSet &params);
+    void pbrtNamedMaterial(const std::string &name);
+    void pbrtLightSource(const std::string &name, const ParamSet &params);
+    void pbrtShape(const std::string &name, const ParamSet &params);
+    // Makes _count_ shapes of type _name_ on the thread pool, as if each were
+    // _pbrtTransformBegin(); pbrtTransform(); pbrtShape(); pbrtTransformEnd()_.
+    // Entry _i_ starts at _entries + i * (16 + k)_ with the matrix given to
+    // _pbrtTransform()_, followed by the values of the _k_ single-float
+    // parameters named by _valueNames_, which are added to _params_. The
+    // primitives are added in entry order.
+    void pbrtShapes(const std::string &name, const ParamSet &params,
+                    const std::vector<std::string> &valueNames,
+                    const float *entries, size_t count);
     void pbrtWorldEnd();
+    // Folds the text of a scene file into the hash that checkpoints of the
+    // context's renders are tagged with, so that one is not resumed after
+    // the scene changed; _pbrtParseFile()_ calls it for every file
+    void pbrtHashSceneInput(const void *data, size_t size);
+
+    // A scene built by _pbrtWorldEnd()_ with _Options::retainScene_ set,
+    // kept in memory with the camera, film, sampler and integrator the file
+    // described, so that it can be rendered many times. Any number of
+    // threads may render it at once.
+    class ResidentScene;
+    // The scene kept by the current context's last _pbrtWorldEnd()_
+    std::shared_ptr<const ResidentScene> pbrtResidentScene();
+
+    // What to change for one image of a resident scene; everything else is
+    // as the scene file gave it
+    struct SceneView {
+        // The named camera to render; without one, the first named camera
+        // or the scene's only camera
+        std::string camera;
+        // Replaces the whole world-to-camera transform
+        bool hasLookAt = false;
+        float lookAt[9];  // eye, look, up
+        bool hasCropWindow = false;
+        float cropWindow[4];  // x0, x1, y0, y1
+        int pixelSamples = 0;
+        // Also names the view's checkpoint and backing file, if the scene's
+        // options ask for them, as _<imageFile>.checkpoint_ and
+        // _<imageFile>.backing_
+        std::string imageFile;
+    };
+    // Renders _view_ of _scene_ on the calling thread and the thread pool;
+    // the thread's current context is left unchanged. Returns _false_ if
+    // the camera or integrator could not be made.
+    bool pbrtRenderView(const ResidentScene &scene, const SceneView &view);
 
 
 }
@@ -0,0 +1,885 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#include "binaryscene.h"
+#include <cstring>
+
+namespace pbrt {
+
+    static const char BinarySceneMagic[8] = {'P', 'B', 'R', 'T', 'B', 'S', 'C', 'N'};
+    static const uint32_t BinarySceneVersion = 1;
+    static const uint32_t BinarySceneByteOrder = 0x01020304;
+
+    struct BinarySceneHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t byteOrder;
+    };
+
+    // Parameter types as they are stored in a record
+    enum class BinaryParam : uint32_t {
+        Float, Int, Bool, Point2f, Vector2f, Point3f, Vector3f, Normal3f, RGB,
+        String, Texture
+    };
+
+    static size_t RoundUp(size_t n, size_t alignment) {
+        return (n + alignment - 1) / alignment * alignment;
+    }
+
+    // BinaryScene Reading
+
+    // Decodes the payload of one record; reading past its end or a malformed
+    // value clears _ok_
+    class RecordReader {
+    public:
+        RecordReader(const uint8_t *begin, const uint8_t *ptr, const uint8_t *end)
+                : begin(begin), ptr(ptr), end(end) {}
+
+        const uint8_t *Skip(size_t n) {
+            if (!ok || (size_t)(end - ptr) < n) {
+                ok = false;
+                return nullptr;
+            }
+            const uint8_t *p = ptr;
+            ptr += n;
+            return p;
+        }
+        bool Read(void *dst, size_t n) {
+            const uint8_t *p = Skip(n);
+            if (p) memcpy(dst, p, n);
+            return p != nullptr;
+        }
+        uint32_t ReadUInt32() {
+            uint32_t v = 0;
+            Read(&v, sizeof(v));
+            return v;
+        }
+        void Align(size_t alignment) {
+            Skip(RoundUp(ptr - begin, alignment) - (ptr - begin));
+        }
+        std::string ReadString() {
+            uint32_t length = ReadUInt32();
+            const uint8_t *p = Skip(length);
+            Align(4);
+            return p ? std::string((const char *)p, length) : std::string();
+        }
+        void ReadFloats(float *v, int n) { Read(v, n * sizeof(float)); }
+        ParamSet ReadParamSet();
+
+        size_t Offset() const { return ptr - begin; }
+        size_t Remaining() const { return end - ptr; }
+
+        bool ok = true;
+
+    private:
+        const uint8_t *begin, *ptr, *end;
+    };
+
+    template <typename T>
+    static std::unique_ptr<T[]> ReadTuples2(RecordReader &r, uint32_t n) {
+        std::unique_ptr<float[]> f(new float[2 * n]);
+        r.ReadFloats(f.get(), 2 * n);
+        std::unique_ptr<T[]> v(new T[n]);
+        for (uint32_t i = 0; i < n; ++i) v[i] = T(f[2 * i], f[2 * i + 1]);
+        return v;
+    }
+
+    template <typename T>
+    static std::unique_ptr<T[]> ReadTuples3(RecordReader &r, uint32_t n) {
+        std::unique_ptr<float[]> f(new float[3 * n]);
+        r.ReadFloats(f.get(), 3 * n);
+        std::unique_ptr<T[]> v(new T[n]);
+        for (uint32_t i = 0; i < n; ++i)
+            v[i] = T(f[3 * i], f[3 * i + 1], f[3 * i + 2]);
+        return v;
+    }
+
+    ParamSet RecordReader::ReadParamSet() {
+        ParamSet ps;
+        uint32_t count = ReadUInt32();
+        for (uint32_t i = 0; i < count && ok; ++i) {
+            BinaryParam type = (BinaryParam)ReadUInt32();
+            std::string name = ReadString();
+            uint32_t n = ReadUInt32();
+            // Every value takes at least one byte, which bounds _n_ before
+            // anything is allocated
+            if (!ok || n > Remaining()) {
+                ok = false;
+                break;
+            }
+            switch (type) {
+                case BinaryParam::Float: {
+                    std::unique_ptr<float[]> v(new float[n]);
+                    ReadFloats(v.get(), n);
+                    ps.AddFloat(name, std::move(v), n);
+                    break;
+                }
+                case BinaryParam::Int: {
+                    std::unique_ptr<int[]> v(new int[n]);
+                    Read(v.get(), n * sizeof(int));
+                    ps.AddInt(name, std::move(v), n);
+                    break;
+                }
+                case BinaryParam::Bool: {
+                    std::unique_ptr<bool[]> v(new bool[n]);
+                    const uint8_t *p = Skip(n);
+                    for (uint32_t j = 0; p && j < n; ++j) v[j] = p[j] != 0;
+                    Align(4);
+                    ps.AddBool(name, std::move(v), n);
+                    break;
+                }
+                case BinaryParam::Point2f:
+                    ps.AddPoint2f(name, ReadTuples2<Point2f>(*this, n), n);
+                    break;
+                case BinaryParam::Vector2f:
+                    ps.AddVector2f(name, ReadTuples2<Vector2f>(*this, n), n);
+                    break;
+                case BinaryParam::Point3f:
+                    ps.AddPoint3f(name, ReadTuples3<Point3f>(*this, n), n);
+                    break;
+                case BinaryParam::Vector3f:
+                    ps.AddVector3f(name, ReadTuples3<Vector3f>(*this, n), n);
+                    break;
+                case BinaryParam::Normal3f:
+                    ps.AddNormal3f(name, ReadTuples3<Normal3f>(*this, n), n);
+                    break;
+                case BinaryParam::RGB: {
+                    std::unique_ptr<float[]> v(new float[3 * n]);
+                    ReadFloats(v.get(), 3 * n);
+                    ps.AddRGBSpectrum(name, std::move(v), n);
+                    break;
+                }
+                case BinaryParam::String: {
+                    std::unique_ptr<std::string[]> v(new std::string[n]);
+                    for (uint32_t j = 0; j < n; ++j) v[j] = ReadString();
+                    ps.AddString(name, std::move(v), n);
+                    break;
+                }
+                case BinaryParam::Texture:
+                    ps.AddTexture(name, ReadString());
+                    break;
+                default:
+                    ok = false;
+            }
+        }
+        return ps;
+    }
+
+    // Reads the fixed part of a _ShapeBatch_ record and leaves _entries_
+    // pointing at its first entry
+    static bool ReadShapeBatch(RecordReader &r, ShapeBatch *batch) {
+        batch->name = r.ReadString();
+        batch->params = r.ReadParamSet();
+        uint32_t nValueNames = r.ReadUInt32();
+        // Each name takes at least four bytes
+        if (!r.ok || nValueNames > r.Remaining() / 4) return false;
+        batch->valueNames.resize(nValueNames);
+        for (uint32_t i = 0; i < nValueNames; ++i)
+            batch->valueNames[i] = r.ReadString();
+        r.Align(8);
+        uint64_t count = 0;
+        r.Read(&count, sizeof(count));
+        if (!r.ok) return false;
+        size_t entrySize = batch->Stride() * sizeof(float);
+        if (count > r.Remaining() / entrySize) return false;
+        const uint8_t *entries = r.Skip(count * entrySize);
+        if (!entries) return false;
+        batch->count = count;
+        batch->entries = (const float *)entries;
+        return true;
+    }
+
+    bool BinaryScene::IsBinaryScene(const std::string &filename) {
+        FILE *f = fopen(filename.c_str(), "rb");
+        if (!f) return false;
+        char magic[sizeof(BinarySceneMagic)];
+        bool isBinary = fread(magic, sizeof(magic), 1, f) == 1 &&
+                        memcmp(magic, BinarySceneMagic, sizeof(magic)) == 0;
+        fclose(f);
+        return isBinary;
+    }
+
+    std::unique_ptr<BinaryScene> BinaryScene::Open(const std::string &filename) {
+        std::unique_ptr<MappedFile> file = MappedFile::Open(filename);
+        if (!file) {
+            std::cerr << filename << ": unable to open binary scene"
+                      << std::endl;
+            return nullptr;
+        }
+        BinarySceneHeader header;
+        if (file->Size() < sizeof(header)) {
+            std::cerr << filename << ": not a binary scene" << std::endl;
+            return nullptr;
+        }
+        memcpy(&header, file->Data(), sizeof(header));
+        if (memcmp(header.magic, BinarySceneMagic, sizeof(header.magic)) != 0) {
+            std::cerr << filename << ": not a binary scene" << std::endl;
+            return nullptr;
+        }
+        if (header.byteOrder != BinarySceneByteOrder) {
+            std::cerr << filename << ": binary scene was written on a machine "
+                         "with a different byte order" << std::endl;
+            return nullptr;
+        }
+        if (header.version != BinarySceneVersion) {
+            std::cerr << filename << ": unsupported binary scene version "
+                      << header.version << std::endl;
+            return nullptr;
+        }
+        return std::unique_ptr<BinaryScene>(
+                new BinaryScene(filename, std::move(file)));
+    }
+
+    bool BinaryScene::Error(size_t offset, const char *message) const {
+        std::cerr << filename << ": " << offset << ": " << message << std::endl;
+        return false;
+    }
+
+    bool BinaryScene::Replay(ParserTarget *target) const {
+        const uint8_t *data = file->Data();
+        size_t size = file->Size();
+        size_t offset = sizeof(BinarySceneHeader);
+        while (offset < size) {
+            BinaryRecordHeader header;
+            if (size - offset < sizeof(header))
+                return Error(offset, "truncated record header");
+            memcpy(&header, data + offset, sizeof(header));
+            size_t payload = offset + sizeof(header);
+            if (header.size > size - payload || header.size % 8 != 0)
+                return Error(offset, "bad record size");
+            RecordReader r(data, data + payload, data + payload + header.size);
+            float v[16];
+            switch (header.type) {
+                case BinaryRecord::Identity:
+                    target->Identity();
+                    break;
+                case BinaryRecord::Translate:
+                    r.ReadFloats(v, 3);
+                    if (r.ok) target->Translate(v[0], v[1], v[2]);
+                    break;
+                case BinaryRecord::Rotate:
+                    r.ReadFloats(v, 4);
+                    if (r.ok) target->Rotate(v[0], v[1], v[2], v[3]);
+                    break;
+                case BinaryRecord::Scale:
+                    r.ReadFloats(v, 3);
+                    if (r.ok) target->Scale(v[0], v[1], v[2]);
+                    break;
+                case BinaryRecord::LookAt:
+                    r.ReadFloats(v, 9);
+                    if (r.ok)
+                        target->LookAt(v[0], v[1], v[2], v[3], v[4], v[5], v[6],
+                                       v[7], v[8]);
+                    break;
+                case BinaryRecord::ConcatTransform:
+                    r.ReadFloats(v, 16);
+                    if (r.ok) target->ConcatTransform(v);
+                    break;
+                case BinaryRecord::Transform:
+                    r.ReadFloats(v, 16);
+                    if (r.ok) target->Transform(v);
+                    break;
+                case BinaryRecord::CoordinateSystem: {
+                    std::string name = r.ReadString();
+                    if (r.ok) target->CoordinateSystem(name);
+                    break;
+                }
+                case BinaryRecord::CoordSysTransform: {
+                    std::string name = r.ReadString();
+                    if (r.ok) target->CoordSysTransform(name);
+                    break;
+                }
+                case BinaryRecord::ActiveTransformAll:
+                    target->ActiveTransformAll();
+                    break;
+                case BinaryRecord::ActiveTransformEndTime:
+                    target->ActiveTransformEndTime();
+                    break;
+                case BinaryRecord::ActiveTransformStartTime:
+                    target->ActiveTransformStartTime();
+                    break;
+                case BinaryRecord::WorldBegin:
+                    target->WorldBegin();
+                    break;
+                case BinaryRecord::AttributeBegin:
+                    target->AttributeBegin();
+                    break;
+                case BinaryRecord::AttributeEnd:
+                    target->AttributeEnd();
+                    break;
+                case BinaryRecord::TransformBegin:
+                    target->TransformBegin();
+                    break;
+                case BinaryRecord::TransformEnd:
+                    target->TransformEnd();
+                    break;
+                case BinaryRecord::NamedMaterial: {
+                    std::string name = r.ReadString();
+                    if (r.ok) target->NamedMaterial(name);
+                    break;
+                }
+                case BinaryRecord::WorldEnd:
+                    target->WorldEnd();
+                    break;
+                case BinaryRecord::PixelFilter:
+                case BinaryRecord::Film:
+                case BinaryRecord::Sampler:
+                case BinaryRecord::Integrator:
+                case BinaryRecord::Camera:
+                case BinaryRecord::Material:
+                case BinaryRecord::MakeNamedMaterial:
+                case BinaryRecord::LightSource:
+                case BinaryRecord::Shape: {
+                    std::string name = r.ReadString();
+                    ParamSet params = r.ReadParamSet();
+                    if (!r.ok) break;
+                    switch (header.type) {
+                        case BinaryRecord::PixelFilter:
+                            target->PixelFilter(name, params);
+                            break;
+                        case BinaryRecord::Film:
+                            target->Film(name, params);
+                            break;
+                        case BinaryRecord::Sampler:
+                            target->Sampler(name, params);
+                            break;
+                        case BinaryRecord::Integrator:
+                            target->Integrator(name, params);
+                            break;
+                        case BinaryRecord::Camera:
+                            target->Camera(name, params);
+                            break;
+                        case BinaryRecord::Material:
+                            target->Material(name, params);
+                            break;
+                        case BinaryRecord::MakeNamedMaterial:
+                            target->MakeNamedMaterial(name, params);
+                            break;
+                        case BinaryRecord::LightSource:
+                            target->LightSource(name, params);
+                            break;
+                        default:
+                            target->Shape(name, params);
+                    }
+                    break;
+                }
+                case BinaryRecord::ShapeBatch: {
+                    ShapeBatch batch;
+                    if (!ReadShapeBatch(r, &batch))
+                        return Error(offset, "malformed shape batch");
+                    target->Shapes(batch.name, batch.params,
+                                   batch.valueNames, batch.entries,
+                                   batch.count);
+                    break;
+                }
+                default:
+                    return Error(offset, "unknown record type");
+            }
+            if (!r.ok) return Error(offset, "malformed record");
+            offset = payload + header.size;
+        }
+        return true;
+    }
+
+    std::vector<ShapeBatch> BinaryScene::ShapeBatches() const {
+        std::vector<ShapeBatch> batches;
+        const uint8_t *data = file->Data();
+        size_t size = file->Size();
+        size_t offset = sizeof(BinarySceneHeader);
+        while (size - offset >= sizeof(BinaryRecordHeader)) {
+            BinaryRecordHeader header;
+            memcpy(&header, data + offset, sizeof(header));
+            size_t payload = offset + sizeof(header);
+            if (header.size > size - payload) {
+                Error(offset, "bad record size");
+                break;
+            }
+            if (header.type == BinaryRecord::ShapeBatch) {
+                RecordReader r(data, data + payload, data + payload + header.size);
+                ShapeBatch batch;
+                if (!ReadShapeBatch(r, &batch)) {
+                    Error(offset, "malformed shape batch");
+                    break;
+                }
+                batches.push_back(std::move(batch));
+            }
+            offset = payload + header.size;
+        }
+        return batches;
+    }
+
+    // BinarySceneWriter Method Definitions
+    std::unique_ptr<BinarySceneWriter> BinarySceneWriter::Create(
+            const std::string &filename) {
+        FILE *f = fopen(filename.c_str(), "wb");
+        if (!f) {
+            std::cerr << filename << ": unable to create binary scene"
+                      << std::endl;
+            return nullptr;
+        }
+        BinarySceneHeader header;
+        memcpy(header.magic, BinarySceneMagic, sizeof(header.magic));
+        header.version = BinarySceneVersion;
+        header.byteOrder = BinarySceneByteOrder;
+        std::unique_ptr<BinarySceneWriter> writer(new BinarySceneWriter(f));
+        writer->ok = fwrite(&header, sizeof(header), 1, f) == 1;
+        return writer;
+    }
+
+    BinarySceneWriter::~BinarySceneWriter() {
+        if (f) Close();
+    }
+
+    bool BinarySceneWriter::Close() {
+        EndBatch();
+        if (fclose(f) != 0) ok = false;
+        f = nullptr;
+        return ok;
+    }
+
+    void BinarySceneWriter::Write(const void *data, size_t size) {
+        const uint8_t *bytes = (const uint8_t *)data;
+        buffer.insert(buffer.end(), bytes, bytes + size);
+    }
+
+    void BinarySceneWriter::Pad(size_t alignment) {
+        // Records start eight-byte aligned, so the buffer's alignment is the
+        // file's
+        buffer.resize(RoundUp(buffer.size(), alignment), 0);
+    }
+
+    void BinarySceneWriter::WriteString(const std::string &str) {
+        uint32_t length = str.size();
+        Write(&length, sizeof(length));
+        Write(str.data(), length);
+        Pad(4);
+    }
+
+    void BinarySceneWriter::WriteParamHeader(uint32_t type,
+                                             const std::string &name,
+                                             uint32_t nValues) {
+        Write(&type, sizeof(type));
+        WriteString(name);
+        Write(&nValues, sizeof(nValues));
+    }
+
+    // Points, vectors and normals are written component by component
+    static int Components(const Point2f &p, float c[3]) {
+        c[0] = p.x; c[1] = p.y;
+        return 2;
+    }
+    static int Components(const Vector2f &v, float c[3]) {
+        c[0] = v.x; c[1] = v.y;
+        return 2;
+    }
+    static int Components(const Point3f &p, float c[3]) {
+        c[0] = p.x; c[1] = p.y; c[2] = p.z;
+        return 3;
+    }
+    static int Components(const Vector3f &v, float c[3]) {
+        c[0] = v.x; c[1] = v.y; c[2] = v.z;
+        return 3;
+    }
+    static int Components(const Normal3f &n, float c[3]) {
+        c[0] = n.x; c[1] = n.y; c[2] = n.z;
+        return 3;
+    }
+
+    template <typename T>
+    void BinarySceneWriter::WriteTuples(
+            uint32_t type,
+            const std::vector<std::shared_ptr<ParamSetItem<T>>> &items) {
+        for (const auto &item : items) {
+            WriteParamHeader(type, item->name, item->nValues);
+            for (int i = 0; i < item->nValues; ++i) {
+                float c[3];
+                int n = Components(item->values[i], c);
+                Write(c, n * sizeof(float));
+            }
+        }
+    }
+
+    void BinarySceneWriter::WriteParamSet(const ParamSet &ps) {
+        uint32_t count = ps.floats.size() + ps.ints.size() + ps.bools.size() +
+                         ps.point2fs.size() + ps.vector2fs.size() +
+                         ps.point3fs.size() + ps.vector3fs.size() +
+                         ps.normals.size() + ps.spectra.size() +
+                         ps.strings.size() + ps.textures.size();
+        Write(&count, sizeof(count));
+        for (const auto &item : ps.floats) {
+            WriteParamHeader((uint32_t)BinaryParam::Float, item->name, item->nValues);
+            Write(item->values.get(), item->nValues * sizeof(float));
+        }
+        for (const auto &item : ps.ints) {
+            WriteParamHeader((uint32_t)BinaryParam::Int, item->name, item->nValues);
+            Write(item->values.get(), item->nValues * sizeof(int));
+        }
+        for (const auto &item : ps.bools) {
+            WriteParamHeader((uint32_t)BinaryParam::Bool, item->name, item->nValues);
+            for (int i = 0; i < item->nValues; ++i)
+                buffer.push_back(item->values[i] ? 1 : 0);
+            Pad(4);
+        }
+        WriteTuples((uint32_t)BinaryParam::Point2f, ps.point2fs);
+        WriteTuples((uint32_t)BinaryParam::Vector2f, ps.vector2fs);
+        WriteTuples((uint32_t)BinaryParam::Point3f, ps.point3fs);
+        WriteTuples((uint32_t)BinaryParam::Vector3f, ps.vector3fs);
+        WriteTuples((uint32_t)BinaryParam::Normal3f, ps.normals);
+        for (const auto &item : ps.spectra) {
+            WriteParamHeader((uint32_t)BinaryParam::RGB, item->name, item->nValues);
+            for (int i = 0; i < item->nValues; ++i) {
+                float rgb[3];
+                item->values[i].ToRGB(rgb);
+                Write(rgb, sizeof(rgb));
+            }
+        }
+        for (const auto &item : ps.strings) {
+            WriteParamHeader((uint32_t)BinaryParam::String, item->name, item->nValues);
+            for (int i = 0; i < item->nValues; ++i)
+                WriteString(item->values[i]);
+        }
+        for (const auto &item : ps.textures) {
+            WriteParamHeader((uint32_t)BinaryParam::Texture, item->name, 1);
+            WriteString(item->values[0]);
+        }
+    }
+
+    void BinarySceneWriter::BeginRecord(BinaryRecord type) {
+        EndBatch();
+        recordType = type;
+        buffer.clear();
+    }
+
+    void BinarySceneWriter::EndRecord() {
+        Pad(8);
+        BinaryRecordHeader header;
+        header.type = recordType;
+        header.reserved = 0;
+        header.size = buffer.size();
+        if (fwrite(&header, sizeof(header), 1, f) != 1 ||
+            (!buffer.empty() &&
+             fwrite(buffer.data(), buffer.size(), 1, f) != 1))
+            ok = false;
+    }
+
+    void BinarySceneWriter::Record(BinaryRecord type) {
+        BeginRecord(type);
+        EndRecord();
+    }
+
+    void BinarySceneWriter::Record(BinaryRecord type, const std::string &name) {
+        BeginRecord(type);
+        WriteString(name);
+        EndRecord();
+    }
+
+    void BinarySceneWriter::Record(BinaryRecord type, const std::string &name,
+                                   const ParamSet &params) {
+        BeginRecord(type);
+        WriteString(name);
+        WriteParamSet(params);
+        EndRecord();
+    }
+
+    // Scene files give matrices column by column
+    static void TransformToColumns(const pbrt::Transform &t, float tr[16]) {
+        const Matrix4x4 &m = t.GetMatrix();
+        for (int i = 0; i < 4; ++i)
+            for (int j = 0; j < 4; ++j) tr[4 * j + i] = m.m[i][j];
+    }
+
+    void BinarySceneWriter::SyncTransform() {
+        if (curTransform == writtenTransform) return;
+        float tr[16];
+        TransformToColumns(curTransform, tr);
+        BeginRecord(BinaryRecord::Transform);
+        Write(tr, sizeof(tr));
+        EndRecord();
+        writtenTransform = curTransform;
+    }
+
+    void BinarySceneWriter::SyncMaterial() {
+        if (material.id == writtenMaterialId) return;
+        if (material.named)
+            Record(BinaryRecord::NamedMaterial, material.name);
+        else
+            Record(BinaryRecord::Material, material.name, material.params);
+        writtenMaterialId = material.id;
+    }
+
+    void BinarySceneWriter::EndBatch() {
+        if (!inBatch) return;
+        inBatch = false;
+        static const uint8_t zeros[8] = {};
+        size_t padding = RoundUp(batchSize, 8) - batchSize;
+        if (padding > 0 && fwrite(zeros, padding, 1, f) != 1) ok = false;
+        batchSize += padding;
+        // Fill in the record size and the entry count
+        off_t end = ftello(f);
+        BinaryRecordHeader header;
+        header.type = BinaryRecord::ShapeBatch;
+        header.reserved = 0;
+        header.size = batchSize;
+        if (fseeko(f, batchStart, SEEK_SET) != 0 ||
+            fwrite(&header, sizeof(header), 1, f) != 1 ||
+            fseeko(f, batchCountOffset, SEEK_SET) != 0 ||
+            fwrite(&batchCount, sizeof(batchCount), 1, f) != 1 ||
+            fseeko(f, end, SEEK_SET) != 0)
+            ok = false;
+    }
+
+    void BinarySceneWriter::ApplyTransform(const pbrt::Transform &t) {
+        if (startTransformActive) curTransform = curTransform * t;
+    }
+
+    void BinarySceneWriter::Identity() {
+        if (startTransformActive) curTransform = pbrt::Transform();
+    }
+
+    void BinarySceneWriter::Translate(float dx, float dy, float dz) {
+        ApplyTransform(pbrt::Translate(Vector3f(dx, dy, dz)));
+    }
+
+    void BinarySceneWriter::Rotate(float angle, float ax, float ay, float az) {
+        ApplyTransform(pbrt::Rotate(angle, Vector3f(ax, ay, az)));
+    }
+
+    void BinarySceneWriter::Scale(float sx, float sy, float sz) {
+        ApplyTransform(pbrt::Scale(sx, sy, sz));
+    }
+
+    void BinarySceneWriter::LookAt(float ex, float ey, float ez, float lx,
+                                   float ly, float lz, float ux, float uy,
+                                   float uz) {
+        ApplyTransform(pbrt::LookAt(Point3f(ex, ey, ez), Point3f(lx, ly, lz),
+                                    Vector3f(ux, uy, uz)));
+    }
+
+    static pbrt::Transform ColumnsToTransform(const float tr[16]) {
+        return pbrt::Transform(Transpose(
+                Matrix4x4(tr[0], tr[1], tr[2], tr[3], tr[4], tr[5], tr[6], tr[7],
+                          tr[8], tr[9], tr[10], tr[11], tr[12], tr[13], tr[14],
+                          tr[15])));
+    }
+
+    void BinarySceneWriter::ConcatTransform(const float tr[16]) {
+        ApplyTransform(ColumnsToTransform(tr));
+    }
+
+    void BinarySceneWriter::Transform(const float tr[16]) {
+        if (startTransformActive) curTransform = ColumnsToTransform(tr);
+    }
+
+    void BinarySceneWriter::CoordinateSystem(const std::string &name) {
+        namedCoordinateSystems[name] = curTransform;
+    }
+
+    void BinarySceneWriter::CoordSysTransform(const std::string &name) {
+        auto iter = namedCoordinateSystems.find(name);
+        if (iter != namedCoordinateSystems.end())
+            curTransform = iter->second;
+        else
+            std::cerr << "Couldn't find named coordinate system \"" << name
+                      << "\"" << std::endl;
+    }
+
+    // Only the start transform is used by the renderer, so only it is kept
+    void BinarySceneWriter::ActiveTransformAll() { startTransformActive = true; }
+
+    void BinarySceneWriter::ActiveTransformEndTime() {
+        startTransformActive = false;
+    }
+
+    void BinarySceneWriter::ActiveTransformStartTime() {
+        startTransformActive = true;
+    }
+
+    void BinarySceneWriter::PixelFilter(const std::string &name,
+                                        const ParamSet &params) {
+        Record(BinaryRecord::PixelFilter, name, params);
+    }
+
+    void BinarySceneWriter::Film(const std::string &type,
+                                 const ParamSet &params) {
+        Record(BinaryRecord::Film, type, params);
+    }
+
+    void BinarySceneWriter::Sampler(const std::string &name,
+                                    const ParamSet &params) {
+        Record(BinaryRecord::Sampler, name, params);
+    }
+
+    void BinarySceneWriter::Integrator(const std::string &name,
+                                       const ParamSet &params) {
+        Record(BinaryRecord::Integrator, name, params);
+    }
+
+    void BinarySceneWriter::Camera(const std::string &name,
+                                   const ParamSet &params) {
+        SyncTransform();
+        Record(BinaryRecord::Camera, name, params);
+        namedCoordinateSystems["camera"] = Inverse(curTransform);
+    }
+
+    void BinarySceneWriter::WorldBegin() {
+        Record(BinaryRecord::WorldBegin);
+        curTransform = writtenTransform = pbrt::Transform();
+        startTransformActive = true;
+        namedCoordinateSystems["world"] = curTransform;
+    }
+
+    void BinarySceneWriter::AttributeBegin() {
+        pushedMaterials.push_back(material);
+        pushedTransforms.push_back(
+                std::make_pair(curTransform, startTransformActive));
+    }
+
+    void BinarySceneWriter::AttributeEnd() {
+        if (pushedMaterials.empty()) {
+            std::cerr << "Unmatched AttributeEnd encountered. Ignoring it."
+                      << std::endl;
+            return;
+        }
+        material = std::move(pushedMaterials.back());
+        pushedMaterials.pop_back();
+        curTransform = pushedTransforms.back().first;
+        startTransformActive = pushedTransforms.back().second;
+        pushedTransforms.pop_back();
+    }
+
+    void BinarySceneWriter::TransformBegin() {
+        pushedTransforms.push_back(
+                std::make_pair(curTransform, startTransformActive));
+    }
+
+    void BinarySceneWriter::TransformEnd() {
+        // Transform blocks may not close attribute blocks
+        if (pushedTransforms.size() <= pushedMaterials.size()) {
+            std::cerr << "Unmatched TransformEnd encountered. Ignoring it."
+                      << std::endl;
+            return;
+        }
+        curTransform = pushedTransforms.back().first;
+        startTransformActive = pushedTransforms.back().second;
+        pushedTransforms.pop_back();
+    }
+
+    void BinarySceneWriter::Material(const std::string &name,
+                                     const ParamSet &params) {
+        material.id = nextMaterialId++;
+        material.named = false;
+        material.name = name;
+        material.params = params;
+    }
+
+    void BinarySceneWriter::MakeNamedMaterial(const std::string &name,
+                                              const ParamSet &params) {
+        Record(BinaryRecord::MakeNamedMaterial, name, params);
+    }
+
+    void BinarySceneWriter::NamedMaterial(const std::string &name) {
+        material.id = nextMaterialId++;
+        material.named = true;
+        material.name = name;
+        material.params.Clear();
+    }
+
+    void BinarySceneWriter::LightSource(const std::string &name,
+                                        const ParamSet &params) {
+        SyncTransform();
+        Record(BinaryRecord::LightSource, name, params);
+    }
+
+    bool BinarySceneWriter::BatchValueNames(const ParamSet &ps,
+                                            std::vector<std::string> *names) {
+        if (!ps.ints.empty() || !ps.bools.empty() || !ps.point2fs.empty() ||
+            !ps.vector2fs.empty() || !ps.point3fs.empty() ||
+            !ps.vector3fs.empty() || !ps.normals.empty() ||
+            !ps.spectra.empty() || !ps.strings.empty() ||
+            !ps.textures.empty() || ps.floats.size() > MaxBatchValues)
+            return false;
+        for (const auto &item : ps.floats) {
+            if (item->nValues != 1) return false;
+            names->push_back(item->name);
+        }
+        return true;
+    }
+
+    void BinarySceneWriter::Shape(const std::string &name,
+                                  const ParamSet &params) {
+        std::vector<std::string> valueNames;
+        if (!BatchValueNames(params, &valueNames)) {
+            SyncTransform();
+            SyncMaterial();
+            Record(BinaryRecord::Shape, name, params);
+            return;
+        }
+        if (!inBatch || batchShape != name || batchValueNames != valueNames ||
+            batchMaterialId != material.id) {
+            SyncMaterial();
+            // Every parameter of the batch's shapes is one of its values
+            BeginRecord(BinaryRecord::ShapeBatch);
+            WriteString(name);
+            WriteParamSet(ParamSet());
+            uint32_t nValueNames = valueNames.size();
+            Write(&nValueNames, sizeof(nValueNames));
+            for (const std::string &valueName : valueNames)
+                WriteString(valueName);
+            Pad(8);
+            uint64_t count = 0;
+            Write(&count, sizeof(count));
+
+            BinaryRecordHeader header;
+            header.type = BinaryRecord::ShapeBatch;
+            header.reserved = 0;
+            header.size = 0;
+            batchStart = ftello(f);
+            batchCountOffset = batchStart + sizeof(header) + buffer.size() -
+                               sizeof(count);
+            if (fwrite(&header, sizeof(header), 1, f) != 1 ||
+                fwrite(buffer.data(), buffer.size(), 1, f) != 1)
+                ok = false;
+            inBatch = true;
+            batchShape = name;
+            batchValueNames = std::move(valueNames);
+            batchMaterialId = material.id;
+            batchSize = buffer.size();
+            batchCount = 0;
+        }
+        float entry[16 + MaxBatchValues];
+        TransformToColumns(curTransform, entry);
+        for (size_t i = 0; i < batchValueNames.size(); ++i)
+            entry[16 + i] = params.FindOneFloat(batchValueNames[i], 0);
+        size_t entrySize = (16 + batchValueNames.size()) * sizeof(float);
+        if (fwrite(entry, entrySize, 1, f) != 1) ok = false;
+        batchSize += entrySize;
+        ++batchCount;
+    }
+
+    void BinarySceneWriter::WorldEnd() {
+        Record(BinaryRecord::WorldEnd);
+        // The renderer starts over after _WorldEnd_
+        material = MaterialState();
+        writtenMaterialId = 0;
+        curTransform = writtenTransform = pbrt::Transform();
+        startTransformActive = true;
+        pushedTransforms.clear();
+        pushedMaterials.clear();
+        namedCoordinateSystems.clear();
+    }
+
+    bool ConvertToBinaryScene(const std::string &textFilename,
+                              const std::string &binaryFilename) {
+        std::unique_ptr<BinarySceneWriter> writer =
+                BinarySceneWriter::Create(binaryFilename);
+        if (!writer) return false;
+        bool parsed = ParseFile(writer.get(), textFilename);
+        if (!writer->Close()) {
+            std::cerr << binaryFilename << ": error writing binary scene"
+                      << std::endl;
+            return false;
+        }
+        return parsed;
+    }
+}
@@ -0,0 +1,200 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#ifndef PBRT_WHITTED_BINARYSCENE_H
+#define PBRT_WHITTED_BINARYSCENE_H
+
+#include "main.h"
+#include "parser.h"
+#include "paramset.h"
+#include "transform.h"
+#include "memory.h"
+#include <cstdio>
+#include <sys/types.h>
+#include <map>
+
+namespace pbrt {
+
+    // A binary scene is a header followed by a sequence of records, one per
+    // scene statement. Each record starts with a _BinaryRecordHeader_ and
+    // its payload is padded to a multiple of eight bytes; strings are a
+    // 32-bit length and the characters padded to four bytes, and numbers are
+    // stored in the machine's byte order, which the header records.
+    enum class BinaryRecord : uint32_t {
+        Identity, Translate, Rotate, Scale, LookAt, ConcatTransform, Transform,
+        CoordinateSystem, CoordSysTransform, ActiveTransformAll,
+        ActiveTransformEndTime, ActiveTransformStartTime, PixelFilter, Film,
+        Sampler, Integrator, Camera, WorldBegin, AttributeBegin, AttributeEnd,
+        TransformBegin, TransformEnd, Material, MakeNamedMaterial,
+        NamedMaterial, LightSource, Shape, ShapeBatch, WorldEnd
+    };
+
+    struct BinaryRecordHeader {
+        BinaryRecord type;
+        uint32_t reserved;
+        uint64_t size;
+    };
+
+    // Many shapes of one type that differ only in their object-to-world
+    // transform and in a few single-valued float parameters. Entries are
+    // stored back to back: 16 floats of transform, in the order of a scene
+    // file's _Transform_ statement, followed by one value per name in
+    // _valueNames_. A batch is replayed with one _ParserTarget::Shapes()_
+    // call, so the API makes its shapes in parallel; it leaves the current
+    // transform unchanged.
+    struct ShapeBatch {
+        std::string name;
+        ParamSet params;
+        std::vector<std::string> valueNames;
+        size_t count = 0;
+        const float *entries = nullptr;
+
+        int Stride() const { return 16 + (int)valueNames.size(); }
+        const float *Transform(size_t i) const { return entries + i * Stride(); }
+        const float *Values(size_t i) const { return Transform(i) + 16; }
+    };
+
+    // A binary scene file mapped into memory. Records are decoded as they
+    // are replayed; the bulk arrays of shape batches are used in place.
+    class BinaryScene {
+    public:
+        static bool IsBinaryScene(const std::string &filename);
+        static std::unique_ptr<BinaryScene> Open(const std::string &filename);
+
+        // Issues the scene's statements on _target_; returns _false_ if the
+        // file is malformed
+        bool Replay(ParserTarget *target) const;
+        // The shape batches of the file, pointing into the mapping
+        std::vector<ShapeBatch> ShapeBatches() const;
+
+    private:
+        BinaryScene(const std::string &filename, std::unique_ptr<MappedFile> file)
+                : filename(filename), file(std::move(file)) {}
+        bool Error(size_t offset, const char *message) const;
+
+        const std::string filename;
+        std::unique_ptr<MappedFile> file;
+    };
+
+    // A _ParserTarget_ that writes a binary scene. Transforms and materials
+    // are tracked here and written only when a light, camera or shape needs
+    // them, so runs of shapes that differ only in transform and
+    // single-valued float parameters become one _ShapeBatch_ however the
+    // text nests them in attribute blocks.
+    class BinarySceneWriter : public ParserTarget {
+    public:
+        static std::unique_ptr<BinarySceneWriter> Create(
+                const std::string &filename);
+        ~BinarySceneWriter();
+        // Ends the last batch and closes the file; returns _false_ if any
+        // write failed
+        bool Close();
+
+        void Identity() override;
+        void Translate(float dx, float dy, float dz) override;
+        void Rotate(float angle, float ax, float ay, float az) override;
+        void Scale(float sx, float sy, float sz) override;
+        void LookAt(float ex, float ey, float ez, float lx, float ly, float lz,
+                    float ux, float uy, float uz) override;
+        void ConcatTransform(const float transform[16]) override;
+        void Transform(const float transform[16]) override;
+        void CoordinateSystem(const std::string &name) override;
+        void CoordSysTransform(const std::string &name) override;
+        void ActiveTransformAll() override;
+        void ActiveTransformEndTime() override;
+        void ActiveTransformStartTime() override;
+        void PixelFilter(const std::string &name,
+                         const ParamSet &params) override;
+        void Film(const std::string &type, const ParamSet &params) override;
+        void Sampler(const std::string &name, const ParamSet &params) override;
+        void Integrator(const std::string &name,
+                        const ParamSet &params) override;
+        void Camera(const std::string &name, const ParamSet &params) override;
+        void WorldBegin() override;
+        void AttributeBegin() override;
+        void AttributeEnd() override;
+        void TransformBegin() override;
+        void TransformEnd() override;
+        void Material(const std::string &name, const ParamSet &params) override;
+        void MakeNamedMaterial(const std::string &name,
+                               const ParamSet &params) override;
+        void NamedMaterial(const std::string &name) override;
+        void LightSource(const std::string &name,
+                         const ParamSet &params) override;
+        void Shape(const std::string &name, const ParamSet &params) override;
+        void WorldEnd() override;
+
+    private:
+        // The material of the graphics state: either _Material_ with its
+        // parameters or a reference to a named material. _id_ changes
+        // whenever the material does.
+        struct MaterialState {
+            int64_t id = 0;
+            bool named = false;
+            std::string name = "matte";
+            ParamSet params;
+        };
+
+        explicit BinarySceneWriter(FILE *f) : f(f) {}
+        // Records are assembled in _buffer_ and written whole
+        void BeginRecord(BinaryRecord type);
+        void EndRecord();
+        void Write(const void *data, size_t size);
+        void WriteString(const std::string &str);
+        void WriteParamSet(const ParamSet &params);
+        void WriteParamHeader(uint32_t type, const std::string &name,
+                              uint32_t nValues);
+        template <typename T>
+        void WriteTuples(
+                uint32_t type,
+                const std::vector<std::shared_ptr<ParamSetItem<T>>> &items);
+        void Pad(size_t alignment);
+        void Record(BinaryRecord type);
+        void Record(BinaryRecord type, const std::string &name);
+        void Record(BinaryRecord type, const std::string &name,
+                    const ParamSet &params);
+        void ApplyTransform(const pbrt::Transform &t);
+        // Writes the current transform and material if the reader's differ
+        void SyncTransform();
+        void SyncMaterial();
+        void EndBatch();
+        // Returns the parameter names if _params_ holds only single floats
+        static bool BatchValueNames(const ParamSet &params,
+                                    std::vector<std::string> *names);
+
+        static const size_t MaxBatchValues = 64;
+
+        FILE *f;
+        bool ok = true;
+        BinaryRecord recordType;
+        std::vector<uint8_t> buffer;
+
+        // Graphics state as the text describes it
+        pbrt::Transform curTransform;
+        bool startTransformActive = true;
+        std::vector<std::pair<pbrt::Transform, bool>> pushedTransforms;
+        std::vector<MaterialState> pushedMaterials;
+        std::map<std::string, pbrt::Transform> namedCoordinateSystems;
+        MaterialState material;
+        int64_t nextMaterialId = 1;
+
+        // Graphics state as a reader of the file has it
+        pbrt::Transform writtenTransform;
+        int64_t writtenMaterialId = 0;
+
+        // The batch being written, if any. Its entries go straight to the
+        // file; the record size and entry count are filled in at its end.
+        bool inBatch = false;
+        std::string batchShape;
+        std::vector<std::string> batchValueNames;
+        int64_t batchMaterialId = 0;
+        off_t batchStart = 0, batchCountOffset = 0;
+        uint64_t batchSize = 0, batchCount = 0;
+    };
+
+    // Converts a text scene description to a binary scene
+    bool ConvertToBinaryScene(const std::string &textFilename,
+                              const std::string &binaryFilename);
+}
+#endif //PBRT_WHITTED_BINARYSCENE_H
@@ -0,0 +1,1049 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+// Generated table; do not edit. Four 64x64 blue-noise tiles made with
+// Ulichney's void-and-cluster method (toroidal Gaussian energy with
+// sigma 1.9, 10% initial density, seeds 0-3). Each entry is the pixel's
+// rank, so every tile holds 0..4095 exactly once.
+
+#include "bluenoise.h"
+
+namespace pbrt {
+
+    const uint16_t BlueNoiseTextures[NumBlueNoiseTextures][BlueNoiseResolution]
+                                    [BlueNoiseResolution] = {
+            {
+                    {3706, 59, 1448, 2551, 3488, 814, 1918, 314, 2630, 3342, 180, 2339, 837, 3451, 2111, 2684,
+                     3892, 590, 1457, 3537, 409, 1594, 3045, 3930, 1763, 2862, 33, 1613, 1348, 524, 1108, 2990,
+                     307, 2670, 3285, 1115, 2926, 3677, 2027, 430, 3796, 2412, 1951, 1252, 556, 2664, 887, 1619,
+                     2456, 3195, 3773, 1593, 404, 3568, 1421, 3963, 83, 2180, 1465, 1972, 2732, 3876, 3314, 909},
+                    {3167, 2147, 3938, 974, 3017, 1604, 2797, 3879, 950, 2918, 1444, 523, 2539, 1228, 385, 991,
+                     1895, 2547, 203, 3980, 2185, 1189, 3431, 2341, 986, 3705, 3279, 3842, 2298, 2553, 3205, 2096,
+                     953, 3903, 491, 2414, 671, 1814, 3359, 1378, 935, 128, 3531, 3093, 3890, 2078, 212, 3992,
+                     2161, 539, 3455, 1937, 2705, 2441, 1101, 3172, 2646, 3791, 873, 3657, 213, 1349, 1133, 1883},
+                    {2853, 658, 1250, 1808, 483, 2377, 1146, 2241, 608, 2105, 3629, 3927, 3207, 1677, 2967, 3731,
+                     1565, 3348, 1277, 2855, 819, 2711, 548, 155, 1427, 2103, 638, 1898, 876, 3558, 393, 3748,
+                     1328, 2222, 1640, 3569, 1282, 98, 2752, 2270, 3964, 2915, 1742, 364, 1006, 3659, 1813, 3033,
+                     1109, 2804, 816, 1258, 3882, 695, 2116, 308, 1831, 654, 2509, 3188, 1753, 2355, 2992, 293},
+                    {2446, 3616, 2728, 3224, 3757, 3390, 89, 1385, 3503, 1756, 279, 1084, 1957, 2268, 226, 3505,
+                     502, 2077, 3110, 1021, 1800, 3242, 1984, 3640, 2948, 2508, 346, 1193, 2832, 1546, 112, 1750,
+                     2771, 3438, 246, 2599, 4047, 3138, 782, 1598, 531, 1157, 2165, 2587, 1542, 2397, 679, 3389,
+                     1477, 102, 2353, 3080, 181, 1505, 3675, 2841, 1218, 3428, 1610, 1041, 545, 4014, 3510, 803},
+                    {1419, 352, 2066, 210, 742, 1954, 2934, 4020, 2583, 800, 3087, 2699, 690, 3813, 1393, 2772,
+                     772, 2328, 57, 3756, 2452, 302, 4093, 1635, 766, 3159, 3959, 3398, 2196, 3099, 4068, 2012,
+                     625, 2976, 864, 1891, 1051, 2088, 3504, 2470, 3713, 3185, 710, 3456, 36, 3219, 1270, 421,
+                     2614, 3560, 4042, 2071, 1774, 3355, 889, 2291, 4066, 141, 2964, 2229, 2779, 35, 2007, 1642},
+                    {3335, 1090, 4067, 1684, 2607, 1029, 1528, 444, 3258, 1214, 2358, 1560, 43, 3276, 922, 2490,
+                     1178, 4022, 1695, 3468, 668, 1323, 2265, 1043, 2652, 1295, 222, 1798, 504, 1070, 799, 2514,
+                     1203, 3265, 1486, 2346, 3032, 206, 1415, 372, 1874, 2803, 1352, 4095, 1983, 2720, 3845, 2255,
+                     1920, 1626, 947, 596, 2888, 2579, 476, 3108, 1949, 1400, 417, 3807, 3253, 1247, 2644, 3750},
+                    {495, 3011, 2347, 1307, 3142, 3848, 2458, 2051, 176, 1869, 3546, 3991, 2902, 2126, 1794, 3598,
+                     3052, 1946, 413, 2933, 1534, 2777, 3576, 94, 1909, 3495, 2402, 1494, 2710, 3660, 2289, 3478,
+                     436, 3943, 72, 3687, 588, 3856, 2700, 3275, 1034, 251, 2340, 890, 508, 2965, 1066, 791,
+                     3696, 316, 3156, 1173, 3824, 250, 1680, 1064, 2480, 3597, 836, 1856, 1507, 621, 962, 2192},
+                    {1860, 2696, 866, 3570, 18, 586, 3426, 915, 3806, 2813, 490, 1016, 1319, 406, 3865, 170,
+                     602, 1414, 2597, 973, 3283, 2073, 456, 3077, 3901, 569, 897, 3772, 2959, 1, 1379, 1646,
+                     2668, 1826, 2132, 2820, 1259, 1729, 854, 2039, 3913, 1654, 3072, 3739, 1508, 1776, 189, 3315,
+                     2757, 1384, 2450, 3523, 2239, 1429, 3441, 3916, 676, 2735, 2092, 3364, 2523, 3931, 3084, 151},
+                    {3832, 682, 1572, 2133, 2849, 1765, 2275, 1365, 3114, 1624, 2191, 669, 3381, 2411, 1584, 2680,
+                     3423, 2168, 3798, 208, 3946, 808, 2493, 1152, 2859, 1655, 2083, 3281, 703, 1924, 3197, 275,
+                     3805, 1062, 770, 3385, 2505, 3599, 2303, 458, 3421, 2569, 109, 2179, 3544, 2527, 1326, 3962,
+                     2137, 2983, 25, 1881, 780, 2778, 2060, 100, 1296, 3150, 325, 1126, 214, 1736, 2370, 3476},
+                    {1212, 261, 3370, 3984, 328, 1185, 3700, 722, 2500, 263, 3641, 2604, 3036, 1969, 861, 1131,
+                     3177, 751, 2383, 1253, 1889, 1681, 3699, 1398, 3350, 2319, 165, 2566, 1217, 4021, 937, 2420,
+                     2894, 3120, 488, 1580, 267, 1117, 2974, 1500, 731, 1261, 2846, 1107, 628, 3123, 1962, 437,
+                     697, 1710, 3895, 520, 3289, 989, 3006, 3703, 1783, 2306, 3999, 2943, 3563, 792, 2816, 1451},
+                    {3169, 2468, 2936, 987, 1941, 2661, 2997, 119, 4089, 1143, 1828, 1422, 3771, 95, 4028, 2837,
+                     1755, 288, 3551, 2734, 3126, 26, 2206, 698, 303, 1007, 3849, 1466, 434, 2187, 3552, 593,
+                     1995, 1291, 2250, 3966, 3223, 1887, 28, 4045, 3152, 3639, 1905, 353, 4012, 2316, 945, 3443,
+                     2598, 1019, 1254, 3586, 2617, 1602, 356, 2421, 567, 905, 1625, 1353, 2160, 466, 1035, 2004},
+                    {3656, 1644, 2211, 1373, 563, 3254, 1491, 2030, 3392, 2776, 810, 3251, 341, 1240, 2258, 493,
+                     3686, 2037, 1530, 560, 1050, 3457, 2905, 3971, 2679, 1819, 3485, 2806, 3085, 1730, 2629, 1532,
+                     3407, 99, 3654, 2574, 919, 2098, 2762, 573, 2407, 2146, 869, 1692, 3328, 2695, 81, 1570,
+                     3782, 3176, 2401, 2032, 207, 4075, 1192, 3250, 2675, 3410, 10, 3736, 2594, 3260, 4058, 78},
+                    {2687, 825, 403, 3594, 3928, 2321, 883, 423, 1657, 2366, 525, 2095, 2884, 1688, 3356, 2560,
+                     1376, 902, 2947, 4071, 2513, 370, 1978, 1496, 3200, 542, 2028, 788, 3746, 1081, 184, 3925,
+                     842, 1809, 2795, 1394, 347, 3814, 3526, 1754, 1371, 158, 3819, 2962, 1440, 1223, 3661, 2882,
+                     2195, 284, 1449, 2921, 657, 1807, 2169, 1439, 3835, 1938, 2890, 686, 1861, 1517, 2337, 619},
+                    {3888, 1839, 3094, 2540, 51, 1781, 3501, 3826, 3121, 1013, 3603, 3936, 2451, 970, 712, 3083,
+                     3871, 115, 3259, 1780, 2253, 1310, 833, 3633, 1147, 2426, 63, 1320, 2344, 349, 2969, 3243,
+                     2404, 1122, 613, 3062, 1636, 752, 1206, 2632, 985, 3405, 2499, 528, 2246, 254, 1829, 830,
+                     580, 1899, 3957, 882, 3419, 3694, 3097, 776, 424, 1047, 2271, 1236, 333, 3483, 3009, 1162},
+                    {2129, 1322, 3403, 1083, 707, 2815, 1159, 2586, 215, 1332, 1900, 9, 1483, 3524, 1879, 244,
+                     2139, 2419, 1135, 688, 3752, 3312, 144, 2606, 1709, 3002, 4062, 3321, 3612, 1894, 1417, 2091,
+                     440, 3477, 4083, 2176, 2469, 3324, 2904, 435, 3941, 3065, 1989, 741, 3593, 3161, 3914, 2512,
+                     1179, 3339, 2673, 52, 2262, 1091, 2783, 156, 2534, 3580, 3191, 3948, 2756, 914, 1701, 187},
+                    {2833, 292, 3761, 2002, 3024, 1434, 2109, 587, 2245, 2968, 2682, 3196, 611, 3754, 2731, 1321,
+                     3411, 1632, 2693, 427, 2817, 1541, 2118, 3893, 447, 941, 2154, 1599, 662, 2730, 954, 3785,
+                     2854, 1274, 1926, 281, 3759, 79, 1964, 2287, 1566, 270, 1164, 2789, 1637, 1031, 2049, 432,
+                     3026, 3733, 1673, 1357, 2502, 494, 1579, 4003, 2093, 1723, 1475, 131, 2042, 2481, 3797, 3344},
+                    {2278, 946, 1562, 2433, 384, 4052, 3310, 3655, 1547, 3981, 749, 1198, 2201, 365, 3000, 1052,
+                     541, 3592, 3935, 1939, 3079, 965, 3518, 644, 3157, 2763, 273, 1190, 2529, 3190, 518, 1622,
+                     22, 2593, 783, 3151, 1059, 1441, 3500, 660, 3721, 1836, 3264, 3993, 2, 2601, 3393, 1473,
+                     2322, 336, 980, 3237, 3595, 1956, 3005, 1287, 3363, 581, 3057, 790, 3643, 496, 1395, 702},
+                    {4010, 2628, 576, 3573, 1714, 846, 113, 1846, 961, 334, 3415, 1617, 2571, 1789, 4054, 2350,
+                     2021, 862, 68, 1227, 2320, 259, 1749, 2465, 1372, 1912, 3442, 3877, 157, 2240, 4011, 3353,
+                     2325, 3674, 1516, 1772, 2765, 2369, 900, 2985, 1327, 2689, 853, 2330, 1362, 639, 2898, 1769,
+                     4060, 746, 2738, 2131, 211, 3887, 841, 2372, 300, 1000, 2651, 2294, 1153, 2919, 1961, 3162},
+                    {1796, 69, 2931, 3208, 2224, 1283, 2518, 3163, 2872, 2390, 1963, 3858, 920, 3255, 172, 1543,
+                     2899, 3186, 2585, 1446, 3338, 4043, 2910, 1078, 3811, 2307, 806, 2944, 1405, 1805, 734, 1968,
+                     1003, 2909, 571, 3864, 3293, 459, 3956, 2074, 146, 3454, 489, 2114, 3745, 3534, 918, 129,
+                     1243, 3436, 1865, 2913, 605, 1182, 1782, 3480, 2856, 3763, 1834, 4085, 3240, 1634, 380, 1048},
+                    {3535, 1452, 1175, 3787, 242, 2742, 3910, 544, 1144, 3625, 205, 3021, 513, 3664, 1234, 744,
+                     3808, 306, 1786, 3645, 554, 784, 2019, 11, 3249, 344, 1668, 3582, 1027, 2784, 3106, 1244,
+                     323, 3458, 2034, 124, 1210, 2558, 1618, 3635, 1123, 2448, 1687, 3022, 313, 1915, 2476, 3107,
+                     2213, 3682, 291, 1412, 3781, 3199, 2578, 123, 1538, 2145, 419, 1351, 29, 3466, 2698, 2400},
+                    {3852, 793, 2120, 1910, 1009, 3469, 1621, 2056, 1374, 2701, 718, 2125, 1428, 2453, 2782, 2219,
+                     3467, 2477, 956, 2163, 2790, 1614, 2643, 3543, 1251, 612, 2612, 2048, 438, 3697, 106, 3933,
+                     2475, 1403, 3061, 2244, 828, 1863, 326, 2847, 632, 3211, 4034, 1004, 1523, 2810, 3906, 498,
+                     1567, 2616, 1046, 2431, 1648, 2217, 743, 3954, 1139, 3299, 672, 2520, 929, 3728, 2170, 256},
+                    {3001, 3291, 2501, 2860, 684, 411, 2338, 3732, 50, 1724, 3369, 1111, 3533, 1897, 32, 1707,
+                     589, 1340, 3012, 3974, 1161, 412, 3743, 2200, 1511, 3040, 3846, 3334, 2408, 1539, 2172, 2656,
+                     1731, 706, 3622, 2688, 4063, 3404, 3118, 2226, 1426, 1940, 2615, 216, 3327, 714, 1119, 2082,
+                     3241, 687, 4000, 3365, 20, 3059, 465, 1987, 2712, 3615, 3096, 1914, 2869, 1495, 709, 1265},
+                    {1652, 521, 130, 4038, 1551, 3325, 2966, 805, 3128, 4082, 2273, 2883, 296, 3977, 3143, 1055,
+                     3869, 1990, 366, 97, 3440, 1896, 3119, 892, 2496, 1822, 237, 852, 1292, 649, 3194, 930,
+                     3816, 463, 1085, 1588, 236, 1343, 993, 3853, 37, 812, 3794, 1269, 2272, 1792, 3578, 1355,
+                     375, 2952, 1965, 893, 1302, 2799, 3548, 1453, 860, 191, 1671, 2326, 3881, 467, 3377, 1997},
+                    {2748, 968, 3550, 1823, 1305, 2580, 1079, 1927, 311, 2554, 911, 553, 1600, 2590, 838, 2857,
+                     3343, 1556, 2655, 3233, 2417, 1377, 646, 137, 3960, 1072, 2794, 1952, 4001, 2907, 3496, 294,
+                     2097, 3332, 2880, 1943, 2391, 599, 2723, 1747, 3549, 2376, 2914, 464, 3688, 2666, 70, 2409,
+                     3463, 1721, 225, 2308, 3649, 1827, 1032, 2467, 2189, 4031, 1246, 290, 1071, 3155, 2562, 3986},
+                    {1168, 2375, 2143, 3135, 342, 3847, 2210, 3529, 1506, 1294, 1876, 3204, 3789, 1268, 2101, 428,
+                     2379, 3650, 775, 1764, 972, 3897, 2264, 2866, 3305, 507, 3555, 2290, 40, 1643, 1158, 1844,
+                     2440, 1460, 56, 3768, 3521, 3042, 2086, 383, 3247, 1089, 1651, 2119, 3122, 916, 4094, 2851,
+                     785, 3854, 2697, 3129, 600, 3915, 354, 3418, 3016, 592, 2770, 3662, 2094, 826, 1816, 173},
+                    {3758, 674, 1490, 3704, 847, 2792, 152, 631, 3924, 2923, 3624, 93, 2342, 685, 3575, 1443,
+                     145, 1181, 2182, 462, 2954, 3602, 1591, 2029, 1197, 1718, 1413, 3147, 2537, 3669, 574, 2764,
+                     4037, 3173, 745, 2591, 1219, 879, 3998, 1512, 2544, 675, 3453, 177, 1456, 598, 1928, 1586,
+                     2198, 1063, 1484, 1207, 2059, 2568, 1595, 154, 1771, 3271, 1411, 2455, 3444, 1553, 394, 3053},
+                    {3340, 2826, 0, 2482, 1235, 2006, 1656, 3294, 2368, 416, 2065, 1025, 1674, 2733, 3266, 1842,
+                     3967, 3054, 3769, 2743, 1264, 321, 2563, 209, 3722, 2642, 747, 361, 994, 2072, 3069, 163,
+                     1335, 1002, 2203, 1658, 484, 1870, 138, 2812, 3714, 1314, 1976, 3955, 2427, 3366, 1231, 258,
+                     3217, 515, 3718, 103, 3296, 804, 2831, 3815, 1145, 2010, 735, 55, 2929, 3830, 2276, 1359},
+                    {1974, 1705, 3499, 555, 2979, 3430, 966, 2678, 1201, 764, 2618, 3435, 4035, 233, 2972, 904,
+                     2521, 623, 1628, 2013, 3288, 721, 3460, 934, 3046, 4092, 2188, 3380, 3795, 1504, 807, 2331,
+                     3474, 398, 2920, 3907, 3395, 2315, 3193, 978, 2209, 283, 3034, 2685, 1012, 2973, 3747, 2596,
+                     3585, 2939, 2454, 1758, 4050, 2232, 1363, 527, 2345, 2654, 3929, 995, 1893, 562, 2637, 885},
+                    {332, 1068, 3867, 2293, 1838, 4036, 387, 3148, 3709, 1791, 3028, 1366, 530, 1993, 1151, 2238,
+                     357, 3484, 1042, 66, 4025, 1830, 1468, 2394, 572, 1853, 88, 1249, 2805, 1916, 3952, 2610,
+                     1735, 3680, 1998, 220, 2676, 1290, 3630, 551, 1802, 3874, 845, 511, 1760, 14, 2064, 719,
+                     1653, 924, 1986, 402, 2996, 1014, 3464, 3668, 3091, 368, 3367, 1679, 3588, 1195, 3238, 4005},
+                    {2216, 2706, 3165, 229, 730, 1381, 2087, 74, 1521, 2251, 266, 3774, 2418, 1536, 3399, 3844,
+                     1725, 2713, 1418, 2436, 3086, 2208, 2876, 1127, 3623, 1545, 2955, 2442, 485, 3192, 274, 1136,
+                     3286, 603, 1513, 1094, 3113, 736, 1487, 2900, 2462, 3256, 1603, 3516, 2282, 1401, 4009, 343,
+                     2357, 1342, 3508, 2648, 680, 1573, 27, 1854, 848, 1502, 2184, 230, 2836, 2422, 105, 1535},
+                    {2951, 818, 1279, 1607, 2605, 3638, 2865, 2491, 3961, 1103, 648, 3214, 870, 2839, 15, 715,
+                     3180, 2075, 3663, 537, 858, 179, 3766, 399, 3212, 2102, 894, 3536, 1702, 705, 1391, 2234,
+                     2818, 877, 2416, 3744, 2135, 62, 4078, 1971, 1102, 121, 1262, 3802, 2791, 3175, 1120, 3341,
+                     2840, 3909, 143, 1169, 3776, 3244, 2122, 2530, 2912, 1125, 4081, 3168, 1347, 2057, 693, 3651},
+                    {3409, 470, 2121, 3770, 3330, 1036, 512, 831, 1890, 3374, 2718, 2110, 1703, 3637, 2573, 1336,
+                     2942, 245, 1184, 3917, 3384, 2603, 1734, 1339, 2715, 271, 3820, 1092, 2657, 3894, 3613, 8,
+                     1958, 4018, 3018, 337, 2556, 1666, 3432, 420, 3601, 2649, 2153, 689, 389, 2506, 1868, 821,
+                     2167, 557, 3103, 1903, 2314, 2767, 1280, 322, 3724, 652, 2392, 479, 881, 3875, 2546, 1726},
+                    {1383, 4064, 2429, 49, 2999, 1716, 2354, 3547, 3076, 1315, 142, 3891, 1044, 441, 1934, 4040,
+                     939, 2364, 1848, 2830, 1554, 1001, 2024, 3983, 795, 2304, 3316, 136, 2017, 2371, 2940, 1564,
+                     3371, 481, 1804, 1364, 3239, 969, 2780, 2301, 815, 3078, 1779, 3372, 971, 1581, 110, 3589,
+                     1461, 2555, 1704, 3379, 868, 200, 3900, 1686, 3280, 1992, 2704, 1812, 3470, 3030, 1093, 169},
+                    {2808, 1835, 955, 655, 1991, 1215, 278, 1559, 3755, 407, 2542, 1474, 2984, 3482, 2225, 584,
+                     1620, 3584, 3225, 330, 2186, 636, 3060, 3429, 497, 1871, 1583, 3037, 1299, 348, 817, 1018,
+                     2627, 1200, 3559, 760, 3911, 1877, 582, 1329, 3883, 1476, 268, 4041, 2911, 3742, 2041, 3043,
+                     3833, 255, 1057, 4039, 1518, 624, 3020, 988, 3561, 1424, 80, 3778, 1526, 319, 1944, 3257},
+                    {3707, 1188, 2683, 3459, 3825, 3226, 2746, 2193, 635, 2896, 1994, 771, 2373, 238, 1171, 3345,
+                     2669, 87, 779, 1311, 2522, 3692, 24, 2814, 2425, 1204, 3918, 650, 3479, 1790, 3149, 3735,
+                     2123, 174, 2323, 2727, 277, 2207, 2977, 3284, 153, 2541, 2001, 1167, 2317, 460, 2640, 1245,
+                     683, 2889, 2286, 418, 3642, 2592, 2035, 2423, 443, 796, 2875, 1176, 2280, 2631, 633, 2181},
+                    {240, 3089, 391, 1467, 2525, 133, 3995, 928, 1787, 1150, 4091, 3246, 3665, 1825, 3111, 1445,
+                     3953, 2018, 3038, 3822, 3298, 1097, 1672, 1407, 3617, 944, 2557, 2785, 2204, 4059, 2494, 558,
+                     1698, 3958, 2957, 1527, 3487, 1154, 3800, 1616, 1022, 3676, 2774, 597, 3198, 1409, 3542, 923,
+                     1770, 3297, 1929, 1289, 2802, 3189, 1795, 1216, 4017, 2164, 3145, 3391, 959, 3923, 3564, 851},
+                    {2365, 3968, 1690, 2249, 768, 1880, 1368, 3475, 3154, 2311, 61, 1639, 538, 2749, 850, 2457,
+                     395, 1039, 1748, 2296, 454, 1942, 4076, 280, 2052, 3268, 161, 449, 1065, 1464, 73, 2824,
+                     1273, 3222, 661, 932, 2031, 31, 2459, 473, 2149, 1843, 3491, 880, 1711, 178, 2230, 3949,
+                     54, 2460, 3520, 724, 2155, 373, 41, 3507, 1576, 2517, 235, 1762, 472, 2956, 1629, 1408},
+                    {1975, 552, 2879, 3607, 1074, 3051, 469, 2487, 312, 3579, 2691, 983, 1361, 3905, 127, 2136,
+                     3631, 2892, 610, 1470, 2736, 855, 2982, 2252, 720, 3075, 1744, 3760, 2000, 3300, 761, 3636,
+                     1950, 363, 2519, 3673, 1767, 3158, 2703, 3424, 713, 2922, 297, 3965, 2498, 3357, 1953, 2758,
+                     547, 3068, 1430, 3764, 1118, 3932, 886, 3320, 2825, 606, 3803, 1331, 2067, 2466, 21, 3181},
+                    {2581, 936, 3308, 196, 2080, 3899, 2822, 1623, 823, 1272, 2055, 3793, 2263, 2937, 3427, 1676,
+                     1278, 2577, 3870, 3362, 122, 3502, 1256, 2635, 3841, 1522, 3538, 1281, 2950, 2351, 1645, 982,
+                     3416, 2247, 1436, 3862, 522, 1304, 867, 4030, 1416, 2332, 1209, 1540, 3102, 733, 1099, 3679,
+                     1582, 992, 304, 2665, 1694, 2963, 1469, 2261, 1067, 1902, 3553, 758, 2750, 4056, 1134, 3493},
+                    {1293, 3872, 1555, 2719, 1233, 626, 3375, 1973, 3730, 3027, 643, 3282, 287, 1932, 1088, 696,
+                     3202, 194, 912, 2040, 2428, 3715, 1817, 566, 351, 2396, 878, 2709, 609, 239, 3868, 2641,
+                     3023, 107, 1105, 2781, 2995, 2279, 310, 1697, 3261, 147, 3818, 2070, 2707, 405, 1341, 2946,
+                     2134, 4090, 2312, 3394, 140, 2447, 3670, 433, 2622, 188, 3049, 1533, 3304, 350, 1840, 708},
+                    {135, 2157, 339, 1801, 3685, 2277, 34, 1454, 2395, 186, 1722, 2535, 1509, 509, 2638, 3970,
+                     2352, 1875, 2971, 1166, 401, 1605, 3115, 1049, 2886, 1913, 45, 4026, 2148, 3465, 1226, 500,
+                     1824, 4049, 2089, 737, 3473, 1882, 3626, 1069, 2511, 3041, 564, 981, 3720, 2381, 3449, 201,
+                     1759, 3232, 835, 2009, 607, 1845, 3166, 717, 2085, 3920, 1224, 2343, 949, 2197, 3716, 3014},
+                    {2388, 3420, 3104, 750, 2561, 3213, 933, 3996, 1095, 2809, 3861, 899, 3517, 3090, 3695, 1338,
+                     298, 3494, 1498, 4027, 3252, 755, 2177, 3950, 3408, 1388, 3206, 1110, 1717, 3055, 2503, 1482,
+                     840, 3235, 299, 1592, 2565, 125, 3902, 2128, 2741, 1925, 3577, 1633, 39, 1850, 3863, 691,
+                     2495, 451, 1303, 3821, 2760, 1149, 4007, 1356, 3277, 2863, 1743, 104, 3837, 546, 1649, 2811},
+                    {1431, 1933, 1024, 4070, 1370, 410, 1696, 2653, 532, 3336, 2124, 1229, 2335, 5, 1766, 2166,
+                     834, 2740, 570, 2254, 2625, 75, 1306, 2510, 231, 2068, 3683, 2437, 769, 396, 1988, 3812,
+                     2852, 2318, 3691, 1260, 3319, 931, 1488, 659, 386, 1334, 777, 3278, 2174, 3008, 1455, 2662,
+                     1155, 2871, 3532, 1550, 3071, 241, 2221, 1638, 865, 378, 3608, 2483, 3117, 2671, 1106, 3583},
+                    {442, 3749, 575, 2434, 2893, 3528, 2178, 3073, 3591, 1866, 371, 729, 4069, 2844, 1020, 3322,
+                     3031, 3839, 1732, 996, 3644, 2848, 3792, 1670, 925, 2674, 550, 1558, 3886, 3292, 204, 3545,
+                     1128, 618, 1741, 2721, 482, 2406, 3127, 2901, 3422, 4073, 2438, 2821, 1213, 517, 910, 3307,
+                     3972, 1901, 71, 2359, 942, 3574, 503, 2538, 3400, 1959, 1028, 656, 1399, 1906, 217, 849},
+                    {2989, 2650, 1737, 77, 1148, 1955, 252, 787, 1288, 1575, 2567, 2993, 1420, 2003, 617, 1596,
+                     414, 2464, 159, 1392, 1996, 448, 1873, 645, 3509, 3125, 327, 2927, 2235, 1308, 898, 2621,
+                     2156, 13, 3003, 4006, 2014, 3775, 1187, 1660, 85, 1818, 1058, 264, 3926, 3512, 2284, 1664,
+                     324, 2142, 3184, 663, 2623, 1785, 2975, 3786, 7, 2744, 3982, 2150, 3497, 3230, 4029, 2113},
+                    {3378, 1271, 2233, 3922, 3333, 1489, 3737, 2386, 3937, 108, 3248, 3783, 269, 3471, 2613, 3711,
+                     1248, 2081, 3567, 3136, 3376, 839, 2986, 2349, 1211, 3979, 1793, 1040, 3590, 2775, 1851, 1609,
+                     3182, 1386, 3434, 990, 315, 2227, 767, 2609, 3702, 2302, 3187, 1563, 2588, 1931, 149, 3710,
+                     778, 1073, 3646, 1404, 4051, 2069, 1087, 1471, 2310, 1255, 1597, 2938, 425, 1196, 2526, 1568},
+                    {694, 289, 3116, 895, 2726, 647, 2981, 1053, 2823, 2046, 926, 2266, 1132, 1821, 2374, 92,
+                     3989, 2895, 681, 1140, 2533, 4087, 1524, 3313, 23, 2022, 1435, 2545, 664, 101, 4072, 478,
+                     3762, 2489, 711, 1904, 1529, 3287, 195, 3525, 1982, 903, 452, 3784, 701, 1354, 3124, 2444,
+                     2960, 2714, 1733, 377, 3361, 168, 773, 3227, 594, 3648, 232, 2413, 794, 1803, 44, 3840},
+                    {2868, 2011, 3620, 1608, 171, 2144, 1757, 439, 3461, 620, 1706, 3621, 468, 2801, 765, 3210,
+                     963, 1548, 2313, 1784, 218, 392, 2183, 1015, 2807, 3788, 260, 3063, 2090, 3402, 2324, 2887,
+                     1060, 249, 3606, 2660, 2949, 3951, 1345, 2787, 578, 1442, 2941, 2117, 3406, 2769, 1138, 533,
+                     1499, 3898, 2260, 3095, 1237, 2479, 2800, 3940, 1855, 3067, 927, 3352, 3734, 2759, 2242, 997},
+                    {1423, 2410, 1113, 3801, 2549, 3203, 4033, 1396, 2478, 3164, 2708, 1480, 4019, 3050, 1337, 3433,
+                     1935, 506, 3850, 2793, 3539, 1298, 2659, 3628, 565, 2439, 3236, 859, 3708, 1172, 1478, 753,
+                     2020, 1675, 2269, 1225, 499, 1777, 2382, 1082, 3141, 3987, 2524, 17, 1683, 948, 4048, 2038,
+                     3489, 53, 908, 614, 1945, 3611, 1631, 2202, 338, 2636, 2044, 1700, 1330, 3112, 519, 3565},
+                    {3273, 390, 1788, 536, 802, 1238, 3554, 224, 1907, 1163, 46, 824, 2063, 248, 1647, 2223,
+                     2681, 183, 3098, 871, 2026, 3216, 1720, 774, 1922, 1589, 1318, 445, 1727, 2645, 285, 3829,
+                     3029, 3358, 3921, 65, 3221, 820, 3729, 329, 2173, 1810, 1221, 3609, 381, 2380, 3228, 301,
+                     1806, 1309, 2543, 2867, 3855, 975, 477, 1344, 3515, 1100, 3836, 642, 150, 3976, 1892, 2600},
+                    {116, 4088, 3035, 3437, 2329, 2033, 2663, 958, 3693, 2300, 3880, 3309, 2515, 3541, 640, 3947,
+                     1129, 3632, 1389, 2484, 540, 3751, 139, 2970, 3857, 3387, 2259, 4013, 2980, 1908, 3267, 2393,
+                     1312, 579, 2751, 957, 2043, 2497, 3439, 1611, 182, 3303, 832, 3004, 1911, 3753, 670, 2237,
+                     2694, 3725, 3337, 1549, 132, 2378, 3397, 2991, 197, 1531, 2492, 2891, 2158, 1121, 1578, 844},
+                    {1297, 1966, 2729, 1462, 12, 2903, 374, 1537, 3044, 559, 2861, 1811, 1263, 1030, 2362, 2953,
+                     397, 2138, 1691, 3383, 1045, 1497, 2398, 1208, 272, 967, 2773, 64, 1077, 549, 3587, 913,
+                     126, 1837, 1552, 3666, 3070, 1390, 667, 2870, 3804, 2295, 595, 2602, 1406, 2835, 1585, 1186,
+                     3056, 801, 450, 2141, 3160, 1815, 726, 2672, 3997, 843, 3295, 382, 3667, 3386, 2348, 2935},
+                    {3472, 637, 2218, 896, 3878, 1669, 3326, 3988, 757, 2171, 1601, 415, 3723, 2755, 86, 3269,
+                     1841, 798, 3912, 42, 2843, 4046, 2112, 3153, 2620, 666, 1985, 3530, 2516, 1571, 2108, 2829,
+                     4023, 2564, 2228, 1137, 360, 4086, 1884, 2658, 984, 1515, 3481, 4015, 1054, 117, 3373, 3944,
+                     219, 1981, 1080, 4084, 1375, 3678, 1142, 2058, 1693, 2333, 1921, 1397, 2716, 725, 286, 3889},
+                    {1061, 1708, 3740, 1199, 3137, 604, 1947, 2403, 1324, 3447, 198, 3171, 891, 1979, 1525, 3596,
+                     1284, 2647, 3039, 2256, 677, 1872, 345, 3614, 1761, 3934, 1458, 3183, 786, 3873, 1202, 408,
+                     3088, 738, 3450, 202, 2930, 2334, 474, 1205, 3178, 67, 2025, 426, 3101, 2106, 857, 2507,
+                     1746, 3513, 2924, 2474, 262, 2761, 535, 3234, 114, 3619, 568, 1026, 3179, 1775, 2076, 2536},
+                    {3100, 160, 2415, 400, 3527, 2572, 1011, 257, 2739, 1098, 3817, 2575, 2248, 4079, 732, 486,
+                     2435, 3780, 309, 1170, 3306, 2552, 875, 1350, 475, 2212, 1141, 2916, 164, 2309, 3354, 1740,
+                     1437, 3717, 1967, 3231, 1685, 888, 3514, 2107, 3919, 2486, 1751, 1300, 2405, 3690, 2725, 471,
+                     1333, 2283, 630, 1659, 901, 3074, 2215, 3904, 1276, 2928, 2626, 4061, 48, 3779, 1472, 480},
+                    {3684, 3346, 1999, 2819, 1382, 1768, 3838, 2961, 3610, 2079, 1699, 615, 1346, 2873, 3425, 3105,
+                     1612, 938, 2008, 1438, 3566, 1627, 2958, 3396, 2737, 3741, 2461, 362, 1857, 3681, 2717, 227,
+                     2443, 999, 516, 1285, 3799, 2788, 1425, 276, 2978, 811, 3311, 3843, 651, 1858, 1520, 3572,
+                     3131, 3885, 19, 3412, 3831, 1864, 1493, 359, 943, 3448, 1574, 2205, 1222, 2998, 872, 2747},
+                    {1275, 1577, 728, 4024, 84, 2281, 813, 510, 1485, 38, 3048, 3349, 1888, 134, 1086, 2127,
+                     243, 2827, 3220, 534, 3859, 221, 2336, 1056, 16, 641, 1667, 3452, 960, 1360, 2054, 678,
+                     3942, 2881, 2175, 2619, 3, 2424, 1847, 3672, 543, 1569, 2798, 253, 979, 2917, 162, 1104,
+                     740, 2786, 2084, 1177, 2608, 700, 2385, 3331, 2532, 2005, 748, 335, 2472, 3506, 1878, 2288},
+                    {247, 976, 2639, 3007, 1124, 3401, 3146, 2015, 2485, 4016, 952, 2367, 367, 3896, 2624, 1773,
+                     3647, 4002, 2361, 1832, 2702, 756, 2053, 3969, 1479, 3263, 2115, 4008, 2987, 505, 3174, 1130,
+                     3317, 1519, 3605, 827, 3978, 627, 3329, 1038, 2243, 2576, 1180, 3498, 2214, 3201, 4055, 2363,
+                     1919, 1590, 340, 3209, 1358, 3738, 90, 2850, 1719, 487, 3866, 3144, 1678, 185, 653, 3975},
+                    {2104, 3218, 1820, 561, 2140, 3719, 1615, 1232, 3522, 704, 2692, 1194, 3701, 1459, 2285, 577,
+                     1257, 822, 60, 1075, 3015, 1286, 3634, 3109, 1886, 2838, 1230, 762, 2548, 1587, 3726, 2267,
+                     120, 1778, 320, 1930, 3134, 1191, 1641, 3047, 4044, 82, 1923, 3767, 1661, 331, 1317, 2570,
+                     3351, 917, 3658, 2908, 514, 1977, 998, 3994, 1160, 3562, 1367, 2754, 3712, 1096, 3368, 2906},
+                    {369, 3581, 3828, 1433, 2504, 429, 190, 2845, 1849, 305, 3272, 1662, 2897, 759, 3492, 2994,
+                     3318, 1492, 2531, 3519, 2190, 379, 1712, 166, 907, 2611, 318, 3627, 76, 1917, 2766, 856,
+                     3010, 2559, 3486, 1387, 2745, 2305, 192, 2036, 863, 3388, 1380, 692, 2690, 2047, 3698, 601,
+                     118, 3939, 2159, 2430, 1689, 3445, 3132, 2257, 228, 3013, 2130, 906, 2360, 1980, 1450, 2550},
+                    {1663, 2387, 111, 874, 3301, 2724, 1023, 3908, 2292, 1402, 3827, 2162, 431, 1948, 1005, 193,
+                     2722, 2016, 1665, 3945, 665, 3413, 2432, 3809, 583, 2231, 3382, 1432, 2389, 3834, 422, 1313,
+                     4077, 585, 2100, 964, 457, 3851, 3571, 2686, 376, 2877, 2356, 3133, 446, 940, 3019, 1715,
+                     2753, 1463, 1116, 754, 199, 2667, 1503, 809, 1867, 2595, 629, 4, 3262, 461, 3810, 763},
+                    {1033, 1301, 3092, 1970, 4080, 1752, 673, 3446, 2988, 884, 96, 2582, 3604, 3215, 2445, 4065,
+                     355, 3689, 492, 3130, 1369, 2768, 1037, 1510, 2932, 4057, 1114, 1738, 3229, 1008, 2152, 3417,
+                     1682, 1165, 3765, 2864, 3347, 739, 1501, 1241, 1833, 3884, 1076, 1561, 4004, 3462, 1174, 2297,
+                     3270, 453, 3540, 3082, 4074, 1239, 3653, 317, 3823, 3360, 1606, 4053, 1799, 1220, 3066, 2796},
+                    {3990, 3414, 634, 2874, 1183, 2194, 1481, 2449, 501, 2050, 3140, 1112, 622, 1544, 1316, 1745,
+                     2220, 1156, 2878, 951, 91, 2099, 3274, 1936, 3556, 455, 2045, 3058, 234, 699, 2842, 2463,
+                     175, 3139, 2327, 47, 1728, 2528, 2199, 3245, 591, 3618, 223, 2151, 2488, 58, 1885, 716,
+                     3860, 2023, 2589, 1797, 2274, 616, 2061, 2828, 2399, 1266, 1017, 2885, 2471, 3557, 167, 2062},
+                    {2634, 1713, 2299, 388, 3671, 148, 3170, 3727, 1242, 1650, 4032, 1859, 2834, 3790, 6, 3081,
+                     781, 3290, 2384, 1852, 3777, 2584, 727, 265, 1267, 2473, 829, 2677, 3511, 3973, 1862, 1514,
+                     3652, 789, 1960, 1447, 3985, 282, 1010, 3025, 2633, 1630, 797, 3323, 2858, 1410, 3600, 2945,
+                     295, 1325, 977, 30, 2925, 3302, 921, 1739, 529, 3064, 3490, 358, 723, 2236, 1557, 526}
+            },
+            {
+                    {1670, 3568, 1299, 2518, 1561, 3189, 1237, 178, 3437, 1928, 1431, 465, 3830, 1854, 1583, 3990,
+                     2340, 854, 1746, 2062, 2695, 3576, 299, 887, 3450, 2606, 3807, 342, 3540, 3112, 1139, 3319,
+                     753, 3786, 943, 91, 568, 2835, 1356, 3915, 3176, 556, 916, 3021, 2677, 76, 1982, 3137,
+                     1552, 3793, 697, 2425, 224, 2651, 1277, 1822, 3069, 3960, 1626, 1425, 3244, 4075, 824, 2201},
+                    {3359, 2645, 3123, 28, 3804, 2006, 2709, 1659, 3889, 280, 3012, 3591, 2126, 712, 2749, 71,
+                     3198, 478, 3669, 159, 3280, 1288, 1938, 3965, 517, 1211, 2262, 1494, 724, 2850, 4, 2663,
+                     1981, 1721, 2739, 2233, 3395, 1547, 336, 2142, 1757, 3539, 1472, 369, 2187, 1190, 3482, 2511,
+                     249, 2736, 2996, 1402, 1015, 480, 3898, 2492, 199, 385, 2819, 547, 2625, 166, 2451, 2903},
+                    {240, 561, 1934, 1135, 2869, 472, 799, 3266, 2396, 654, 2576, 934, 3250, 1297, 3419, 970,
+                     2156, 1360, 2813, 1142, 648, 2508, 3150, 1462, 2771, 1704, 3009, 983, 2097, 3756, 2345, 1332,
+                     3933, 263, 3169, 1225, 1906, 3620, 3086, 722, 1178, 2557, 3845, 3273, 1700, 3731, 602, 908,
+                     3982, 1152, 2160, 3679, 1777, 3122, 1527, 3460, 1069, 3282, 3673, 914, 1930, 3459, 1191, 1512},
+                    {949, 3951, 2374, 1728, 3512, 2231, 4086, 1394, 1079, 3704, 1785, 1546, 359, 3880, 2473, 1683,
+                     3020, 3934, 2387, 1873, 3825, 383, 2224, 755, 3719, 90, 3425, 4067, 270, 1802, 1580, 593,
+                     1021, 3464, 1470, 452, 857, 2599, 3815, 164, 2303, 2920, 238, 1020, 2391, 2878, 1371, 1883,
+                     3340, 1644, 62, 3281, 832, 2205, 2752, 714, 2084, 1687, 2401, 1329, 3040, 678, 3744, 2073},
+                    {2952, 1417, 3663, 688, 1005, 170, 2545, 2940, 2046, 54, 3149, 2767, 2292, 162, 1961, 584,
+                     3604, 211, 768, 3348, 1610, 2992, 3558, 1077, 2035, 2412, 645, 2542, 1159, 3246, 3651, 3044,
+                     2459, 2055, 2827, 4084, 2360, 1665, 1060, 1995, 3388, 1333, 1871, 765, 4073, 131, 3085, 449,
+                     2285, 2839, 571, 1978, 4002, 175, 3623, 443, 2972, 3809, 13, 2180, 3979, 292, 1749, 3220},
+                    {2245, 115, 2730, 3291, 3068, 1531, 1843, 334, 3528, 1310, 4001, 754, 3466, 1201, 2943, 2652,
+                     1096, 1502, 2085, 2631, 974, 56, 1791, 2867, 317, 1296, 3179, 1915, 2800, 828, 403, 2700,
+                     126, 3698, 695, 3293, 37, 2970, 587, 2703, 3967, 474, 3569, 2764, 2082, 1541, 2615, 3521,
+                     1057, 3882, 2549, 1266, 2899, 2384, 1128, 1413, 1878, 844, 2705, 1103, 1576, 2772, 2510, 462},
+                    {3411, 856, 1963, 415, 1269, 3757, 3385, 600, 2368, 952, 2167, 467, 1856, 3693, 868, 4037,
+                     370, 3126, 3542, 509, 3910, 1415, 2468, 4020, 3361, 1590, 3832, 192, 1433, 3496, 2189, 1238,
+                     1638, 918, 1821, 1175, 2122, 3753, 1428, 3211, 878, 1620, 2244, 3148, 626, 1209, 3685, 2008,
+                     287, 739, 1500, 3470, 402, 1676, 3254, 2603, 4039, 3399, 532, 3178, 3523, 767, 3859, 1284},
+                    {3696, 1628, 4035, 2417, 2102, 2653, 816, 3941, 2794, 1646, 3060, 2589, 1441, 3239, 1624, 2143,
+                     2435, 1764, 1265, 2842, 2246, 3251, 822, 433, 2175, 921, 2977, 2300, 512, 3976, 1945, 3325,
+                     3870, 2306, 3120, 390, 2525, 3502, 293, 1846, 2430, 79, 1091, 3879, 355, 3306, 861, 1733,
+                     2397, 3762, 2994, 1848, 907, 3711, 683, 2274, 331, 1257, 2449, 1986, 130, 2301, 1042, 1885},
+                    {582, 2558, 1093, 3018, 218, 1720, 1147, 3187, 1947, 121, 3828, 1054, 241, 2823, 655, 48,
+                     3387, 3811, 717, 1923, 183, 3658, 1230, 2731, 1882, 3607, 686, 2649, 1729, 1043, 2947, 659,
+                     232, 2610, 1337, 3961, 1588, 795, 2868, 1258, 3677, 3017, 2637, 1446, 1828, 2472, 2926, 1,
+                     3177, 1137, 2130, 140, 2684, 3087, 2050, 69, 1549, 3010, 1772, 3642, 1436, 2895, 330, 3103},
+                    {1389, 33, 3344, 756, 3852, 511, 2287, 1414, 376, 3639, 2443, 3363, 2004, 3957, 2309, 1386,
+                     2733, 987, 310, 3022, 2570, 1655, 598, 3064, 1475, 145, 1143, 3283, 3749, 39, 2497, 1488,
+                     3600, 2843, 559, 3369, 1965, 1035, 2278, 4042, 689, 2015, 3398, 236, 3740, 2179, 3996, 1343,
+                     2708, 563, 3382, 4066, 1438, 1067, 3902, 3511, 2811, 3792, 931, 649, 3913, 3321, 2131, 2681},
+                    {3476, 1796, 2220, 1507, 2757, 3265, 3684, 2921, 912, 1567, 731, 1292, 506, 3033, 1138, 3656,
+                     1964, 3197, 1486, 4070, 1109, 2058, 3846, 2325, 3435, 3995, 2446, 2010, 1346, 3118, 2138, 858,
+                     1863, 1101, 2213, 85, 3026, 2670, 181, 3295, 463, 1710, 961, 2817, 770, 495, 1600, 978,
+                     3561, 1679, 2315, 328, 2496, 519, 1901, 783, 1164, 2202, 196, 2546, 1216, 1691, 889, 3991},
+                    {1173, 2960, 346, 3577, 998, 1836, 150, 2500, 2067, 3504, 2735, 2237, 1739, 3548, 347, 815,
+                     2519, 522, 3508, 2346, 769, 3311, 11, 1014, 387, 2871, 1664, 797, 304, 2753, 4013, 431,
+                     3227, 3836, 1703, 3724, 643, 3572, 1483, 2094, 2566, 1348, 3618, 2339, 1235, 3465, 2580, 187,
+                     3849, 1962, 850, 1248, 2935, 3304, 1595, 2654, 3368, 428, 3147, 2027, 2756, 498, 152, 2381},
+                    {621, 3778, 2591, 2029, 1323, 3948, 670, 1228, 3090, 4057, 27, 3289, 957, 2596, 3866, 1592,
+                     2955, 2184, 1745, 227, 2902, 3613, 1838, 2668, 1309, 2157, 548, 3625, 3357, 1008, 1613, 3514,
+                     2403, 288, 1419, 899, 2442, 1787, 3901, 1123, 3114, 3816, 55, 2961, 1868, 3225, 2089, 3029,
+                     691, 2824, 3245, 3791, 2098, 3643, 275, 2354, 1368, 1825, 3999, 3452, 1519, 3042, 3595, 1994},
+                    {3247, 1589, 835, 188, 3119, 2249, 2702, 1649, 421, 1867, 601, 1443, 2882, 207, 1897, 1305,
+                     75, 3975, 1193, 2742, 1381, 494, 1587, 3212, 855, 3765, 3078, 2544, 1818, 2253, 637, 1226,
+                     2022, 2944, 2715, 3183, 1244, 350, 2851, 847, 300, 2221, 1538, 635, 4087, 339, 1075, 1375,
+                     2394, 438, 1515, 50, 1750, 687, 989, 3046, 3759, 627, 1044, 2291, 786, 3883, 1769, 1016},
+                    {391, 2768, 4081, 2422, 527, 3453, 897, 3743, 3343, 1089, 2386, 3906, 2081, 3151, 2348, 3417,
+                     3709, 638, 3271, 898, 3822, 2171, 2455, 3959, 1948, 261, 1469, 1186, 148, 3710, 3015, 2618,
+                     113, 751, 4040, 1953, 3490, 2276, 3272, 585, 1905, 2777, 3486, 925, 2669, 1656, 3734, 3351,
+                     1784, 3986, 2571, 1113, 2279, 2724, 4029, 151, 2520, 1673, 2879, 26, 1294, 303, 2514, 2914},
+                    {2240, 1252, 3315, 1758, 1452, 2886, 118, 2129, 2561, 2999, 813, 3657, 1214, 545, 784, 2685,
+                     1047, 2076, 2499, 1929, 3095, 306, 1094, 656, 2931, 3509, 2355, 4093, 2832, 477, 1373, 3863,
+                     3392, 1558, 1068, 533, 18, 1593, 3705, 2526, 3978, 1160, 3204, 2034, 247, 2482, 800, 2207,
+                     136, 3574, 901, 3157, 3472, 1302, 1949, 3234, 2132, 363, 3687, 2632, 3322, 2056, 3795, 1423},
+                    {168, 1935, 658, 3646, 1052, 3867, 1893, 1350, 394, 1534, 2789, 1695, 315, 3535, 1799, 1504,
+                     3062, 429, 1651, 125, 3467, 1513, 3675, 2750, 72, 1698, 928, 682, 1933, 3263, 2147, 884,
+                     1782, 2318, 3622, 2554, 3054, 2135, 940, 1418, 1723, 119, 2395, 1351, 3861, 3131, 2864, 503,
+                     1253, 2967, 1910, 588, 223, 2844, 1544, 839, 1198, 3534, 1451, 1839, 3063, 877, 562, 3427},
+                    {3589, 909, 2969, 2086, 344, 2486, 3175, 727, 4018, 3408, 78, 2223, 3231, 2528, 4076, 255,
+                     2861, 3350, 3897, 1206, 2628, 817, 2266, 3308, 1279, 2083, 3402, 2643, 1073, 1639, 2476, 274,
+                     3141, 397, 2840, 1358, 710, 3932, 278, 2907, 3380, 758, 3680, 537, 1814, 1034, 1496, 3650,
+                     2041, 2691, 1607, 3927, 2465, 3692, 445, 3873, 2948, 2343, 669, 4064, 1111, 2420, 1662, 2676},
+                    {1146, 2341, 3944, 6, 1614, 2783, 1182, 3615, 2337, 1002, 1916, 3820, 1397, 1108, 2009, 905,
+                     2203, 1357, 2372, 693, 2978, 4050, 1816, 525, 2521, 3936, 405, 3053, 3768, 42, 3570, 3962,
+                     1199, 2075, 3754, 1876, 3454, 1145, 2648, 2005, 423, 2238, 3006, 2725, 3503, 22, 2320, 4031,
+                     716, 3447, 305, 1390, 2120, 766, 1803, 3346, 106, 979, 2762, 434, 2191, 93, 3912, 3125},
+                    {257, 1518, 2586, 3226, 3473, 2209, 583, 1726, 193, 3083, 2633, 455, 640, 2761, 3721, 17,
+                     3488, 523, 3644, 1717, 340, 2061, 1396, 992, 3170, 194, 1525, 2192, 1298, 2884, 777, 1491,
+                     2701, 603, 920, 244, 1629, 2358, 3195, 3609, 1040, 4049, 1609, 1229, 862, 1954, 3262, 367,
+                     1157, 2413, 966, 3285, 2988, 1127, 2268, 2629, 1661, 2016, 3443, 3192, 1569, 3678, 720, 1860},
+                    {2829, 3747, 791, 1319, 448, 942, 3763, 2900, 2042, 1285, 3586, 834, 2975, 2299, 1551, 3106,
+                     2567, 1879, 975, 2741, 3274, 98, 3566, 2897, 3799, 1913, 829, 3527, 580, 2302, 1859, 3373,
+                     3035, 2408, 4071, 3312, 2925, 82, 589, 1795, 1365, 2515, 167, 2133, 3885, 2560, 1654, 2807,
+                     3061, 1832, 3814, 2656, 44, 3554, 558, 3109, 1316, 3949, 243, 1223, 2594, 2913, 1374, 2106},
+                    {3377, 554, 1755, 2007, 4024, 2640, 1481, 3288, 294, 2448, 1599, 3988, 1830, 3333, 406, 1221,
+                     733, 4003, 2158, 1156, 3783, 2462, 1623, 704, 1179, 2367, 2792, 1754, 3874, 2587, 451, 1062,
+                     142, 1738, 1304, 2564, 1989, 1464, 3857, 866, 2781, 3320, 664, 3102, 320, 3413, 591, 1379,
+                     2212, 212, 632, 1696, 1988, 4038, 1516, 290, 3610, 2450, 859, 1918, 539, 3524, 994, 365},
+                    {2234, 3099, 1072, 2440, 2995, 101, 1874, 807, 3853, 1074, 3194, 2139, 103, 955, 3871, 1681,
+                     2847, 3205, 302, 1490, 3071, 471, 2198, 2698, 3478, 420, 3129, 984, 258, 3276, 2047, 3738,
+                     3545, 2196, 373, 740, 1029, 3707, 2270, 3037, 343, 1960, 3695, 1427, 2841, 1119, 3722, 895,
+                     3956, 3221, 3598, 1247, 874, 2357, 2770, 1028, 698, 2146, 2837, 3848, 1727, 3242, 2487, 4048},
+                    {1463, 2671, 3682, 325, 3407, 1194, 2364, 3547, 2728, 413, 605, 2862, 1437, 2481, 3532, 1973,
+                     2377, 134, 3442, 1835, 657, 935, 4026, 1349, 24, 2066, 3971, 1474, 1249, 2918, 1618, 865,
+                     1403, 2805, 3875, 3070, 3506, 2675, 479, 1263, 3940, 2419, 1686, 790, 2252, 1853, 2447, 80,
+                     2018, 1480, 2524, 2906, 439, 3430, 3202, 1855, 3733, 3027, 1429, 23, 2311, 781, 222, 1243},
+                    {1940, 60, 715, 1601, 2152, 3904, 630, 1372, 2197, 1718, 3479, 1202, 3769, 259, 2711, 567,
+                     1380, 849, 3907, 2263, 2796, 3605, 1937, 3309, 1680, 2541, 623, 3634, 2428, 105, 3939, 2624,
+                     586, 3229, 1132, 1841, 231, 2093, 1604, 3418, 41, 1107, 3498, 235, 4019, 3162, 489, 3513,
+                     2747, 1053, 279, 3777, 2113, 1340, 102, 2565, 1643, 333, 3360, 1098, 3592, 2039, 3011, 3785},
+                    {882, 3541, 3213, 2830, 972, 1790, 3159, 180, 2928, 4088, 2563, 1908, 725, 2211, 3058, 1090,
+                     3668, 2971, 1648, 1218, 2509, 156, 2923, 1083, 823, 2990, 3366, 1827, 2172, 726, 3059, 1922,
+                     2342, 0, 1570, 2478, 672, 3255, 938, 1809, 2602, 2165, 2910, 986, 2634, 1536, 1217, 2984,
+                     1715, 2329, 780, 3101, 1568, 675, 3942, 2247, 1187, 590, 4007, 2474, 1560, 440, 2797, 1689},
+                    {524, 2284, 4005, 1339, 466, 2647, 3784, 880, 1545, 284, 997, 3365, 3173, 1619, 4014, 395,
+                     2108, 2612, 3303, 441, 3775, 1453, 338, 2350, 3821, 228, 1188, 459, 2787, 3480, 1104, 360,
+                     3394, 4017, 2153, 3593, 1367, 2808, 4058, 3004, 518, 1471, 3249, 620, 3655, 2103, 296, 3892,
+                     594, 3330, 4091, 1845, 2666, 3544, 954, 2950, 3269, 2028, 2687, 922, 3142, 3891, 1166, 2540},
+                    {3052, 1055, 2026, 2494, 144, 3337, 1951, 2414, 3065, 2064, 521, 2349, 77, 1312, 894, 3404,
+                     1813, 30, 718, 1010, 2032, 3462, 1776, 3224, 2149, 2710, 1577, 4072, 926, 1445, 3690, 1732,
+                     1291, 917, 2959, 450, 3758, 160, 2336, 761, 3550, 3813, 1990, 104, 1789, 3386, 2502, 946,
+                     1391, 1993, 7, 1155, 2406, 233, 1705, 416, 3812, 1411, 161, 1805, 673, 2208, 117, 3414},
+                    {1530, 268, 1744, 2968, 3689, 1150, 596, 3516, 1280, 3929, 3626, 2678, 1770, 3745, 2793, 2454,
+                     1435, 3955, 2242, 3155, 2697, 569, 4004, 734, 1342, 3647, 1912, 3190, 2273, 173, 2484, 3136,
+                     2759, 1996, 752, 2583, 1081, 1556, 1950, 1254, 265, 2466, 1140, 2810, 1345, 759, 3787, 2778,
+                     2228, 3627, 2875, 535, 3714, 3367, 2798, 1907, 774, 2334, 3660, 2880, 3338, 1369, 1884, 3727},
+                    {612, 3877, 3457, 788, 1468, 2235, 1688, 14, 2818, 741, 1479, 1124, 2982, 595, 2025, 253,
+                     1165, 2909, 3578, 1594, 1289, 2421, 2872, 960, 408, 2529, 52, 674, 2930, 2017, 3924, 564,
+                     217, 3794, 1667, 3455, 2267, 3075, 3342, 2737, 1708, 876, 3115, 4036, 2361, 3039, 204, 1645,
+                     419, 3184, 869, 1517, 2137, 1326, 1063, 2530, 3094, 3449, 1219, 374, 4080, 2423, 818, 2665},
+                    {2865, 1272, 2366, 414, 2714, 4046, 3196, 1007, 2533, 1852, 3258, 371, 2161, 3501, 796, 3193,
+                     3800, 505, 1921, 322, 3865, 205, 1684, 2014, 3045, 3431, 1102, 3831, 1321, 2650, 842, 1523,
+                     2380, 3200, 1239, 74, 3890, 409, 634, 3630, 3862, 2204, 366, 1606, 529, 1025, 1919, 3307,
+                     1246, 2475, 1779, 3973, 2989, 700, 3839, 63, 1564, 552, 2162, 1713, 1017, 234, 3206, 2044},
+                    {51, 3279, 1840, 958, 3043, 242, 1991, 3761, 475, 2271, 3833, 190, 2488, 4062, 1526, 1712,
+                     2581, 976, 2365, 806, 3092, 1151, 3327, 3736, 1467, 2312, 1766, 3564, 271, 3299, 1834, 1085,
+                     3422, 2173, 679, 1898, 2683, 944, 2110, 1361, 95, 2595, 3284, 3491, 2070, 3666, 2616, 3869,
+                     633, 3530, 146, 2635, 321, 2310, 3253, 2049, 3980, 893, 2834, 2600, 3074, 1498, 3608, 1097},
+                    {1627, 2553, 3937, 2140, 3555, 666, 1300, 2885, 1581, 3384, 888, 3079, 1331, 1023, 2866, 92,
+                     2188, 3397, 1416, 2723, 3533, 2177, 2598, 94, 553, 2779, 785, 2182, 1596, 492, 3016, 3652,
+                     309, 2799, 4094, 3002, 1442, 1767, 3236, 2858, 1059, 1900, 1455, 709, 1231, 2873, 53, 1492,
+                     2260, 1078, 2001, 3144, 962, 1652, 485, 2729, 1355, 3560, 135, 3790, 1975, 579, 3856, 2251},
+                    {3515, 736, 201, 1204, 1562, 2614, 2385, 3632, 149, 1180, 2704, 1731, 1974, 483, 3286, 3712,
+                     681, 3003, 3987, 132, 1768, 619, 915, 4034, 1256, 3181, 3921, 993, 2860, 2433, 3970, 2037,
+                     1392, 923, 468, 2460, 3517, 260, 3945, 2399, 500, 2973, 3977, 273, 2323, 3210, 1759, 827,
+                     4051, 2846, 1399, 3748, 3423, 1889, 3665, 1092, 2427, 1820, 3182, 737, 1290, 2516, 2933, 458},
+                    {1406, 2780, 3146, 3776, 514, 3296, 1881, 805, 4016, 2048, 616, 3597, 3931, 2353, 2642, 1260,
+                     1864, 381, 1106, 2038, 3681, 1521, 2946, 1914, 2469, 319, 1997, 147, 3396, 1220, 744, 40,
+                     2609, 1657, 3701, 1118, 748, 2283, 1227, 3653, 838, 1699, 3587, 2716, 936, 3803, 410, 2535,
+                     3100, 282, 549, 2392, 772, 1278, 2962, 230, 3356, 427, 1597, 2297, 3444, 289, 1781, 937},
+                    {4063, 1942, 2327, 1714, 2916, 1056, 283, 1395, 3167, 2226, 2976, 38, 1456, 789, 277, 2099,
+                     3494, 1633, 2523, 2816, 3256, 246, 2352, 3389, 1634, 3619, 2689, 1449, 3796, 1775, 2275, 3536,
+                     2945, 1872, 3275, 2063, 3097, 1621, 19, 1977, 3353, 2505, 169, 2141, 1384, 3445, 1957, 1181,
+                     2134, 3313, 1735, 2746, 31, 3958, 2592, 677, 2125, 4047, 959, 2766, 1136, 3905, 2117, 3317},
+                    {157, 1125, 400, 870, 2119, 3966, 3403, 2812, 491, 1647, 2536, 1088, 3410, 2826, 3864, 951,
+                     3145, 3764, 812, 530, 1307, 1036, 3887, 711, 426, 1116, 2986, 618, 2573, 358, 3161, 1039,
+                     592, 3840, 165, 379, 2551, 3771, 2748, 639, 3067, 1514, 1148, 3172, 510, 1616, 2966, 668,
+                     3649, 1532, 985, 3808, 2225, 1984, 1563, 3127, 1420, 2883, 3694, 1943, 12, 3104, 660, 2641},
+                    {2444, 3049, 3700, 3484, 43, 2493, 1537, 2313, 939, 3497, 3767, 386, 1800, 3098, 1585, 2290,
+                     65, 1393, 2402, 4089, 3036, 2217, 2646, 1382, 3770, 1794, 2241, 3297, 906, 2115, 4000, 1510,
+                     2398, 1250, 2788, 1460, 3438, 900, 1306, 3989, 401, 2259, 3686, 747, 4027, 2456, 84, 3914,
+                     2662, 202, 3433, 3013, 1172, 399, 3563, 864, 2375, 184, 574, 2491, 1499, 3611, 1308, 1653},
+                    {3817, 719, 1459, 2718, 1255, 1967, 702, 3818, 123, 1941, 1324, 729, 2441, 2020, 1170, 497,
+                     2720, 3371, 1701, 332, 1851, 3334, 5, 2053, 3128, 831, 107, 3553, 1283, 1677, 195, 2694,
+                     3471, 848, 2186, 4041, 504, 1849, 2150, 2905, 1741, 964, 2657, 1998, 2820, 1793, 1061, 2316,
+                     1322, 825, 1865, 2485, 622, 3260, 1716, 3899, 1086, 3428, 1788, 3240, 853, 2265, 2917, 487},
+                    {3379, 2215, 1806, 3259, 543, 3023, 3556, 1169, 2593, 3215, 2775, 4043, 3314, 209, 3631, 3950,
+                     703, 2938, 2124, 3601, 903, 642, 1557, 3500, 2743, 2376, 4061, 1932, 2801, 3718, 3066, 453,
+                     1972, 3201, 1707, 2965, 1066, 3300, 2458, 221, 3507, 3827, 109, 1330, 3405, 318, 3581, 3223,
+                     2043, 2881, 345, 4074, 1410, 2785, 116, 2621, 2057, 1325, 3843, 2673, 368, 3953, 1022, 1992},
+                    {1213, 100, 930, 2543, 3920, 1641, 220, 2894, 1761, 337, 2168, 1045, 576, 2964, 1335, 2572,
+                     1902, 1051, 198, 1232, 2601, 3835, 2891, 1013, 515, 1197, 269, 1482, 557, 2289, 776, 1184,
+                     3876, 88, 663, 2331, 272, 3726, 723, 1454, 1130, 3235, 2379, 624, 3025, 896, 1493, 481,
+                     3824, 1666, 3531, 2107, 1032, 3732, 2261, 540, 3056, 281, 732, 2155, 1669, 3485, 225, 2758},
+                    {4015, 2951, 3582, 286, 2295, 1049, 2127, 3998, 1409, 851, 3573, 1566, 2351, 1743, 886, 2190,
+                     3505, 1542, 3908, 3217, 2371, 1968, 245, 1742, 3893, 2513, 3233, 2956, 1009, 3383, 2479, 1798,
+                     3603, 2588, 1366, 3458, 2707, 1615, 3121, 2622, 2071, 488, 1869, 1605, 3720, 2517, 2193, 3081,
+                     692, 1192, 138, 2400, 3166, 743, 1826, 3390, 1582, 3636, 2896, 1167, 3089, 1405, 2404, 1752},
+                    {464, 1555, 2023, 1378, 3154, 794, 3332, 476, 2383, 3093, 3847, 64, 2732, 3752, 3186, 129,
+                     404, 3077, 2751, 560, 1432, 3638, 3047, 2200, 1352, 3661, 2033, 1631, 3928, 61, 2104, 2893,
+                     1528, 973, 2059, 3947, 1203, 1925, 124, 3918, 890, 2936, 4079, 2744, 1174, 25, 3974, 1887,
+                     2763, 2548, 3358, 1550, 430, 2949, 1205, 3964, 873, 2457, 1903, 122, 3691, 611, 3302, 826},
+                    {3742, 2658, 671, 3851, 2776, 1837, 3703, 2617, 650, 1892, 1236, 2065, 3401, 484, 1448, 4023,
+                     2424, 1786, 798, 2239, 111, 1131, 840, 389, 3331, 613, 814, 341, 2613, 1341, 3750, 615,
+                     210, 3329, 349, 3000, 867, 570, 3529, 2269, 1274, 3421, 248, 787, 2092, 3352, 1362, 995,
+                     313, 3725, 811, 3935, 1959, 2582, 34, 1430, 2721, 456, 2230, 4095, 929, 2569, 2088, 3014},
+                    {2257, 3406, 1095, 2416, 377, 1271, 3, 1554, 3474, 2833, 312, 2537, 779, 1100, 1971, 2870,
+                     1261, 1000, 3730, 3277, 1693, 4056, 3439, 2547, 2795, 1819, 2333, 3171, 3475, 1748, 1122, 3091,
+                     4083, 2760, 1642, 2216, 3802, 2489, 2854, 1762, 411, 1524, 2356, 3628, 1737, 436, 2958, 2338,
+                     3248, 1797, 1295, 2250, 1001, 3662, 3267, 2077, 3567, 1070, 3341, 1476, 2804, 1847, 32, 1315},
+                    {351, 1877, 155, 1697, 3543, 3007, 2052, 1121, 3237, 969, 4082, 1520, 2987, 2307, 3575, 647,
+                     2644, 3420, 2031, 422, 2927, 2405, 1931, 1553, 36, 1176, 4009, 953, 2831, 250, 2272, 803,
+                     1891, 2382, 490, 3214, 9, 1503, 1076, 3716, 3152, 2690, 1012, 3057, 3854, 2611, 610, 3599,
+                     1578, 89, 3048, 531, 2852, 316, 1690, 665, 3008, 177, 1730, 3135, 544, 3878, 3519, 1003},
+                    {2532, 4055, 3268, 2888, 919, 3968, 2321, 3773, 417, 2210, 1792, 139, 3788, 3209, 1635, 256,
+                     3819, 67, 1501, 2577, 1276, 653, 967, 3624, 3132, 3774, 1478, 2159, 566, 3671, 2550, 3375,
+                     1404, 1018, 3588, 1264, 2002, 3378, 721, 200, 2145, 1895, 628, 163, 1126, 1487, 1956, 879,
+                     4059, 2080, 2664, 3538, 1461, 2429, 4030, 1282, 2304, 3823, 764, 2498, 1183, 262, 1640, 3158},
+                    {1408, 750, 2170, 1495, 470, 661, 2584, 1650, 819, 3076, 3645, 1287, 2672, 424, 963, 2232,
+                     1833, 3051, 746, 3969, 3489, 179, 2856, 2090, 508, 2659, 215, 3019, 1281, 1987, 1572, 393,
+                     3886, 2688, 667, 1753, 2953, 4032, 2597, 1387, 3872, 3310, 3537, 2522, 2222, 3278, 2806, 208,
+                     2453, 1082, 707, 3842, 1894, 845, 3168, 252, 2660, 1875, 1363, 3446, 2000, 2335, 3728, 2849},
+                    {435, 1196, 3602, 2696, 1976, 3355, 1344, 120, 2765, 2410, 551, 2091, 728, 1904, 4012, 1385,
+                     3323, 2393, 1149, 2169, 3105, 1778, 3917, 1376, 802, 2452, 1866, 3546, 778, 3841, 3230, 57,
+                     2911, 2096, 3723, 2461, 362, 945, 2293, 2815, 460, 836, 1663, 1328, 4008, 398, 3737, 1273,
+                     3440, 3113, 1709, 375, 3364, 1163, 2111, 3755, 988, 2937, 380, 3994, 2719, 891, 604, 2112},
+                    {3894, 3072, 2432, 66, 1065, 3107, 1812, 3911, 3585, 1171, 1484, 3416, 2859, 2470, 3493, 2942,
+                     308, 881, 2784, 486, 1539, 323, 2288, 3264, 1129, 3434, 1625, 418, 2388, 2738, 1133, 1817,
+                     904, 447, 1189, 3133, 171, 1612, 3621, 1829, 1200, 2993, 2069, 45, 2901, 757, 1815, 2164,
+                     516, 2874, 1370, 2227, 2578, 182, 2838, 1543, 575, 3640, 2195, 59, 3082, 1529, 3335, 1804},
+                    {965, 301, 1622, 3983, 3697, 2282, 314, 2922, 1999, 213, 3243, 3946, 1050, 87, 1222, 577,
+                     1711, 3860, 3559, 1969, 3708, 1024, 2712, 3797, 86, 2836, 4068, 1030, 3139, 191, 2229, 3985,
+                     3522, 2308, 1535, 3345, 3895, 2074, 614, 3207, 307, 3954, 2434, 3648, 1048, 3199, 1608, 2706,
+                     947, 3715, 2, 3203, 3993, 694, 3510, 1808, 2534, 3238, 1660, 730, 1080, 3672, 153, 2623},
+                    {3463, 1927, 2932, 578, 860, 1262, 3424, 680, 991, 2619, 1760, 364, 2314, 1584, 3729, 2686,
+                     2118, 2527, 10, 1313, 3349, 2495, 572, 1917, 1497, 2199, 646, 2019, 3760, 1725, 1447, 690,
+                     2983, 2636, 1920, 792, 2773, 1317, 2538, 3436, 996, 1548, 2680, 1880, 541, 2324, 3900, 297,
+                     3495, 1966, 2407, 1637, 980, 2985, 1353, 2332, 412, 1210, 3426, 1952, 2436, 2919, 1293, 2258},
+                    {738, 3219, 1383, 2105, 2754, 1719, 2512, 1522, 2194, 3798, 843, 3138, 2036, 3001, 771, 3257,
+                     1434, 1033, 3140, 684, 2912, 1685, 902, 3028, 276, 3216, 2604, 1336, 2889, 538, 2501, 3261,
+                     1301, 96, 3810, 536, 1058, 3055, 70, 2236, 3781, 701, 226, 3134, 1412, 3391, 1168, 2568,
+                     1489, 607, 3806, 1224, 457, 1926, 3834, 81, 911, 4033, 2679, 1424, 3925, 392, 1692, 3829},
+                    {1161, 203, 2359, 3549, 384, 3252, 4025, 473, 3483, 2786, 1400, 606, 3612, 1810, 251, 3919,
+                     444, 1888, 4078, 2296, 197, 2100, 3972, 3477, 1212, 3670, 846, 335, 3347, 3635, 948, 2087,
+                     378, 1702, 3617, 2431, 1477, 4060, 1722, 1936, 2822, 1268, 3571, 2183, 885, 2774, 110, 2078,
+                     3041, 852, 3318, 2802, 2174, 3606, 2620, 3110, 2072, 2863, 609, 216, 2163, 3160, 555, 2790},
+                    {3616, 1575, 2574, 3801, 1087, 21, 1899, 2974, 1154, 174, 2415, 4053, 1242, 2607, 950, 2362,
+                     3499, 2769, 1632, 830, 3766, 1421, 437, 2559, 1765, 2363, 3930, 1611, 1909, 114, 2755, 4021,
+                     3400, 1120, 3124, 2206, 266, 3525, 482, 820, 2390, 3038, 1678, 446, 4092, 3676, 705, 1773,
+                     3952, 239, 2483, 1756, 133, 763, 1511, 1099, 3326, 1724, 3751, 863, 3552, 1031, 2490, 2045},
+                    {4085, 913, 1811, 676, 3084, 1359, 2326, 775, 3746, 2079, 1706, 2855, 47, 3441, 2151, 1320,
+                     2957, 128, 1162, 3381, 2439, 3111, 1037, 2848, 706, 29, 2148, 1019, 3080, 1233, 2280, 1509,
+                     749, 2674, 2003, 910, 2904, 2590, 3165, 1110, 3943, 158, 3305, 1980, 2467, 1579, 2908, 2254,
+                     3557, 1084, 1422, 3143, 4054, 3415, 2389, 513, 298, 1267, 2305, 3005, 1533, 1850, 3290, 99},
+                    {2980, 493, 3409, 2853, 2013, 3884, 2699, 1603, 3180, 329, 3362, 1046, 534, 3185, 1559, 699,
+                     3702, 2021, 520, 2667, 1807, 254, 3633, 1985, 1540, 3188, 2717, 3451, 2464, 3868, 573, 3034,
+                     1842, 141, 3923, 608, 1636, 1338, 2109, 3664, 1505, 631, 2630, 999, 1215, 356, 3218, 1314,
+                     501, 2713, 2054, 396, 1006, 2890, 1858, 3909, 3584, 2531, 1979, 15, 2655, 3896, 708, 1327},
+                    {2682, 2128, 285, 1485, 981, 189, 3565, 542, 933, 2579, 1439, 3903, 2294, 1844, 3805, 327,
+                     2507, 3232, 1465, 3562, 662, 1318, 2243, 3316, 4052, 546, 1354, 357, 782, 1740, 219, 3674,
+                     2504, 3469, 1241, 3241, 3735, 16, 3374, 353, 1861, 2934, 2144, 3838, 3461, 49, 1946, 924,
+                     3376, 3855, 1674, 3641, 2281, 652, 1377, 2734, 1602, 735, 3191, 3448, 1185, 361, 2286, 1682},
+                    {1004, 3156, 3963, 2264, 2503, 3324, 1259, 2154, 1801, 3683, 2991, 1983, 833, 2693, 3032, 1112,
+                     1763, 892, 4011, 2121, 2979, 3881, 883, 176, 1153, 2954, 3772, 2040, 3580, 2877, 2178, 1027,
+                     1398, 2803, 324, 2344, 1890, 762, 2463, 2745, 927, 3579, 1347, 528, 2997, 2722, 3981, 2347,
+                     2556, 172, 793, 2981, 1234, 214, 2114, 3073, 143, 1041, 4044, 550, 1458, 2924, 3789, 3518},
+                    {1911, 1245, 3637, 808, 1675, 432, 2887, 4006, 2369, 137, 641, 1270, 388, 3590, 154, 3938,
+                     2845, 2328, 35, 1064, 352, 2791, 1671, 2638, 2373, 1870, 932, 2562, 1573, 1195, 3208, 4077,
+                     461, 1694, 2136, 971, 2857, 4028, 1207, 1658, 3888, 127, 2298, 1751, 801, 1426, 1630, 644,
+                     3088, 1857, 1466, 3301, 2605, 3826, 3393, 875, 3659, 2256, 2828, 1862, 2166, 871, 2445, 229},
+                    {2585, 73, 599, 2726, 3779, 1944, 3228, 742, 1141, 3481, 2740, 3292, 2437, 1508, 2176, 1334,
+                     499, 3456, 1617, 3164, 2471, 1924, 3667, 442, 3487, 1506, 68, 3354, 295, 636, 2370, 1955,
+                     841, 3116, 3850, 3526, 1457, 496, 3096, 2214, 685, 3336, 2575, 3153, 3782, 2095, 3614, 291,
+                     1158, 2181, 3706, 526, 2378, 1747, 372, 1939, 2480, 1286, 1672, 264, 3688, 3370, 629, 1574},
+                    {3298, 3030, 1450, 3429, 1071, 112, 1407, 2626, 348, 1571, 2060, 4065, 1736, 968, 3339, 2639,
+                     760, 1886, 3780, 1240, 3372, 773, 1388, 3130, 625, 3997, 2219, 3024, 3844, 2727, 3629, 108,
+                     3412, 2608, 651, 186, 2539, 3294, 267, 1958, 2892, 1275, 425, 1105, 206, 2438, 1011, 3432,
+                     2876, 4069, 20, 941, 2809, 1114, 4010, 1473, 3222, 469, 3858, 2998, 2552, 1144, 2011, 3922},
+                    {454, 2319, 1824, 2116, 2941, 2411, 3926, 1783, 3108, 3739, 810, 8, 3163, 597, 3717, 2012,
+                     3050, 237, 2555, 565, 2255, 97, 3837, 2101, 1115, 2821, 804, 1303, 1668, 956, 1823, 1440,
+                     2929, 1251, 1598, 2024, 1117, 1774, 3699, 1026, 3468, 1565, 4045, 1831, 2825, 3287, 507, 1734,
+                     2627, 1311, 3174, 2068, 1586, 617, 2939, 83, 3492, 2692, 696, 982, 58, 3117, 1364, 2782},
+                    {1038, 713, 4022, 326, 872, 3594, 581, 2218, 977, 2814, 2322, 1208, 2898, 2506, 311, 1134,
+                     3520, 1444, 2915, 4090, 990, 1591, 2963, 2426, 1771, 185, 3270, 1970, 2477, 502, 3984, 2185,
+                     382, 2418, 3596, 3031, 3992, 2330, 809, 2661, 46, 2409, 2051, 3654, 745, 1401, 3916, 2277,
+                     837, 407, 1896, 3551, 3328, 3741, 2248, 821, 2030, 1177, 2317, 3583, 2123, 1780, 354, 3713}
+            },
+            {
+                    {3795, 385, 1699, 2387, 3381, 490, 996, 3773, 1591, 118, 1943, 3446, 1711, 43, 1027, 1523,
+                     2188, 2844, 3935, 2565, 1441, 821, 2911, 1616, 1246, 3037, 366, 969, 2936, 2018, 1252, 3290,
+                     488, 2177, 1729, 2393, 1957, 353, 699, 2314, 2953, 925, 618, 3342, 1380, 3802, 551, 3609,
+                     1081, 28, 3790, 2197, 1944, 1420, 759, 2584, 267, 1535, 900, 2664, 1159, 1408, 2360, 144},
+                    {1525, 2817, 3594, 2062, 2626, 746, 3518, 2024, 1156, 464, 2358, 3728, 762, 2749, 3570, 483,
+                     1312, 2391, 954, 1838, 3607, 214, 2437, 1033, 3373, 105, 1546, 3661, 613, 22, 1461, 781,
+                     3725, 1079, 3375, 879, 3810, 3479, 2117, 4063, 288, 1554, 1994, 2852, 2236, 3042, 819, 2365,
+                     2079, 2678, 3477, 2959, 540, 3597, 2792, 1745, 3700, 2975, 535, 3531, 3827, 672, 3043, 1018},
+                    {2206, 810, 1120, 130, 3046, 1492, 258, 3147, 2575, 3977, 957, 1401, 3053, 2515, 1928, 3798,
+                     3301, 730, 94, 3090, 2750, 621, 4068, 1896, 3804, 2778, 2142, 3244, 1749, 3876, 3122, 2459,
+                     1941, 146, 2868, 586, 3014, 1612, 1265, 3288, 2502, 3703, 1111, 2606, 386, 115, 1571, 4057,
+                     1342, 1791, 261, 1558, 1138, 3317, 134, 982, 2049, 3200, 2312, 1695, 3267, 289, 1897, 3416},
+                    {2675, 3864, 3188, 1355, 4069, 2857, 1794, 3642, 620, 2931, 3367, 2112, 376, 4074, 182, 1641,
+                     2932, 1992, 3671, 1584, 1193, 2104, 3185, 286, 713, 2379, 1337, 838, 2613, 2216, 293, 2809,
+                     1625, 3975, 2531, 1426, 213, 2617, 970, 2, 1801, 3118, 500, 3951, 3575, 1859, 2483, 3358,
+                     420, 3136, 911, 3973, 2544, 1884, 2259, 3923, 651, 1341, 174, 1077, 2101, 2472, 3982, 489},
+                    {1716, 317, 1875, 593, 2173, 2433, 883, 1258, 2202, 1629, 233, 1823, 1217, 2298, 892, 1123,
+                     2637, 406, 3997, 2306, 460, 3468, 1419, 2610, 1733, 3562, 417, 4026, 1160, 3354, 992, 3646,
+                     439, 1243, 3428, 2231, 3926, 1907, 3625, 2761, 738, 1422, 2088, 855, 1288, 3191, 1016, 2835,
+                     629, 3716, 2334, 2760, 684, 1379, 400, 2871, 3456, 2530, 4076, 2753, 835, 1458, 2892, 1263},
+                    {2339, 3550, 2541, 3387, 1040, 422, 3850, 30, 3270, 2708, 729, 3696, 2841, 3177, 582, 3528,
+                     2168, 1365, 3350, 1013, 1797, 2948, 857, 3712, 1119, 3113, 2041, 155, 2963, 1868, 1406, 666,
+                     2125, 3052, 1782, 718, 1117, 3181, 531, 2192, 3893, 3418, 2383, 2973, 1685, 199, 3874, 1973,
+                     1245, 2157, 1661, 109, 3626, 3058, 3750, 1125, 1602, 1852, 463, 3091, 3753, 61, 3627, 725},
+                    {3075, 103, 1543, 2933, 3711, 1652, 1999, 2512, 1427, 3945, 1063, 3429, 1506, 2571, 3905, 1737,
+                     3030, 274, 765, 2734, 2478, 3880, 55, 2260, 554, 2814, 1524, 2520, 526, 3766, 2405, 3505,
+                     2685, 928, 245, 3680, 2429, 314, 2924, 1642, 1197, 148, 365, 2730, 3513, 2229, 744, 2656,
+                     315, 3454, 1069, 3300, 2060, 848, 2408, 1, 2139, 777, 3340, 1221, 1975, 1634, 3283, 983},
+                    {1937, 3960, 1196, 817, 190, 2663, 3098, 3554, 480, 1926, 2268, 157, 434, 1965, 1293, 6,
+                     2410, 3756, 1559, 3203, 210, 1269, 1977, 1633, 3361, 945, 3823, 3442, 796, 1655, 3184, 119,
+                     4051, 1510, 3265, 2820, 2009, 1479, 789, 3293, 2514, 3693, 1949, 1055, 561, 1410, 3638, 3038,
+                     1545, 3959, 2899, 512, 1816, 1501, 3253, 2676, 3901, 2957, 241, 2331, 2616, 549, 2184, 2777},
+                    {3722, 625, 2295, 2089, 3313, 1334, 693, 1114, 2894, 895, 3081, 2450, 3828, 827, 3275, 2785,
+                     1051, 1915, 3488, 2124, 572, 3632, 3027, 4004, 2438, 275, 1857, 1281, 2209, 2834, 344, 1216,
+                     1927, 2328, 522, 3824, 1283, 3472, 4009, 1862, 937, 3064, 1518, 4089, 3299, 2539, 1787, 58,
+                     2406, 799, 1318, 2493, 270, 4041, 1004, 547, 1278, 3568, 1469, 955, 3478, 4000, 220, 1377},
+                    {1743, 388, 3452, 2828, 3887, 1830, 2337, 4028, 107, 1736, 3643, 1188, 1603, 2135, 3577, 663,
+                     3941, 451, 2889, 908, 1443, 2625, 732, 391, 1176, 3245, 2677, 66, 3968, 971, 2066, 3024,
+                     733, 2611, 1723, 196, 985, 2672, 86, 2227, 442, 2775, 701, 2138, 248, 1201, 3836, 967,
+                     1922, 3212, 3732, 2706, 3507, 2199, 2883, 1972, 1715, 2485, 3812, 674, 1831, 3009, 1130, 2435},
+                    {3157, 2593, 1465, 946, 246, 544, 3219, 1551, 2185, 2756, 3368, 558, 2670, 2978, 325, 1464,
+                     2257, 1203, 1717, 4092, 2361, 3397, 1840, 2860, 1502, 2131, 643, 3606, 2372, 3309, 1529, 3871,
+                     3648, 1084, 3400, 2102, 3112, 2368, 642, 3615, 1329, 3868, 1675, 2428, 3163, 2881, 485, 3393,
+                     2270, 601, 153, 1678, 1169, 728, 3686, 191, 3087, 399, 2211, 2802, 1570, 421, 3362, 845},
+                    {91, 4090, 2011, 3036, 1266, 2489, 3480, 349, 3783, 719, 1404, 283, 4056, 960, 1772, 2537,
+                     3227, 2689, 104, 3128, 350, 1056, 2205, 3785, 890, 3918, 2939, 1373, 1734, 413, 605, 2739,
+                     78, 1387, 2943, 816, 3929, 1515, 1739, 2907, 3221, 1104, 29, 3504, 885, 2008, 1618, 2629,
+                     4033, 1436, 2100, 3114, 356, 2366, 1394, 3398, 891, 1134, 3229, 46, 3704, 2003, 2679, 3586},
+                    {1601, 1090, 696, 3816, 1686, 2707, 1947, 1007, 1227, 2554, 1848, 3207, 2344, 1986, 3430, 212,
+                     3619, 833, 3793, 1988, 1343, 3590, 27, 1659, 3170, 240, 1969, 1074, 3109, 2564, 3523, 1834,
+                     2170, 2455, 358, 3558, 478, 1139, 3352, 2053, 341, 2594, 1844, 3799, 615, 1371, 3651, 338,
+                     1091, 2866, 874, 3865, 3330, 2751, 1842, 3845, 2592, 2073, 4047, 1360, 2350, 726, 1272, 2207},
+                    {321, 2771, 2400, 3560, 15, 822, 3720, 2915, 3144, 2082, 3863, 44, 1129, 3735, 737, 1319,
+                     2096, 1610, 545, 2492, 2965, 691, 2748, 2389, 541, 2583, 3485, 766, 141, 4066, 1172, 910,
+                     3261, 3815, 1646, 1912, 2770, 2521, 163, 4025, 773, 2271, 1471, 2995, 2352, 2746, 172, 3093,
+                     1792, 3580, 2557, 1946, 1020, 1555, 610, 127, 2969, 1597, 504, 3455, 1012, 2855, 3937, 1873},
+                    {3658, 3287, 506, 2126, 3195, 1493, 2284, 578, 184, 3541, 866, 2789, 1457, 3088, 461, 2842,
+                     3894, 3055, 975, 3363, 1783, 3748, 1186, 3298, 1416, 1799, 3742, 2807, 2302, 2056, 1439, 2917,
+                     228, 698, 1255, 3045, 2194, 3772, 1413, 1009, 2716, 3706, 452, 3284, 1048, 3878, 2164, 1282,
+                     2397, 710, 25, 476, 2984, 4011, 2186, 1242, 3566, 778, 1901, 2545, 3094, 159, 562, 3023},
+                    {931, 1403, 1774, 1184, 2845, 284, 4045, 1332, 1758, 2427, 1577, 623, 2158, 2598, 1700, 2382,
+                     158, 1153, 2278, 259, 1486, 2057, 171, 4040, 942, 2189, 1249, 304, 1620, 3401, 508, 3694,
+                     2363, 2655, 3987, 48, 905, 628, 1802, 3129, 3483, 1961, 1268, 135, 1718, 785, 3386, 534,
+                     3983, 3215, 1611, 3473, 1339, 2486, 331, 3183, 2313, 2772, 362, 3787, 1750, 3348, 1538, 2507},
+                    {2263, 168, 3981, 3443, 988, 1878, 2619, 3394, 3051, 426, 3963, 3315, 3641, 1001, 4014, 3389,
+                     1913, 2683, 3532, 3970, 2853, 859, 2627, 3516, 3026, 450, 3250, 3933, 2496, 843, 3141, 1726,
+                     1966, 1053, 3411, 1581, 3240, 3630, 2377, 313, 1605, 581, 2856, 3966, 2086, 2599, 1536, 2901,
+                     1919, 1144, 2252, 3779, 2039, 747, 3674, 1707, 958, 3962, 1449, 1110, 2152, 764, 1207, 3768},
+                    {436, 2989, 2576, 612, 2364, 3614, 749, 2165, 943, 1164, 2887, 1828, 340, 122, 1262, 596,
+                     1534, 776, 409, 1275, 3151, 611, 2256, 335, 1573, 1998, 670, 2902, 1083, 0, 3885, 2732,
+                     375, 1385, 2233, 516, 2831, 2034, 1128, 2983, 2508, 893, 2238, 3591, 3158, 296, 984, 3687,
+                     156, 2668, 894, 2816, 227, 1097, 3374, 2882, 56, 2032, 3264, 255, 2412, 3525, 2737, 2022},
+                    {3231, 839, 1938, 1552, 2934, 403, 1654, 3884, 106, 1997, 2567, 1368, 2288, 3178, 2021, 2913,
+                     3689, 3239, 2119, 2534, 1643, 3854, 1882, 1147, 2456, 3650, 2671, 1482, 1880, 2254, 1290, 3547,
+                     802, 3085, 3678, 2548, 235, 1325, 3794, 114, 4079, 3371, 1491, 1177, 689, 1832, 3476, 2447,
+                     1415, 414, 3338, 1746, 3061, 2563, 1898, 1405, 637, 2639, 3612, 2942, 539, 4065, 32, 1691},
+                    {3822, 3510, 1257, 3927, 59, 3176, 1304, 2766, 3260, 3754, 655, 3588, 807, 2693, 3846, 2424,
+                     932, 50, 1821, 3587, 964, 154, 3406, 2962, 3976, 95, 920, 3321, 3749, 2986, 614, 2081,
+                     251, 4029, 1696, 989, 1870, 3440, 770, 2129, 1756, 428, 2634, 10, 2819, 2292, 493, 3819,
+                     3119, 2127, 3921, 622, 1473, 4085, 458, 3792, 2381, 1171, 1626, 899, 1864, 3106, 1475, 1070},
+                    {2338, 226, 2654, 2105, 1076, 3668, 2276, 518, 1490, 2376, 299, 3044, 1580, 1092, 440, 1720,
+                     1376, 4067, 2799, 509, 2329, 1432, 2711, 717, 1763, 1361, 2347, 514, 297, 1615, 2558, 3259,
+                     1526, 2401, 2946, 673, 3888, 2697, 1453, 3257, 2880, 993, 3655, 1974, 3932, 1340, 2958, 1679,
+                     743, 1204, 2417, 3506, 121, 2279, 871, 3099, 3444, 201, 3902, 2265, 1292, 2555, 690, 2867},
+                    {496, 1424, 721, 3349, 1778, 2497, 850, 1909, 3493, 1037, 1790, 4022, 2137, 3307, 3552, 221,
+                     3124, 2228, 1137, 3041, 3796, 3254, 2085, 382, 1064, 3168, 3522, 2118, 4082, 1140, 3438, 935,
+                     2806, 1206, 126, 2151, 3102, 364, 2325, 568, 1233, 2430, 3189, 1594, 842, 3380, 1038, 2043,
+                     75, 2786, 1596, 1023, 1980, 2743, 1287, 1694, 2113, 768, 2784, 3234, 302, 3652, 3378, 2130},
+                    {1883, 3154, 3719, 2803, 294, 3070, 4080, 151, 2961, 2638, 1286, 8, 2824, 584, 1891, 2590,
+                     742, 3474, 1598, 295, 814, 1239, 3629, 2510, 3838, 1917, 2836, 797, 2723, 1820, 80, 3710,
+                     1960, 542, 3583, 3369, 1113, 1599, 3624, 3952, 1853, 225, 3840, 597, 2351, 203, 2621, 4050,
+                     3208, 3621, 332, 3002, 3743, 3273, 306, 3660, 2573, 1478, 515, 1951, 1017, 1719, 137, 4008},
+                    {898, 2402, 1628, 997, 590, 1541, 1199, 2123, 687, 3842, 3407, 840, 2466, 1455, 3948, 1226,
+                     2078, 2740, 608, 2460, 1976, 1684, 39, 2994, 592, 1451, 257, 1244, 3110, 2442, 716, 2282,
+                     3911, 1351, 1779, 2501, 882, 2019, 49, 2641, 824, 2954, 1381, 2095, 3097, 3574, 432, 1837,
+                     1294, 2239, 828, 2527, 1777, 694, 1127, 2910, 64, 4034, 3343, 3018, 3780, 2426, 2752, 1189},
+                    {3490, 337, 3940, 2028, 3534, 2623, 3767, 3218, 1690, 446, 2266, 1985, 3708, 327, 2920, 917,
+                     3746, 89, 3890, 3339, 2900, 4017, 2210, 952, 3465, 2293, 3953, 1692, 3762, 423, 1498, 3179,
+                     234, 2997, 2687, 307, 4060, 2908, 1313, 3496, 2220, 3388, 372, 1709, 2738, 1187, 1550, 2499,
+                     565, 3434, 3860, 1417, 497, 3949, 2399, 2023, 927, 1788, 2234, 1353, 401, 780, 1557, 2982},
+                    {1372, 2586, 81, 2916, 2248, 1331, 263, 2420, 1021, 2808, 1389, 3115, 1087, 3285, 2311, 1742,
+                     3199, 1497, 1861, 1028, 1345, 2669, 449, 1560, 3235, 2601, 139, 2035, 1002, 3563, 2615, 2065,
+                     820, 1623, 3656, 682, 2354, 3225, 524, 1657, 1085, 2553, 3672, 951, 3994, 748, 2996, 3737,
+                     963, 1954, 193, 2703, 2144, 3395, 1326, 3153, 3514, 634, 1089, 2636, 3544, 2093, 3900, 583},
+                    {1914, 3314, 1154, 1712, 466, 3383, 745, 1940, 3608, 187, 4003, 645, 1636, 164, 3613, 529,
+                     2540, 370, 2253, 3654, 218, 681, 3549, 1836, 1190, 763, 2952, 3322, 600, 2827, 1285, 4031,
+                     1062, 3269, 2162, 1192, 1508, 1903, 3714, 200, 3142, 640, 1958, 166, 3263, 2251, 36, 2106,
+                     2805, 3126, 1665, 1058, 2960, 101, 1609, 343, 2747, 3723, 198, 2929, 1670, 3, 3145, 2281},
+                    {3640, 760, 3080, 3739, 912, 3979, 2696, 3034, 1568, 3308, 2488, 1860, 2686, 2149, 800, 1359,
+                     2796, 1136, 2977, 830, 3166, 2369, 3807, 2793, 2132, 346, 3675, 1386, 2326, 1889, 23, 3467,
+                     2386, 441, 2884, 90, 3869, 978, 2718, 2181, 3969, 1480, 2851, 2448, 1308, 1786, 3883, 342,
+                     1452, 700, 3297, 4042, 2342, 870, 3784, 2506, 1921, 1429, 2316, 3961, 1259, 941, 2542, 427},
+                    {1057, 2744, 2167, 1503, 2384, 1818, 33, 1135, 2208, 877, 398, 1215, 3818, 3005, 3409, 4086,
+                     1929, 3320, 3914, 1663, 2031, 1437, 1043, 83, 4055, 2498, 923, 1631, 3936, 392, 3029, 1755,
+                     630, 3800, 1950, 3359, 2528, 381, 3013, 784, 1807, 1181, 3806, 487, 3519, 2632, 1094, 3414,
+                     2380, 3634, 1251, 455, 1850, 3533, 658, 1163, 3021, 492, 823, 3222, 2038, 3385, 3841, 1771},
+                    {271, 4070, 131, 607, 3277, 2846, 1411, 3882, 557, 3669, 2870, 3489, 65, 1460, 977, 253,
+                     2416, 648, 21, 2643, 502, 3399, 3000, 1713, 3310, 1953, 3161, 2720, 1132, 3379, 869, 2522,
+                     1542, 2755, 1309, 829, 1676, 3545, 1364, 2425, 3331, 303, 3068, 2052, 1578, 865, 3092, 552,
+                     1704, 2589, 133, 2090, 1414, 2652, 3206, 2120, 4030, 3451, 1819, 2469, 247, 644, 2829, 1409},
+                    {3441, 2480, 2001, 1247, 3589, 374, 2071, 2533, 3107, 1724, 2002, 2327, 697, 2587, 2091, 1775,
+                     3718, 1306, 2176, 3595, 936, 2479, 273, 1253, 668, 1470, 510, 219, 2180, 3837, 1993, 1209,
+                     3537, 305, 2247, 3992, 3171, 585, 2076, 13, 3596, 987, 2235, 720, 117, 4077, 2874, 1990,
+                     3832, 837, 3028, 2798, 3922, 249, 1698, 968, 54, 1537, 2783, 1109, 3645, 1592, 2245, 3019},
+                    {811, 1572, 3825, 2620, 3001, 1045, 708, 3450, 179, 1303, 1008, 4016, 1593, 3201, 2832, 431,
+                     3063, 1047, 1561, 2864, 4006, 1886, 3515, 2291, 3898, 2919, 3553, 2421, 735, 2877, 125, 3134,
+                     3755, 1029, 2980, 138, 1877, 1088, 2859, 4039, 1548, 2559, 2788, 3717, 3312, 2324, 1378, 211,
+                     1208, 2262, 3691, 1031, 3344, 564, 2439, 2909, 2283, 412, 3829, 758, 3096, 1963, 469, 1180},
+                    {3232, 1854, 323, 881, 1673, 4024, 2340, 1540, 3757, 2725, 311, 3329, 513, 1175, 3848, 787,
+                     3453, 2551, 3248, 188, 731, 1349, 2754, 404, 886, 2063, 1781, 3702, 1284, 1681, 2600, 520,
+                     2128, 707, 2444, 1567, 2688, 3665, 2297, 751, 1762, 519, 1298, 1863, 1044, 1648, 2536, 447,
+                     3392, 1826, 667, 1583, 2004, 1333, 3857, 3572, 1214, 3292, 2602, 1383, 120, 3978, 2645, 3740},
+                    {2390, 580, 2818, 2217, 3365, 143, 1892, 3204, 832, 2163, 2988, 1841, 2454, 3573, 132, 1658,
+                     2294, 1970, 367, 3814, 1764, 2133, 3197, 3724, 1148, 2612, 38, 3220, 966, 4091, 1485, 3346,
+                     1835, 1350, 3919, 3435, 465, 1260, 206, 3256, 2990, 3445, 3891, 347, 3156, 619, 3556, 3909,
+                     2727, 3213, 16, 2523, 402, 3132, 852, 1858, 662, 1644, 2097, 3503, 2309, 1731, 1015, 183},
+                    {3464, 1440, 3125, 3688, 1344, 523, 2905, 1185, 2607, 604, 3934, 1418, 873, 2196, 2702, 1396,
+                     4038, 602, 1213, 3015, 2419, 1022, 102, 1638, 2375, 3461, 1428, 371, 2992, 2275, 280, 3623,
+                     2726, 173, 3180, 915, 2055, 3858, 2509, 1444, 901, 2016, 72, 2651, 2159, 2891, 889, 2047,
+                     1450, 1099, 2927, 4061, 3499, 2222, 149, 2665, 3733, 266, 2970, 862, 525, 3278, 2888, 2045},
+                    {1211, 3993, 40, 1060, 2013, 2516, 3917, 287, 3491, 1683, 11, 3659, 3121, 1959, 290, 2972,
+                     938, 3539, 2779, 1504, 3384, 533, 3985, 3086, 591, 798, 3947, 2762, 1894, 646, 2468, 841,
+                     1116, 2897, 2226, 1688, 653, 3040, 1827, 408, 3631, 1126, 2353, 1483, 3670, 1228, 1754, 268,
+                     2404, 740, 2154, 1740, 1165, 2780, 1512, 3069, 2017, 1050, 4044, 2511, 1267, 3852, 1532, 715},
+                    {2178, 2591, 1773, 2735, 741, 3582, 1466, 921, 2083, 2407, 1264, 2759, 467, 1098, 3896, 3333,
+                     1833, 57, 2074, 803, 3644, 2560, 1399, 2850, 2026, 1721, 3325, 2183, 1179, 3751, 3062, 2029,
+                     4001, 1463, 373, 3734, 2642, 1036, 3417, 2182, 2719, 2937, 3956, 794, 3323, 169, 3991, 3007,
+                     3769, 3437, 322, 3709, 574, 933, 3954, 435, 2371, 1367, 3210, 24, 1906, 2728, 355, 3601},
+                    {238, 904, 3833, 411, 3078, 2258, 1798, 3291, 3826, 2935, 736, 3405, 1727, 2538, 688, 1297,
+                     2373, 2614, 3765, 244, 2221, 1867, 301, 1231, 3603, 178, 1049, 481, 1589, 3447, 68, 1747,
+                     555, 3511, 2398, 3318, 35, 1315, 4049, 264, 1617, 616, 1809, 430, 2476, 1956, 2603, 537,
+                     1010, 1606, 2649, 1354, 3242, 2481, 1785, 3382, 3593, 594, 1697, 2193, 3666, 959, 3057, 2462},
+                    {3336, 2951, 1517, 3421, 1230, 116, 2787, 475, 1108, 189, 1531, 4075, 2301, 3211, 3741, 1566,
+                     482, 3123, 1666, 1174, 3205, 913, 2724, 3847, 2300, 2976, 2494, 3808, 2657, 1374, 930, 3243,
+                     2574, 1220, 804, 1895, 1579, 2847, 2423, 831, 3788, 1356, 3065, 3495, 1039, 1556, 3255, 1310,
+                     2287, 3135, 1890, 176, 2111, 2941, 79, 1224, 818, 2862, 2631, 309, 3410, 649, 1624, 1872},
+                    {1149, 528, 2059, 2388, 1671, 4037, 676, 2464, 3172, 1869, 2150, 976, 394, 85, 2010, 2878,
+                     1065, 3873, 635, 2922, 4064, 454, 1608, 3304, 656, 1839, 860, 3152, 231, 2319, 2838, 3879,
+                     2161, 165, 3120, 3910, 2134, 577, 3146, 1979, 3295, 2296, 87, 2080, 2811, 680, 3592, 45,
+                     2854, 809, 4021, 3620, 702, 1494, 3861, 2255, 1924, 3791, 1468, 1115, 3924, 2345, 1358, 4093},
+                    {2795, 753, 3763, 3187, 962, 3653, 2020, 1338, 3759, 3501, 2624, 3073, 1375, 3542, 846, 2225,
+                     185, 3415, 1989, 1434, 2356, 3475, 2087, 1100, 108, 1484, 4020, 2036, 3520, 712, 1932, 438,
+                     1509, 3697, 2712, 986, 348, 3611, 1232, 180, 1005, 2622, 3726, 1254, 4094, 2250, 1793, 3872,
+                     2064, 378, 1191, 2374, 3345, 1052, 2731, 383, 3060, 215, 3279, 2068, 2904, 419, 3174, 67},
+                    {2230, 2556, 1407, 160, 387, 2635, 2981, 1588, 863, 269, 632, 3916, 1805, 2974, 2659, 3667,
+                     1708, 2461, 934, 2763, 18, 755, 2570, 3077, 3571, 2684, 1152, 397, 1701, 1296, 3605, 1095,
+                     2964, 1714, 664, 1390, 3003, 2546, 3974, 1817, 3538, 1527, 363, 903, 3175, 300, 1448, 961,
+                     3402, 2692, 1680, 3031, 507, 1991, 3529, 1639, 2529, 995, 686, 2432, 1732, 878, 1964, 3470},
+                    {1035, 1767, 3555, 2896, 1899, 1157, 3439, 42, 2272, 2848, 1248, 2411, 484, 1103, 1495, 324,
+                     3988, 1277, 3286, 390, 3662, 1744, 1323, 3955, 532, 2232, 2873, 3372, 2413, 3025, 3964, 260,
+                     2470, 3356, 2015, 2343, 3448, 1640, 757, 2764, 517, 2987, 2392, 1689, 576, 2646, 3010, 2491,
+                     606, 3761, 1421, 239, 2581, 3930, 856, 3190, 1352, 4052, 3391, 93, 3602, 1256, 2673, 3875},
+                    {230, 472, 4005, 2198, 815, 2367, 530, 3111, 3995, 2050, 1664, 3327, 3797, 2114, 3237, 754,
+                     2813, 553, 1865, 2153, 3886, 2971, 956, 1934, 242, 1637, 3745, 671, 37, 974, 2691, 2219,
+                     851, 503, 4073, 73, 1118, 298, 2249, 1330, 2121, 3276, 3928, 1925, 3436, 3683, 161, 1141,
+                     1871, 3165, 906, 2241, 1784, 1295, 12, 588, 2148, 1843, 2774, 1520, 3811, 3049, 567, 1565},
+                    {3332, 3076, 1250, 1595, 3258, 3820, 1384, 1810, 1059, 3604, 330, 919, 2578, 175, 1910, 2285,
+                     3033, 3578, 2604, 1075, 1487, 316, 2333, 3246, 2504, 847, 1336, 2109, 3238, 1499, 1847, 3458,
+                     1322, 3149, 2758, 1874, 3736, 3230, 2928, 3856, 4, 1078, 722, 2825, 1302, 2115, 1563, 2317,
+                     3546, 99, 4002, 2765, 3296, 3695, 2895, 2414, 3565, 433, 1161, 2274, 308, 772, 2110, 2482},
+                    {853, 1931, 2658, 624, 217, 2773, 3564, 2547, 723, 2736, 3169, 1445, 675, 3431, 3904, 1168,
+                     74, 1619, 805, 3155, 3449, 2823, 633, 3801, 3492, 3056, 1885, 4062, 2552, 556, 3859, 145,
+                     1662, 3777, 965, 1489, 566, 2477, 876, 1955, 3576, 1467, 2566, 202, 991, 4015, 3224, 792,
+                     2863, 2084, 1218, 445, 685, 2054, 1093, 1672, 3892, 3011, 909, 2579, 3214, 1806, 2858, 3677},
+                    {2318, 1101, 3866, 3497, 2042, 999, 416, 1547, 192, 1916, 2323, 3738, 2903, 1645, 950, 2445,
+                     1369, 4088, 462, 2246, 140, 2007, 1145, 1533, 84, 1067, 368, 3585, 1167, 2837, 786, 2033,
+                     2938, 352, 2588, 2175, 3598, 1702, 1173, 407, 2357, 1780, 3771, 3082, 357, 2434, 536, 3831,
+                     319, 1635, 2503, 3486, 1496, 3108, 256, 2618, 1402, 124, 2005, 3487, 4018, 1291, 167, 1442},
+                    {395, 2956, 7, 2458, 1728, 3054, 4078, 2169, 3302, 3895, 1273, 52, 2145, 369, 3649, 2768,
+                     3337, 1851, 3699, 2517, 1299, 3912, 2704, 1813, 2218, 2926, 2661, 1575, 194, 2200, 3194, 3664,
+                     2336, 1222, 703, 3103, 113, 2821, 3957, 3419, 2993, 626, 3316, 1604, 2027, 2781, 1804, 1395,
+                     1024, 3039, 3727, 1856, 953, 3972, 2286, 795, 3306, 3721, 665, 1627, 498, 994, 3377, 3946},
+                    {709, 1562, 3236, 1328, 788, 2304, 1202, 2865, 907, 550, 3032, 1072, 2647, 1824, 3127, 575,
+                     237, 2094, 2955, 929, 1693, 3557, 769, 3355, 543, 3938, 813, 2359, 3424, 1760, 1011, 494,
+                     1462, 3502, 3999, 1984, 3341, 1366, 771, 2597, 150, 1271, 2215, 864, 3471, 1198, 3628, 2595,
+                     3271, 2237, 589, 63, 2690, 3390, 393, 1902, 2791, 1066, 2187, 2921, 2452, 1945, 2699, 2172},
+                    {3530, 2609, 1893, 3701, 501, 3360, 110, 3616, 1759, 2473, 1590, 3484, 4036, 1320, 808, 2330,
+                     1549, 1106, 660, 3223, 216, 2879, 351, 2465, 1412, 3676, 2000, 443, 2968, 1362, 3944, 2535,
+                     2776, 236, 1776, 1061, 328, 2264, 1630, 2048, 1019, 4071, 2666, 424, 3907, 41, 706, 1982,
+                     223, 4059, 1305, 2923, 2146, 1166, 1544, 3805, 2396, 186, 3173, 1454, 3851, 69, 3074, 1722},
+                    {3776, 948, 278, 2794, 3939, 1505, 2628, 1971, 320, 3830, 761, 2280, 468, 2051, 3268, 3942,
+                     2550, 3500, 3855, 1447, 2305, 3984, 2103, 1026, 3262, 1674, 1237, 3160, 3789, 683, 14, 1920,
+                     3305, 826, 2999, 2457, 2714, 3889, 491, 3196, 3548, 1822, 2876, 1433, 3162, 2341, 2967, 1553,
+                     3413, 880, 2441, 1677, 750, 3635, 3022, 573, 1752, 3512, 1225, 318, 3600, 825, 1162, 538},
+                    {2409, 2067, 1234, 3012, 2141, 1042, 639, 3138, 1370, 2742, 3324, 229, 2966, 979, 1710, 334,
+                     2840, 5, 1911, 2680, 505, 1178, 1849, 3035, 53, 2605, 254, 916, 2709, 2107, 3543, 1158,
+                     2244, 1586, 3782, 1307, 659, 3637, 2940, 1456, 2395, 232, 595, 2099, 990, 1753, 3817, 1102,
+                     2715, 418, 1923, 3915, 3209, 147, 2495, 1346, 4053, 867, 2650, 1846, 2240, 2812, 3281, 1400},
+                    {4007, 3404, 695, 136, 1649, 2519, 3469, 3770, 939, 2122, 1210, 1876, 3636, 2710, 1435, 3747,
+                     1229, 2191, 782, 3140, 3423, 1569, 3760, 669, 3618, 2269, 4023, 1825, 2418, 1514, 384, 3067,
+                     4081, 521, 129, 3462, 1888, 914, 34, 1155, 3839, 790, 3353, 3617, 2532, 292, 560, 2190,
+                     3715, 3101, 1446, 3524, 336, 2014, 1006, 2861, 429, 2092, 3370, 657, 3965, 1647, 2549, 359},
+                    {3104, 1761, 2315, 3633, 3228, 345, 1845, 2348, 26, 3016, 3971, 652, 2355, 97, 3351, 598,
+                     3059, 1765, 3690, 1000, 177, 2525, 2790, 896, 1357, 2890, 479, 3408, 1086, 3730, 2822, 1730,
+                     947, 2662, 2058, 2370, 3150, 1669, 2195, 2640, 1968, 3047, 1653, 1311, 4013, 2757, 3216, 1289,
+                     98, 2561, 617, 1142, 2289, 2674, 1613, 3707, 3139, 2320, 1521, 2991, 456, 1003, 1983, 92},
+                    {1507, 888, 2698, 1335, 4048, 801, 1183, 2797, 546, 1682, 1459, 2572, 1082, 3877, 2098, 887,
+                     2449, 410, 1398, 2362, 2006, 4043, 329, 2156, 3494, 1933, 1587, 641, 3202, 100, 774, 2500,
+                     3272, 1388, 3685, 1096, 361, 2833, 4019, 3426, 272, 1041, 2453, 123, 1908, 872, 1585, 3569,
+                     2072, 1789, 924, 2839, 3813, 3433, 791, 1814, 252, 1105, 17, 3786, 1317, 3482, 3713, 2906},
+                    {603, 3862, 1952, 486, 2885, 2223, 1488, 3843, 3581, 3193, 209, 3509, 1803, 3133, 1600, 2660,
+                     3460, 3920, 2914, 3289, 609, 1280, 1751, 3217, 128, 2467, 1182, 3809, 2224, 1430, 2030, 3521,
+                     250, 647, 2947, 1539, 3335, 714, 1276, 527, 1511, 2804, 3758, 3280, 459, 2945, 2322, 724,
+                     3931, 3017, 3319, 1574, 51, 1300, 548, 3274, 3925, 2608, 1948, 2767, 2378, 752, 2136, 1133},
+                    {2431, 3328, 170, 1080, 3498, 3095, 265, 1995, 2487, 861, 2166, 2912, 783, 474, 1270, 243,
+                     1936, 1122, 71, 1622, 2633, 3599, 2949, 1032, 3899, 793, 3071, 2644, 285, 2985, 3980, 1223,
+                     1855, 3867, 2174, 152, 3775, 2524, 1815, 2332, 3567, 2040, 678, 2203, 1200, 3834, 3357, 1073,
+                     312, 2422, 444, 4072, 1935, 2204, 2893, 2415, 1425, 3561, 897, 3079, 1668, 197, 3247, 2667},
+                    {380, 3684, 1607, 2108, 2568, 1738, 704, 3294, 1071, 1327, 4084, 339, 2741, 3752, 2299, 3986,
+                     2830, 711, 2242, 3774, 858, 425, 2310, 1481, 2729, 396, 2044, 3376, 1741, 973, 2346, 453,
+                     3130, 2440, 1014, 2733, 1981, 875, 3186, 3849, 326, 922, 3089, 1431, 1800, 2543, 204, 1996,
+                     1472, 2769, 1241, 767, 2580, 3657, 1054, 354, 2070, 636, 1238, 405, 3412, 4087, 1382, 1811},
+                    {2261, 1212, 2801, 3967, 944, 96, 3897, 2717, 448, 1887, 2385, 3403, 1423, 2012, 3311, 949,
+                     1522, 3536, 1812, 3084, 1235, 3427, 1905, 661, 3679, 1650, 4054, 1314, 571, 3647, 2875, 1582,
+                     806, 3457, 1703, 511, 3584, 1170, 77, 2918, 1705, 2569, 4083, 20, 3517, 563, 2705, 1706,
+                     3466, 3764, 2140, 3167, 1687, 222, 3006, 3996, 1735, 3182, 3853, 2267, 1900, 570, 940, 3020},
+                    {3535, 775, 3164, 559, 1393, 2335, 3610, 1530, 3004, 3778, 60, 1667, 1131, 627, 2490, 111,
+                     3192, 499, 2562, 282, 2069, 3881, 162, 3251, 1112, 2394, 47, 902, 2585, 1939, 112, 3913,
+                     2681, 195, 1324, 4035, 3072, 1500, 2214, 631, 1301, 3366, 1068, 2307, 2886, 884, 3950, 3137,
+                     677, 88, 980, 3579, 569, 3364, 1519, 836, 2518, 142, 2721, 1513, 2898, 2484, 3803, 76},
+                    {1474, 1770, 291, 3420, 1942, 2925, 1146, 2147, 638, 2582, 981, 3159, 3673, 2950, 1757, 3622,
+                     2143, 1363, 4058, 1025, 2815, 1564, 2513, 3008, 2116, 3559, 2826, 3148, 2201, 3425, 1391, 1107,
+                     2075, 3252, 2277, 2849, 281, 2451, 3432, 3943, 2713, 1930, 437, 3681, 1614, 2061, 1348, 1121,
+                     2403, 2930, 1879, 1392, 2321, 2701, 1195, 3744, 2155, 3463, 998, 276, 3639, 1124, 2046, 2700},
+                    {4010, 2179, 2463, 3705, 2653, 812, 379, 3347, 1766, 3540, 2077, 277, 2648, 415, 844, 1194,
+                     2694, 2998, 779, 2349, 3326, 587, 1321, 926, 262, 1808, 1438, 470, 3844, 692, 3066, 2505,
+                     3692, 599, 1881, 756, 1030, 1660, 2037, 849, 207, 1476, 3050, 727, 3266, 333, 3731, 2212,
+                     473, 3998, 2630, 279, 3835, 2025, 70, 2843, 679, 1829, 1347, 3282, 739, 1621, 3117, 495},
+                    {1261, 2944, 1046, 9, 1576, 3116, 4032, 205, 1316, 834, 3906, 1477, 2243, 4012, 1904, 3821,
+                     208, 1651, 1967, 3698, 19, 1768, 3958, 2682, 3729, 734, 3303, 1143, 1632, 224, 1795, 918,
+                     310, 1528, 3508, 3908, 2596, 3663, 477, 3198, 3781, 2471, 2171, 1205, 2745, 2526, 181, 3422,
+                     1516, 1748, 3334, 868, 3048, 1034, 1656, 3527, 471, 3083, 2446, 4027, 2213, 360, 3396, 854},
+                    {1962, 3241, 654, 3903, 1279, 1866, 2273, 2800, 2475, 3233, 2869, 579, 1240, 3100, 2436, 3249,
+                     650, 3459, 389, 1150, 3143, 2160, 3481, 457, 2308, 1987, 3990, 2443, 2695, 3551, 2303, 4095,
+                     2722, 2979, 1219, 62, 3131, 1397, 2782, 1151, 1769, 3526, 82, 3989, 1725, 972, 1918, 2810,
+                     3105, 705, 1274, 2474, 377, 4046, 3226, 2290, 1236, 3870, 1978, 31, 2872, 1796, 3682, 2577}
+            },
+            {
+                    {2753, 1816, 836, 3263, 3947, 381, 2476, 1410, 3443, 2324, 1026, 658, 1961, 2795, 343, 2623,
+                     3763, 59, 2356, 2905, 800, 2538, 229, 3716, 690, 1098, 2808, 3875, 3196, 2567, 1574, 424,
+                     852, 2342, 3130, 1003, 45, 2978, 1952, 2293, 3318, 2657, 967, 3496, 597, 3920, 2139, 1418,
+                     3856, 1144, 2993, 1538, 612, 2772, 909, 3532, 1544, 2161, 2503, 825, 1460, 1698, 3387, 57},
+                    {620, 3624, 1349, 2013, 1021, 1713, 693, 1179, 89, 3783, 1520, 2550, 142, 3510, 1419, 723,
+                     1799, 1006, 3610, 432, 2104, 1263, 1745, 2310, 1967, 3053, 1708, 866, 2298, 41, 4036, 2762,
+                     2032, 3369, 515, 3999, 1264, 2435, 881, 3535, 1604, 77, 3177, 2325, 2786, 1093, 130, 2631,
+                     3448, 377, 2509, 824, 3985, 1728, 90, 2652, 3745, 206, 3863, 3314, 503, 2385, 3887, 2125},
+                    {1562, 4068, 2496, 150, 3127, 2860, 3872, 1925, 2996, 2145, 516, 3628, 3200, 941, 2099, 3994,
+                     3316, 2518, 1483, 3907, 3349, 2769, 556, 3250, 4031, 158, 471, 3441, 2107, 1057, 3608, 1303,
+                     2467, 191, 1508, 1890, 3290, 1722, 3883, 233, 1115, 2094, 3820, 1750, 1307, 3623, 1870, 542,
+                     964, 2198, 3186, 1966, 3626, 3298, 2430, 1090, 2897, 669, 1331, 2035, 2799, 274, 3184, 993},
+                    {2270, 2998, 463, 3427, 2188, 532, 3561, 2601, 345, 3354, 1809, 1313, 2291, 2941, 1632, 238,
+                     2864, 536, 1959, 904, 137, 3683, 1576, 962, 2446, 1367, 3774, 2649, 661, 1454, 3012, 1778,
+                     740, 3785, 2902, 2595, 648, 323, 3090, 1468, 2527, 2907, 502, 826, 282, 2459, 3270, 2967,
+                     4060, 1764, 20, 1202, 459, 1358, 2146, 403, 1883, 1647, 3013, 3593, 1140, 1862, 765, 2868},
+                    {107, 1181, 1769, 810, 1498, 1245, 2338, 938, 1629, 2754, 1085, 4091, 771, 444, 3682, 1129,
+                     2202, 1308, 3111, 2678, 2260, 1178, 3015, 296, 2871, 2062, 1162, 3285, 1868, 3931, 244, 3188,
+                     980, 3552, 2237, 1110, 3459, 2140, 2765, 3627, 685, 1892, 3429, 3057, 3945, 1575, 2060, 778,
+                     1481, 2709, 3760, 2311, 2928, 686, 3494, 3121, 4040, 2353, 957, 36, 3964, 2535, 1427, 3754},
+                    {1980, 3579, 2596, 3777, 2761, 4023, 1, 3167, 734, 3835, 253, 3060, 2663, 1906, 2449, 3232,
+                     3810, 84, 3508, 1619, 663, 3974, 1926, 3450, 784, 3621, 1626, 99, 2846, 2334, 534, 2609,
+                     1989, 397, 1390, 103, 3853, 942, 1295, 431, 4085, 2227, 1381, 2606, 1060, 64, 2838, 3665,
+                     348, 1099, 3404, 1618, 2602, 3912, 1477, 835, 283, 3381, 2689, 600, 2166, 3488, 327, 3307},
+                    {577, 918, 3104, 219, 2039, 3304, 1849, 1403, 3673, 2425, 2052, 1540, 53, 3475, 1388, 590,
+                     2727, 839, 1824, 2463, 3194, 211, 1397, 2618, 2276, 585, 3131, 2521, 873, 3666, 1226, 3413,
+                     1588, 4053, 2783, 1781, 3034, 1965, 2407, 1660, 3222, 911, 329, 1703, 3589, 646, 2246, 1290,
+                     2408, 3066, 625, 917, 216, 1841, 2794, 2053, 1241, 3798, 1514, 1803, 3055, 1271, 1706, 2682},
+                    {2206, 1354, 1628, 2368, 694, 429, 1049, 2223, 2889, 571, 1242, 3297, 890, 3937, 1742, 1025,
+                     2054, 4049, 322, 3653, 1037, 2119, 3822, 1686, 379, 1080, 4094, 1409, 408, 1717, 2121, 2920,
+                     689, 2288, 3278, 823, 486, 3677, 2695, 11, 1169, 3541, 2820, 2393, 3198, 1872, 4002, 3337,
+                     182, 1934, 3871, 2118, 3257, 1076, 3663, 87, 2556, 2230, 451, 3281, 815, 2421, 1023, 3825},
+                    {3208, 271, 3938, 1153, 3684, 3023, 2577, 3432, 148, 1678, 3544, 2561, 2168, 2828, 407, 2358,
+                     3081, 1494, 2939, 1276, 491, 2841, 855, 3296, 3717, 2954, 1887, 2175, 3312, 3873, 1040, 31,
+                     3735, 310, 1164, 2541, 1519, 3375, 743, 3939, 3008, 2050, 189, 3898, 1207, 447, 951, 1666,
+                     2597, 1417, 3554, 393, 2450, 2982, 589, 1671, 3168, 1001, 2886, 3620, 200, 4054, 389, 2934},
+                    {1848, 2479, 3395, 2842, 1759, 1506, 3890, 859, 1964, 3988, 374, 1119, 656, 3176, 3749, 196,
+                     3370, 701, 2180, 2643, 3430, 2370, 1838, 9, 1237, 2426, 178, 3542, 713, 2622, 3065, 1490,
+                     2431, 1923, 3092, 3963, 2130, 260, 1372, 2253, 1802, 615, 1536, 806, 2156, 2677, 2995, 3733,
+                     758, 2879, 1193, 1720, 4013, 1348, 2285, 3465, 3978, 721, 1914, 1396, 2069, 2755, 1537, 710},
+                    {1067, 2022, 70, 844, 521, 2153, 303, 1312, 2740, 3105, 2292, 3688, 1911, 1582, 1319, 2581,
+                     1168, 1725, 3765, 144, 1568, 4018, 651, 3114, 2684, 1550, 931, 2800, 1318, 232, 1835, 3573,
+                     856, 1333, 3461, 599, 1741, 2930, 1077, 2586, 3322, 3786, 2743, 3117, 3485, 1462, 93, 2038,
+                     510, 3190, 2213, 42, 2737, 809, 436, 1986, 1205, 157, 2633, 3782, 1139, 2294, 3567, 3345},
+                    {2627, 3995, 1401, 3619, 2685, 3489, 2432, 3248, 630, 974, 1435, 2950, 286, 845, 3528, 1992,
+                     3930, 514, 955, 3214, 1944, 1103, 1404, 3596, 2016, 565, 3953, 3187, 2055, 2360, 547, 4003,
+                     2659, 2851, 140, 956, 2361, 3862, 3560, 162, 925, 470, 1279, 1931, 334, 3854, 2378, 1159,
+                     3504, 2504, 996, 3776, 3294, 1539, 3713, 3072, 2389, 1617, 3412, 616, 3137, 27, 1738, 508},
+                    {3030, 350, 2333, 3118, 1885, 1177, 115, 1625, 3852, 1797, 156, 2662, 4057, 2442, 3014, 24,
+                     2767, 2280, 3583, 2474, 383, 3016, 3844, 254, 2272, 3435, 1714, 344, 3780, 995, 3253, 1631,
+                     354, 2083, 3807, 1573, 3179, 439, 2773, 2028, 1681, 2480, 3660, 2297, 1011, 667, 3353, 1591,
+                     4074, 320, 1822, 634, 2068, 2599, 250, 906, 2835, 3909, 360, 1817, 2507, 901, 3877, 1297},
+                    {794, 3746, 1585, 952, 621, 4078, 2931, 2046, 3572, 2364, 3417, 2074, 596, 1684, 1070, 3299,
+                     756, 1815, 1377, 2830, 808, 2105, 2540, 975, 2909, 1196, 798, 2524, 1456, 2880, 1213, 2226,
+                     735, 3333, 1106, 2555, 1933, 1256, 705, 1482, 4064, 2976, 56, 3228, 1756, 2607, 2912, 1902,
+                     834, 2779, 1485, 3029, 3569, 1124, 1875, 3348, 1379, 2167, 1071, 2943, 3633, 1480, 2804, 2129},
+                    {1825, 181, 2847, 2169, 3309, 395, 2573, 1030, 746, 428, 1210, 3227, 1371, 3833, 2158, 441,
+                     1522, 3078, 3997, 104, 3492, 1662, 511, 3361, 1821, 132, 3657, 3087, 1880, 74, 3490, 3737,
+                     3027, 1773, 522, 3527, 34, 3704, 3043, 3358, 2157, 1127, 773, 1414, 3924, 243, 1286, 3140,
+                     116, 2341, 3905, 1300, 179, 2295, 4044, 555, 2690, 101, 3231, 755, 2029, 413, 3363, 2429},
+                    {3171, 3526, 1220, 3858, 1743, 1351, 3720, 1525, 2760, 3070, 3779, 922, 125, 2725, 3449, 2402,
+                     3691, 292, 1028, 2203, 1288, 3752, 2715, 1489, 3972, 2437, 2170, 495, 4062, 2603, 884, 305,
+                     2441, 1383, 4037, 2191, 2694, 915, 2340, 263, 541, 2665, 3445, 2831, 2040, 3539, 586, 2205,
+                     3622, 1075, 3268, 2539, 473, 2895, 1715, 780, 3470, 1565, 3770, 2366, 1255, 4066, 128, 1087},
+                    {1516, 520, 2701, 762, 2456, 44, 3209, 2218, 203, 1896, 2489, 1609, 2911, 1840, 804, 1191,
+                     2015, 2639, 3336, 639, 1879, 3154, 176, 731, 3249, 1311, 2791, 1068, 678, 2093, 1561, 2757,
+                     1963, 187, 2885, 770, 1518, 1752, 3894, 1365, 1898, 3808, 1641, 435, 939, 2462, 1543, 3824,
+                     412, 1995, 670, 1638, 932, 3180, 3646, 2469, 1201, 1932, 501, 2621, 1707, 3020, 660, 3678},
+                    {2584, 2056, 236, 3399, 2991, 1976, 862, 3597, 1283, 4012, 507, 2257, 3638, 358, 4032, 558,
+                     2932, 1697, 3817, 2460, 2958, 1133, 2296, 945, 2008, 363, 1646, 3534, 3144, 1282, 3350, 3925,
+                     985, 3158, 1167, 3295, 391, 3460, 2814, 1052, 3124, 2423, 131, 2251, 4017, 3058, 1155, 2710,
+                     1740, 2901, 3451, 3771, 2199, 1386, 29, 2073, 3063, 3982, 195, 3563, 981, 2738, 1924, 2269},
+                    {867, 4022, 1685, 1039, 2283, 3959, 564, 2865, 1688, 3380, 728, 1126, 3172, 1496, 2558, 3261,
+                     1357, 68, 870, 1542, 270, 4080, 3540, 2593, 3864, 2949, 49, 3761, 1792, 2387, 418, 617,
+                     3612, 1704, 2320, 3773, 2063, 2502, 202, 636, 3613, 861, 3308, 1239, 1856, 717, 0, 3323,
+                     886, 1339, 165, 2636, 1860, 3935, 1062, 359, 2776, 894, 2299, 1415, 3150, 290, 3881, 1322},
+                    {2875, 3225, 3590, 1387, 306, 1570, 1166, 2608, 277, 2071, 2988, 2674, 35, 1970, 2195, 997,
+                     3913, 2308, 3565, 2785, 580, 2078, 1735, 426, 1534, 3372, 2256, 811, 2644, 214, 2915, 2178,
+                     1337, 2588, 67, 578, 3007, 1225, 4016, 1579, 2027, 2624, 1442, 3729, 2858, 3505, 2560, 2084,
+                     3951, 2390, 3110, 330, 764, 2855, 3313, 1512, 3701, 1785, 3366, 593, 2126, 1606, 3437, 8},
+                    {1842, 376, 671, 2770, 3787, 3093, 3499, 2357, 978, 3876, 1429, 3686, 868, 3500, 256, 1736,
+                     3054, 462, 1937, 1250, 3405, 3084, 1362, 2861, 647, 1038, 1948, 1411, 3992, 1146, 3501, 1863,
+                     3830, 841, 3393, 1450, 928, 1846, 2263, 3247, 2944, 472, 249, 2135, 567, 1659, 315, 1451,
+                     3671, 545, 1122, 1569, 3517, 2438, 506, 2215, 692, 2545, 1189, 2900, 3802, 797, 2493, 1171},
+                    {3075, 2381, 2077, 2532, 1779, 786, 1957, 112, 3234, 1807, 427, 2312, 1277, 3838, 2805, 3373,
+                     749, 2654, 3747, 1007, 2415, 134, 830, 3799, 2491, 3664, 3080, 504, 3277, 1633, 684, 3064,
+                     355, 2817, 1996, 3961, 2693, 3696, 109, 788, 1174, 1757, 3918, 3083, 1074, 2336, 3220, 799,
+                     1830, 2749, 2163, 4095, 1949, 1233, 3839, 1712, 3040, 71, 3926, 332, 1878, 3267, 478, 3743},
+                    {963, 3914, 1247, 76, 3335, 498, 1343, 3742, 2924, 675, 2544, 3302, 1639, 606, 2424, 1147,
+                     1486, 186, 2143, 1637, 3243, 3936, 1832, 2131, 313, 1260, 2369, 173, 2778, 2048, 2494, 1020,
+                     1530, 2363, 247, 3094, 1677, 405, 3444, 2781, 3644, 2377, 3386, 887, 2707, 4038, 3580, 1219,
+                     2955, 85, 3397, 896, 3207, 133, 2648, 990, 3581, 2033, 1392, 2379, 1029, 2675, 2217, 1493},
+                    {584, 1645, 3523, 872, 2963, 4086, 2172, 2724, 1598, 1186, 4025, 171, 1938, 3122, 318, 1833,
+                     3591, 4047, 3009, 662, 382, 2640, 1116, 3509, 2744, 3341, 1754, 3888, 833, 3599, 39, 4090,
+                     3237, 3631, 1132, 688, 1315, 2413, 1024, 2082, 588, 1531, 51, 1912, 1395, 194, 2007, 375,
+                     2300, 3800, 1679, 641, 2345, 1463, 2921, 406, 3256, 829, 2748, 3498, 1667, 108, 3640, 2833},
+                    {208, 3170, 2265, 2651, 1505, 1044, 2453, 341, 903, 3525, 2134, 2763, 1022, 3919, 2184, 2940,
+                     899, 2510, 1291, 3446, 2282, 1436, 2956, 2, 1597, 591, 977, 2211, 1464, 2925, 1280, 2234,
+                     550, 1784, 2123, 3884, 2582, 3160, 1866, 4065, 1293, 2605, 3806, 2997, 643, 2478, 1611, 3153,
+                     1005, 2580, 1323, 3042, 338, 3725, 2091, 1170, 3990, 1589, 553, 3134, 4070, 699, 1310, 2010},
+                    {3971, 1853, 361, 3829, 2003, 152, 3645, 3362, 1867, 551, 3017, 1473, 792, 3650, 1356, 2673,
+                     518, 2026, 75, 1791, 924, 3668, 1993, 772, 4058, 3046, 2598, 3723, 417, 1900, 3416, 2614,
+                     923, 2774, 98, 3506, 1510, 524, 205, 2938, 3230, 351, 2233, 1121, 3320, 3705, 2826, 774,
+                     3983, 443, 1978, 3625, 2708, 1737, 739, 2511, 1874, 2330, 251, 1216, 2137, 2986, 3377, 2505},
+                    {2927, 791, 1195, 3251, 624, 1729, 3095, 1285, 2332, 14, 3767, 2514, 396, 3219, 129, 3481,
+                     1607, 3859, 3159, 2793, 3977, 492, 3216, 2445, 1338, 2080, 245, 1172, 3210, 659, 1670, 237,
+                     3834, 1420, 2953, 807, 3319, 2216, 3769, 902, 1627, 736, 3564, 1730, 2116, 490, 1261, 3452,
+                     2154, 1521, 3283, 1111, 175, 3882, 3390, 3018, 139, 3456, 3778, 2565, 900, 1780, 304, 1034},
+                    {3454, 2702, 1428, 2394, 3715, 2849, 750, 2616, 3989, 3202, 1687, 1223, 2037, 2335, 1761, 1105,
+                     781, 2382, 347, 1180, 2566, 1644, 273, 1048, 3784, 1804, 3495, 2734, 2315, 3943, 3035, 1120,
+                     3553, 1930, 2392, 342, 1732, 2696, 1197, 2012, 2802, 3942, 2529, 943, 126, 3886, 1871, 2653,
+                     25, 668, 2840, 2434, 916, 2190, 1341, 592, 1036, 1445, 2867, 1943, 434, 3679, 2350, 1545},
+                    {2160, 33, 3558, 479, 1081, 2117, 227, 1443, 986, 1985, 691, 2882, 3433, 4015, 611, 3048,
+                     3730, 3310, 1447, 2127, 681, 3557, 2844, 2224, 3315, 530, 869, 1560, 79, 2031, 790, 2515,
+                     455, 3203, 1249, 3976, 1014, 3636, 16, 3411, 2347, 235, 1327, 2970, 3197, 1465, 2343, 1063,
+                     3101, 3850, 1819, 3559, 488, 1599, 3223, 2661, 3954, 2221, 751, 3330, 3067, 1374, 3843, 629},
+                    {1726, 4055, 1968, 3049, 1595, 3940, 3440, 2264, 445, 3595, 2667, 295, 935, 1515, 2751, 2208,
+                     1921, 222, 2874, 3812, 987, 1910, 3106, 1504, 184, 2548, 2952, 3649, 1321, 3359, 2829, 1487,
+                     2207, 3753, 595, 2076, 3024, 2498, 676, 1827, 1495, 531, 3479, 1918, 2723, 293, 801, 3647,
+                     1640, 248, 2267, 1198, 4056, 2936, 1997, 352, 1758, 3635, 43, 1634, 1134, 2628, 155, 3146},
+                    {1244, 953, 2570, 252, 2747, 858, 1798, 2965, 3848, 1616, 1149, 3112, 3868, 63, 2501, 465,
+                     1251, 860, 1700, 3431, 2428, 55, 3928, 1208, 737, 4029, 1941, 1073, 2422, 316, 4000, 1746,
+                     138, 914, 2862, 1584, 285, 1385, 3157, 4026, 2904, 1112, 3788, 720, 2214, 4079, 3324, 2490,
+                     2926, 1370, 3383, 747, 2562, 82, 3515, 832, 1232, 2790, 2454, 535, 4019, 2058, 864, 2822},
+                    {2362, 557, 3741, 1364, 3306, 2455, 1212, 91, 3252, 587, 2391, 2164, 1882, 1324, 3367, 3642,
+                     3005, 4092, 2604, 400, 1334, 602, 2714, 1748, 2323, 3424, 370, 1693, 3819, 618, 1004, 3082,
+                     3491, 2564, 1839, 3331, 3714, 2287, 843, 387, 2113, 3279, 2433, 1608, 399, 1211, 1777, 575,
+                     961, 2111, 420, 3133, 1876, 1484, 2383, 3793, 2106, 3173, 983, 3406, 2301, 1774, 3594, 3275},
+                    {210, 3422, 1847, 2196, 673, 394, 3699, 2042, 2559, 1407, 3522, 230, 3708, 700, 1651, 1012,
+                     2070, 123, 3183, 2281, 3675, 3269, 2103, 3731, 960, 3074, 2787, 2181, 3204, 2676, 1984, 2306,
+                     1289, 724, 4075, 80, 1082, 2720, 3556, 1653, 2647, 913, 60, 3598, 3115, 2067, 3755, 96,
+                     2742, 3932, 1689, 3672, 2811, 1083, 570, 3044, 190, 1556, 3904, 268, 2929, 682, 380, 1529},
+                    {3910, 2881, 1101, 3088, 3993, 1532, 2827, 782, 1032, 2890, 1768, 878, 2679, 3217, 2910, 2318,
+                     632, 1437, 1864, 1058, 1601, 837, 2922, 149, 1446, 554, 1246, 38, 821, 1430, 3340, 192,
+                     3629, 2768, 1458, 2152, 525, 1955, 1240, 159, 3845, 1873, 1376, 2870, 1015, 2552, 1449, 3021,
+                     3482, 1160, 2419, 261, 877, 3987, 3428, 1344, 2625, 704, 1953, 1161, 1406, 3811, 2699, 1979},
+                    {2488, 779, 1648, 69, 3547, 2321, 1859, 3379, 3915, 364, 3059, 4052, 1136, 1972, 337, 3956,
+                     3480, 2798, 3849, 448, 2656, 1954, 321, 3566, 2569, 3891, 1622, 3536, 2508, 3751, 482, 1674,
+                     1135, 331, 2411, 3206, 2973, 3908, 3378, 2484, 3073, 650, 2242, 3979, 540, 3376, 828, 2290,
+                     1858, 672, 1425, 3264, 2197, 1971, 398, 2284, 1787, 3289, 3605, 2497, 3119, 2182, 991, 1304},
+                    {3175, 466, 2120, 2638, 949, 278, 1328, 512, 2128, 1580, 23, 2232, 548, 2549, 1553, 167,
+                     2465, 1203, 754, 3062, 3408, 4033, 1190, 2384, 1828, 3288, 2043, 2948, 1109, 1881, 2866, 3921,
+                     3045, 2005, 3805, 937, 1721, 763, 1472, 452, 1061, 3457, 2681, 262, 1973, 1702, 217, 4030,
+                     446, 2589, 3828, 7, 2716, 1586, 2987, 3866, 921, 2848, 122, 480, 1672, 3486, 15, 3693},
+                    {1770, 4041, 3471, 1253, 2983, 3744, 3149, 2700, 3662, 2427, 1258, 3462, 3757, 1375, 3355, 965,
+                     1793, 3750, 2049, 13, 2225, 1402, 627, 3163, 1017, 769, 430, 4011, 234, 687, 2165, 895,
+                     2543, 622, 3400, 1335, 367, 2365, 2806, 2124, 1776, 3768, 1546, 1229, 3229, 3694, 2718, 1114,
+                     3151, 2030, 2908, 1222, 3641, 725, 1102, 284, 3703, 1272, 2112, 4082, 850, 2891, 635, 2331},
+                    {307, 2792, 1455, 608, 1994, 2457, 1701, 1107, 716, 3286, 2813, 1801, 793, 2745, 2101, 2984,
+                     560, 3191, 1583, 2546, 927, 2845, 1695, 3827, 198, 2746, 2262, 1476, 2448, 3420, 1305, 3238,
+                     1533, 5, 1813, 2635, 3685, 180, 4048, 3245, 831, 349, 2916, 2470, 733, 2174, 1382, 3551,
+                     1636, 948, 3453, 494, 1826, 2375, 3344, 2572, 1709, 568, 2371, 2717, 1441, 1899, 3352, 1156},
+                    {3051, 889, 2273, 3809, 224, 819, 3934, 118, 1969, 440, 969, 3135, 146, 3893, 414, 3618,
+                     2275, 1347, 269, 3473, 3698, 484, 3019, 2098, 3458, 1298, 3643, 3139, 1710, 3719, 324, 2348,
+                     4035, 2839, 3582, 2222, 1033, 2957, 1904, 1200, 3575, 2322, 22, 3944, 992, 3032, 136, 2436,
+                     317, 766, 2239, 1502, 4051, 212, 3100, 2017, 1474, 3507, 3215, 1108, 185, 3892, 2542, 1587},
+                    {2085, 100, 3365, 1806, 3213, 2859, 1517, 2266, 3555, 4007, 1488, 2045, 2367, 1665, 1154, 2630,
+                     842, 3917, 2756, 1100, 1891, 2374, 95, 1497, 2557, 1852, 562, 926, 78, 2782, 1059, 1975,
+                     477, 846, 1228, 3147, 677, 1559, 2533, 561, 1426, 3125, 2044, 1724, 3434, 579, 1894, 3911,
+                     2972, 3789, 3241, 2534, 2836, 1340, 857, 3900, 48, 2899, 748, 3790, 2061, 3138, 450, 3669},
+                    {2712, 3948, 1078, 2587, 1214, 539, 3392, 2670, 1301, 3001, 2523, 294, 3519, 680, 3164, 1915,
+                     328, 3326, 1733, 674, 3973, 1243, 3271, 813, 4069, 1104, 2966, 2122, 2585, 3896, 1439, 3004,
+                     3478, 1682, 231, 2001, 3958, 3317, 92, 3748, 2764, 1046, 474, 2632, 3721, 1491, 2784, 1138,
+                     2095, 1749, 72, 1031, 1960, 610, 3616, 2209, 1018, 2626, 1786, 325, 2319, 946, 1306, 712},
+                    {1422, 2400, 402, 1620, 3676, 2034, 308, 880, 1844, 614, 1118, 3732, 2892, 1336, 4071, 1524,
+                     2468, 2151, 127, 3103, 2066, 2669, 3577, 401, 2289, 226, 3697, 3371, 760, 1814, 3273, 605,
+                     2522, 2192, 3814, 2671, 458, 2351, 933, 2155, 1655, 4005, 3368, 1254, 822, 2279, 404, 3329,
+                     642, 1299, 2711, 422, 3426, 2989, 1663, 2461, 485, 3357, 1259, 3576, 1612, 2824, 3409, 1854},
+                    {2951, 3516, 3152, 745, 2220, 4089, 3077, 2443, 3804, 50, 3254, 2185, 892, 2680, 86, 3439,
+                     1010, 3722, 2818, 1459, 907, 527, 1596, 2854, 3174, 1987, 1557, 457, 1248, 2314, 300, 968,
+                     3706, 1317, 3068, 1064, 1775, 1363, 3524, 3010, 702, 288, 2409, 1981, 117, 3128, 4084, 2528,
+                     1592, 3537, 3739, 2354, 3927, 1192, 301, 3195, 1433, 4021, 1947, 2979, 604, 2492, 3984, 153},
+                    {544, 1950, 982, 26, 2906, 1399, 1055, 1669, 3463, 2777, 1572, 1940, 476, 1739, 2328, 583,
+                     2971, 1278, 433, 3468, 2519, 3795, 1795, 979, 3879, 1326, 2444, 2815, 3965, 3503, 2036, 2732,
+                     1610, 54, 729, 3425, 2823, 3885, 223, 2592, 1843, 3218, 1527, 2893, 3549, 1771, 1013, 228,
+                     2917, 879, 2159, 1452, 775, 1808, 2692, 3736, 708, 2136, 177, 882, 3759, 289, 2193, 1183},
+                    {3690, 2307, 3851, 2664, 1812, 3570, 225, 513, 2247, 789, 1320, 3952, 3384, 3097, 3813, 2018,
+                     787, 1699, 3996, 2305, 166, 3305, 2186, 281, 2634, 730, 21, 3086, 1673, 1113, 160, 3169,
+                     4083, 2380, 1917, 371, 1526, 795, 2011, 1231, 3654, 959, 3874, 598, 2655, 1346, 2132, 3821,
+                     1905, 509, 3136, 204, 3303, 2051, 81, 2888, 1089, 2420, 3141, 2703, 1461, 1041, 3284, 1719},
+                    {817, 1511, 3258, 1270, 626, 2475, 3311, 2020, 3860, 2985, 266, 2554, 1050, 183, 1209, 3604,
+                     2645, 3221, 1942, 1084, 711, 1380, 2960, 1173, 3521, 1897, 3727, 930, 566, 2594, 3656, 1413,
+                     851, 2918, 3568, 2551, 3132, 2259, 3346, 529, 2775, 40, 2097, 1150, 312, 3681, 714, 2397,
+                     3396, 1236, 2807, 2583, 1002, 4063, 2278, 3402, 1605, 421, 3949, 1765, 3447, 2024, 3061, 2620},
+                    {121, 2856, 335, 2086, 3967, 885, 2736, 1478, 1151, 2405, 3615, 654, 2812, 2229, 1600, 346,
+                     2412, 17, 1479, 2869, 3652, 2006, 4039, 601, 3235, 2258, 1398, 3347, 2090, 2974, 1788, 419,
+                     2219, 1143, 574, 3791, 102, 1094, 4046, 2471, 1444, 3085, 2329, 3414, 1643, 2968, 3244, 1499,
+                     61, 3966, 1727, 3584, 1567, 559, 1329, 853, 1916, 3659, 1175, 12, 2302, 718, 460, 4059},
+                    {2440, 3617, 1128, 1694, 3011, 135, 3667, 1877, 362, 3212, 1760, 2092, 1416, 4008, 2937, 3301,
+                     972, 3897, 505, 3123, 2683, 372, 1614, 2477, 124, 1723, 2688, 4020, 241, 2355, 703, 3401,
+                     3923, 1654, 2088, 1332, 1820, 2894, 1630, 365, 3728, 1794, 776, 4014, 2499, 929, 415, 2739,
+                     1086, 2081, 698, 311, 2376, 3089, 3514, 2660, 3006, 649, 2525, 1378, 3587, 2913, 1635, 1314},
+                    {1909, 2187, 549, 3474, 2326, 1360, 3142, 726, 4043, 994, 143, 3438, 863, 453, 1850, 696,
+                     1342, 2171, 3546, 1718, 847, 2339, 1016, 3756, 3047, 805, 464, 1088, 1548, 3803, 1262, 2537,
+                     3102, 340, 2719, 3236, 883, 3477, 695, 2201, 1019, 3321, 1274, 145, 1939, 3794, 2241, 1837,
+                     3634, 2495, 2933, 3846, 1165, 1855, 373, 163, 3906, 2150, 3292, 2771, 264, 3792, 1000, 3374},
+                    {3165, 785, 3831, 2697, 966, 423, 2530, 2072, 2853, 1549, 2650, 3841, 3031, 2452, 3709, 2733,
+                     3418, 1913, 2506, 1204, 3955, 207, 3385, 2832, 1221, 2059, 3611, 2810, 3185, 874, 1956, 2850,
+                     170, 1027, 3614, 2346, 240, 3950, 1990, 2801, 218, 2590, 3000, 537, 2819, 1400, 640, 3071,
+                     257, 888, 1389, 3259, 2176, 3738, 2482, 1469, 1065, 1656, 481, 920, 1857, 2102, 2578, 213},
+                    {1438, 2959, 73, 1552, 3262, 1747, 3775, 1184, 3513, 552, 2240, 1275, 1958, 58, 1652, 1131,
+                     314, 3022, 147, 628, 3239, 1836, 2147, 1500, 265, 3895, 1810, 2417, 47, 2183, 3592, 609,
+                     1467, 1886, 3823, 637, 1523, 2526, 3155, 1373, 3586, 3889, 1613, 2079, 3530, 1097, 3300, 1658,
+                     4045, 3466, 1951, 94, 645, 958, 2898, 3233, 2002, 3602, 2398, 3865, 3052, 1224, 569, 3929},
+                    {1805, 1092, 2487, 2021, 3980, 655, 2261, 6, 3069, 1711, 287, 3276, 1043, 613, 3156, 2274,
+                     3869, 912, 1558, 3740, 2615, 1353, 3578, 664, 2600, 3143, 563, 1368, 3493, 368, 1676, 4004,
+                     2404, 3389, 1217, 2141, 3028, 468, 1141, 1869, 607, 934, 2309, 297, 3840, 2646, 4, 2359,
+                     1238, 499, 2568, 1578, 2741, 1755, 416, 3998, 715, 119, 2877, 1423, 759, 3512, 2255, 2728},
+                    {298, 3388, 3632, 1269, 259, 2825, 3407, 1434, 871, 3734, 2416, 2789, 3630, 4077, 2575, 1421,
+                     3574, 2686, 1999, 2254, 2896, 456, 891, 4093, 2268, 1602, 998, 3328, 2571, 1176, 2994, 970,
+                     3199, 66, 2642, 1731, 919, 3342, 3816, 62, 2447, 3226, 1440, 744, 3091, 1751, 865, 3718,
+                     2837, 2212, 3037, 3903, 3351, 3651, 1361, 2252, 2668, 1194, 3403, 1766, 384, 3224, 1594, 905},
+                    {4009, 517, 2177, 768, 3036, 1907, 1079, 2576, 4010, 1865, 697, 1369, 2047, 848, 242, 1800,
+                     483, 738, 3360, 1066, 32, 3178, 1935, 1152, 3002, 106, 3815, 1895, 742, 3878, 2706, 2019,
+                     461, 777, 2942, 4042, 221, 2731, 2243, 1649, 2923, 4087, 1922, 3436, 1206, 2473, 467, 2025,
+                     1448, 752, 1051, 215, 1218, 2386, 812, 3108, 1624, 276, 2189, 4073, 2486, 37, 3711, 2919},
+                    {1888, 2637, 3161, 1470, 2388, 3680, 496, 220, 2142, 2962, 3382, 409, 1623, 3455, 2884, 2149,
+                     1267, 2992, 3991, 1471, 1744, 3796, 2451, 2726, 392, 3518, 2108, 2863, 2327, 151, 1384, 3648,
+                     2250, 1571, 3511, 1316, 2009, 3695, 741, 3571, 1235, 356, 2780, 113, 2200, 3986, 2946, 3364,
+                     275, 3193, 3609, 1908, 576, 2057, 46, 3497, 3764, 1920, 876, 2722, 1091, 2014, 1345, 2352},
+                    {1158, 1657, 111, 940, 3901, 1691, 2730, 3205, 1563, 1199, 161, 2672, 3107, 1123, 2396, 3916,
+                     3260, 209, 2418, 357, 3531, 619, 1325, 3339, 1696, 838, 1268, 454, 1547, 3266, 631, 1789,
+                     3933, 1072, 2536, 366, 2399, 1008, 1475, 487, 2115, 2563, 1054, 3661, 594, 1566, 976, 1834,
+                     3861, 2512, 1621, 2713, 4061, 2975, 2520, 1035, 489, 2903, 3327, 573, 3600, 3026, 425, 709},
+                    {3502, 3797, 2873, 3419, 369, 1252, 2286, 633, 3548, 947, 3941, 2238, 3762, 572, 65, 1551,
+                     944, 1889, 2797, 2110, 820, 2964, 2204, 169, 3899, 2406, 3710, 3116, 936, 3483, 2472, 267,
+                     2803, 3148, 1901, 657, 3255, 2980, 1845, 3421, 3129, 854, 1690, 3274, 1359, 2611, 3550, 141,
+                     1281, 2144, 437, 910, 1391, 3287, 1783, 1528, 3970, 1294, 2373, 1466, 1716, 3870, 2553, 3211},
+                    {279, 1977, 652, 2109, 2531, 3291, 849, 3837, 2876, 1919, 2481, 1705, 796, 1988, 3588, 2658,
+                     666, 3472, 3758, 1130, 2579, 4028, 1555, 1009, 1983, 638, 2629, 1823, 4050, 2138, 2935, 1257,
+                     827, 110, 3712, 1393, 3962, 18, 2617, 3857, 239, 2313, 3957, 2990, 1991, 388, 2337, 2796,
+                     707, 3096, 3476, 2349, 309, 3700, 679, 2759, 2133, 339, 3120, 197, 802, 2173, 989, 1541},
+                    {2304, 2705, 1408, 1045, 4081, 1831, 291, 2065, 1355, 105, 475, 3240, 1432, 2977, 1234, 3182,
+                     2277, 1642, 1350, 519, 1811, 3192, 299, 2834, 3464, 3039, 1412, 3, 378, 1096, 1683, 3836,
+                     2064, 3394, 2698, 1668, 2194, 1163, 603, 1593, 1302, 1903, 683, 188, 3726, 840, 3242, 3969,
+                     1095, 1753, 3766, 2852, 1188, 2236, 154, 3415, 898, 2613, 3655, 1998, 3467, 2766, 83, 4024},
+                    {1227, 469, 3674, 3113, 28, 2821, 1535, 3076, 3724, 2612, 3469, 1056, 4034, 272, 2513, 449,
+                     3855, 174, 3038, 3356, 52, 3607, 1266, 2517, 410, 1145, 2271, 3325, 2752, 3601, 523, 3099,
+                     1507, 2316, 497, 908, 3606, 2878, 2372, 3538, 2750, 3343, 2516, 1148, 2857, 2179, 1650, 1424,
+                     500, 2041, 97, 1503, 783, 3181, 1982, 3818, 1215, 1763, 3922, 644, 1142, 3272, 1796, 2969},
+                    {875, 3332, 2458, 1675, 757, 3529, 2414, 528, 1125, 2249, 719, 1851, 2735, 2148, 3689, 1767,
+                     1069, 2089, 2721, 893, 2317, 2004, 722, 3946, 1772, 3658, 818, 1590, 1974, 2401, 761, 2619,
+                     302, 1053, 4076, 3050, 193, 2000, 814, 326, 988, 3781, 1492, 526, 1818, 3442, 30, 2687,
+                     3025, 2483, 3265, 4027, 2641, 1664, 2961, 538, 2464, 10, 1564, 2947, 2439, 1394, 533, 3585},
+                    {1581, 201, 1927, 3826, 2235, 1292, 950, 3960, 3334, 1577, 2945, 3639, 19, 897, 1513, 2887,
+                     767, 4072, 2485, 1457, 3772, 2788, 1603, 2228, 3166, 546, 3832, 2914, 199, 3968, 1366, 3246,
+                     3687, 1929, 2500, 1296, 1782, 3282, 3902, 3079, 2087, 114, 2248, 3145, 4067, 1265, 999, 3801,
+                     3562, 653, 954, 1861, 442, 1042, 3603, 1431, 2809, 3338, 973, 2231, 385, 3847, 2591, 2100},
+                    {3975, 2883, 1137, 582, 3033, 172, 2758, 1790, 246, 2023, 411, 1284, 2395, 3280, 543, 3423,
+                     1945, 280, 3520, 581, 1117, 336, 2999, 971, 88, 2075, 2466, 1230, 3410, 984, 2210, 1762,
+                     120, 2843, 665, 3484, 390, 1453, 2547, 1182, 1734, 2872, 3637, 803, 2574, 319, 2403, 1928,
+                     258, 2245, 1330, 3391, 2410, 3867, 255, 2303, 732, 4088, 1829, 3545, 168, 1946, 727, 3126},
+                    {2344, 353, 3487, 2610, 1509, 2114, 3670, 3162, 816, 2691, 4001, 3109, 1680, 3880, 1157, 2244,
+                     3056, 1287, 1661, 3201, 1893, 3981, 3398, 1405, 2666, 3543, 1501, 333, 1884, 623, 2981, 3533,
+                     1187, 3842, 1615, 2162, 2729, 3707, 706, 493, 4006, 1352, 386, 1962, 1554, 3003, 3293, 753,
+                     1692, 2816, 3702, 164, 2096, 3098, 1273, 1936, 3189, 438, 1185, 3041, 2704, 3692, 1047, 1309}
+            }
+    };
+}
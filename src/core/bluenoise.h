@@ -0,0 +1,29 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#ifndef PBRT_WHITTED_BLUENOISE_H
+#define PBRT_WHITTED_BLUENOISE_H
+
+#include "main.h"
+#include "geometry.h"
+
+namespace pbrt {
+
+    static constexpr int BlueNoiseResolution = 64;
+    static constexpr int NumBlueNoiseTextures = 4;
+
+    // Tileable blue-noise dither masks, indexed [texture][y][x]
+    extern const uint16_t BlueNoiseTextures[NumBlueNoiseTextures][BlueNoiseResolution]
+                                           [BlueNoiseResolution];
+
+    // Value in $(0,1)$ of the tiled mask _textureIndex_ at pixel _p_;
+    // neighboring pixels get values that differ as much as possible
+    inline float BlueNoise(int textureIndex, Point2i p) {
+        p.x = Mod(p.x, BlueNoiseResolution);
+        p.y = Mod(p.y, BlueNoiseResolution);
+        return (BlueNoiseTextures[textureIndex][p.y][p.x] + 0.5f) /
+               (BlueNoiseResolution * BlueNoiseResolution);
+    }
+}
+#endif //PBRT_WHITTED_BLUENOISE_H
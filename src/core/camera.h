@@ -29,6 +29,9 @@ class Camera {
     struct CameraSample {
         Point2f pFilm;
         Point2f pLens;
+        // Weight for _FilmTile::AddPixelSample()_ when _pFilm_ was drawn
+        // from the pixel filter
+        float filterWeight = 1;
     };
 
 class ProjectiveCamera : public Camera {
@@ -0,0 +1,204 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#include "checkpoint.h"
+#include <cstdio>
+#include <unistd.h>
+
+namespace pbrt {
+
+    static const char CheckpointMagic[8] = {'P', 'B', 'R', 'T', 'C', 'K', 'P', 'T'};
+    static const int32_t CheckpointVersion = 3;
+
+    // Everything that must match for a checkpoint to be resumable
+    struct CheckpointHeader {
+        char magic[8];
+        int32_t version;
+        int32_t nTiles;
+        int64_t samplesPerPixel;
+        int32_t nPasses;
+        int32_t pass;
+        uint64_t renderHash;
+    };
+
+    Checkpoint::Checkpoint(const std::string &filename, float interval,
+                           Film *film, const Bounds2i &sampleBounds,
+                           int tileSize, int64_t samplesPerPixel, int nPasses,
+                           uint64_t renderHash,
+                           const std::vector<PixelState> &pixelState)
+            : filename(filename),
+              interval(std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                      std::chrono::duration<float>(interval))),
+              film(film),
+              sampleBounds(sampleBounds),
+              tileSize(tileSize),
+              samplesPerPixel(samplesPerPixel),
+              nPasses(nPasses),
+              renderHash(renderHash),
+              lastSave(std::chrono::steady_clock::now()),
+              pixelState(pixelState) {
+        Vector2i extent = sampleBounds.Diagonal();
+        nTilesX = (extent.x + tileSize - 1) / tileSize;
+        int nTilesY = (extent.y + tileSize - 1) / tileSize;
+        tilesDone.assign(nTilesX * nTilesY, 0);
+        for (const PixelState &state : pixelState) {
+            const uint8_t *data = (const uint8_t *)state.data;
+            savedState.emplace_back(data, data + sampleBounds.Area() * state.bytesPerPixel);
+        }
+        resumed = Load();
+        if (resumed)
+            std::cout << "Resuming from checkpoint \"" << filename << "\"" << std::endl;
+    }
+
+    Checkpoint::~Checkpoint() {
+        // A render that stops before its image is written keeps its progress
+        if (!finished) SaveNow();
+        Wait();
+    }
+
+    void Checkpoint::MergeFilmTile(std::unique_ptr<FilmTile> tile, int tileIndex) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (saving) {
+            heldTiles.emplace_back(std::move(tile), tileIndex);
+            return;
+        }
+        Merge(std::move(tile), tileIndex);
+        if (interval.count() > 0 &&
+            std::chrono::steady_clock::now() - lastSave >= interval) {
+            // The last save's thread has already released the lock for good
+            if (saveThread.joinable()) saveThread.join();
+            saving = true;
+            unsaved = false;
+            saveThread = std::thread(&Checkpoint::Save, this, tilesDone, pass);
+        }
+    }
+
+    void Checkpoint::Merge(std::unique_ptr<FilmTile> tile, int tileIndex) {
+        film->MergeFilmTile(std::move(tile));
+        tilesDone[tileIndex] = 1;
+        unsaved = true;
+        if (pixelState.empty()) return;
+        int x0 = (tileIndex % nTilesX) * tileSize;
+        int y0 = (tileIndex / nTilesX) * tileSize;
+        Vector2i extent = sampleBounds.Diagonal();
+        int x1 = std::min(x0 + tileSize, extent.x);
+        int y1 = std::min(y0 + tileSize, extent.y);
+        for (size_t i = 0; i < pixelState.size(); ++i) {
+            size_t bpp = pixelState[i].bytesPerPixel;
+            for (int y = y0; y < y1; ++y) {
+                size_t offset = ((size_t)y * extent.x + x0) * bpp;
+                memcpy(&savedState[i][offset], (const uint8_t *)pixelState[i].data + offset,
+                       (x1 - x0) * bpp);
+            }
+        }
+    }
+
+    void Checkpoint::Wait() {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (saving) saveDone.wait(lock);
+        }
+        if (saveThread.joinable()) saveThread.join();
+    }
+
+    void Checkpoint::StartPass(int p) {
+        // Without periodic saves, every pass that ends is saved
+        if (interval.count() <= 0) SaveNow();
+        Wait();
+        std::lock_guard<std::mutex> lock(mutex);
+        pass = p;
+        std::fill(tilesDone.begin(), tilesDone.end(), 0);
+    }
+
+    void Checkpoint::Finish() {
+        Wait();
+        std::lock_guard<std::mutex> lock(mutex);
+        finished = true;
+        std::remove(filename.c_str());
+    }
+
+    bool Checkpoint::Load() {
+        FILE *f = fopen(filename.c_str(), "rb");
+        if (!f) return false;
+        CheckpointHeader header;
+        bool ok = fread(&header, sizeof(header), 1, f) == 1 &&
+                  memcmp(header.magic, CheckpointMagic, sizeof(CheckpointMagic)) == 0 &&
+                  header.version == CheckpointVersion &&
+                  header.nTiles == (int32_t)tilesDone.size() &&
+                  header.samplesPerPixel == samplesPerPixel &&
+                  header.nPasses == nPasses &&
+                  header.renderHash == renderHash;
+        std::vector<uint8_t> tiles(tilesDone.size());
+        ok = ok && fread(tiles.data(), 1, tiles.size(), f) == tiles.size() &&
+             film->ReadPixels(f);
+        std::vector<std::vector<uint8_t>> state = savedState;
+        for (std::vector<uint8_t> &s : state)
+            ok = ok && fread(s.data(), 1, s.size(), f) == s.size();
+        fclose(f);
+        if (!ok) {
+            std::cerr << "Ignoring checkpoint \"" << filename
+                      << "\": it does not match this render" << std::endl;
+            return false;
+        }
+        pass = header.pass;
+        tilesDone = tiles;
+        savedState = state;
+        for (size_t i = 0; i < state.size(); ++i)
+            memcpy(pixelState[i].data, state[i].data(), state[i].size());
+        return true;
+    }
+
+    void Checkpoint::SaveNow() {
+        Wait();
+        std::vector<uint8_t> tiles;
+        int p;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!unsaved) return;
+            saving = true;
+            unsaved = false;
+            tiles = tilesDone;
+            p = pass;
+        }
+        Save(std::move(tiles), p);
+    }
+
+    void Checkpoint::Save(std::vector<uint8_t> tiles, int pass) {
+        // Nothing is merged into the film until this save is done. It is
+        // written to a temporary file first so that a crash while saving
+        // leaves the previous checkpoint intact.
+        std::string tmpName = filename + ".tmp";
+        FILE *f = fopen(tmpName.c_str(), "wb");
+        bool ok = f != nullptr;
+        if (f) {
+            CheckpointHeader header;
+            memset(&header, 0, sizeof(header));
+            memcpy(header.magic, CheckpointMagic, sizeof(CheckpointMagic));
+            header.version = CheckpointVersion;
+            header.nTiles = tiles.size();
+            header.samplesPerPixel = samplesPerPixel;
+            header.nPasses = nPasses;
+            header.pass = pass;
+            header.renderHash = renderHash;
+            ok = fwrite(&header, sizeof(header), 1, f) == 1 &&
+                 fwrite(tiles.data(), 1, tiles.size(), f) == tiles.size() &&
+                 film->WritePixels(f);
+            for (const std::vector<uint8_t> &state : savedState)
+                ok = ok && fwrite(state.data(), 1, state.size(), f) == state.size();
+            ok = fflush(f) == 0 && fsync(fileno(f)) == 0 && ok;
+            ok = fclose(f) == 0 && ok;
+            ok = ok && std::rename(tmpName.c_str(), filename.c_str()) == 0;
+        }
+        if (!ok)
+            std::cerr << "Error writing checkpoint \"" << filename << "\"" << std::endl;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        // A failed save is not retried before the next interval either
+        lastSave = std::chrono::steady_clock::now();
+        for (auto &held : heldTiles) Merge(std::move(held.first), held.second);
+        heldTiles.clear();
+        saving = false;
+        saveDone.notify_all();
+    }
+}
@@ -0,0 +1,100 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#ifndef PBRT_WHITTED_CHECKPOINT_H
+#define PBRT_WHITTED_CHECKPOINT_H
+
+#include "main.h"
+#include "film.h"
+#include <chrono>
+#include <condition_variable>
+#include <thread>
+
+namespace pbrt {
+
+    // Periodically saves the film's accumulated pixels together with the set
+    // of tiles already merged into them, so that an interrupted render can be
+    // picked up again. With an _interval_ of zero, the state is saved only
+    // when a pass ends and when the checkpoint is destroyed before its image
+    // was written. Constructing a _Checkpoint_ for a file left behind by an
+    // earlier run of the same render restores that state; _renderHash_
+    // identifies the scene and settings, and a file saved for any other
+    // render is ignored.
+    class Checkpoint {
+    public:
+        // Per-pixel state over the sample bounds that is saved and restored
+        // with the film, e.g. adaptive sampling's error estimates:
+        // _bytesPerPixel_ bytes for each pixel in scanline order. A tile
+        // updates its pixels' state in place while it renders; the state is
+        // taken into the checkpoint when the tile is merged, so that it
+        // always matches the saved pixels.
+        struct PixelState {
+            void *data;
+            size_t bytesPerPixel;
+        };
+
+        // The sample bounds are split into _tileSize_ squares, numbered in
+        // scanline order
+        Checkpoint(const std::string &filename, float interval, Film *film,
+                   const Bounds2i &sampleBounds, int tileSize,
+                   int64_t samplesPerPixel, int nPasses, uint64_t renderHash,
+                   const std::vector<PixelState> &pixelState =
+                           std::vector<PixelState>());
+        ~Checkpoint();
+
+        bool Resumed() const { return resumed; }
+        int Pass() const { return pass; }
+        bool TileDone(int tileIndex) const { return tilesDone[tileIndex] != 0; }
+
+        // Merges _tile_ into the film and records it as done; the two happen
+        // atomically with respect to saving, so a checkpoint never holds
+        // pixels from a tile that it does not list as done. Saves are
+        // written on a thread of their own, and tiles that arrive while one
+        // is under way are held back and merged once it is done.
+        void MergeFilmTile(std::unique_ptr<FilmTile> tile, int tileIndex);
+        // Waits for a save under way, so that all tiles are in the film;
+        // no tiles may be merged meanwhile
+        void Wait();
+        // Starts a new pass over all tiles
+        void StartPass(int pass);
+        // Removes the checkpoint file once the image has been written
+        void Finish();
+
+    private:
+        bool Load();
+        // Writes the film and the given state; runs on _saveThread_
+        void Save(std::vector<uint8_t> tiles, int pass);
+        // Saves on the calling thread if anything was merged since the last
+        // save
+        void SaveNow();
+        // Merges _tile_ and takes its pixels' state; called with _mutex_ held
+        void Merge(std::unique_ptr<FilmTile> tile, int tileIndex);
+
+        const std::string filename;
+        const std::chrono::steady_clock::duration interval;
+        Film *film;
+        const Bounds2i sampleBounds;
+        const int tileSize;
+        int nTilesX;
+        const int64_t samplesPerPixel;
+        const int nPasses;
+        const uint64_t renderHash;
+        int pass = 0;
+        std::vector<uint8_t> tilesDone;
+        bool resumed = false;
+        std::chrono::steady_clock::time_point lastSave;
+        std::mutex mutex;
+        std::condition_variable saveDone;
+        std::thread saveThread;
+        bool saving = false;
+        // Set when tiles were merged since the last save was started
+        bool unsaved = false;
+        bool finished = false;
+        std::vector<std::pair<std::unique_ptr<FilmTile>, int>> heldTiles;
+        // The state as of the last merge of each tile
+        std::vector<PixelState> pixelState;
+        std::vector<std::vector<uint8_t>> savedState;
+    };
+}
+#endif //PBRT_WHITTED_CHECKPOINT_H
@@ -3,12 +3,20 @@
 //
 
 #include "film.h"
+#include "paramset.h"
+#include <algorithm>
 
 
 namespace pbrt{
 
+    static bool IsEmpty(const Bounds2i &b) {
+        return b.pMin.x >= b.pMax.x || b.pMin.y >= b.pMax.y;
+    }
+
     Film::Film(const Point2i &resolution, const Bounds2f &cropWindow, std::unique_ptr<Filter> filt,
-               const std::string &filename, float scale):
+               const std::string &filename, float scale,
+               const std::string &backingFile, bool sampleFilter,
+               const std::string &previewSocket):
             fullResolution(resolution),
             filter(std::move(filt)),
             filename(filename),
@@ -19,7 +27,25 @@ namespace pbrt{
                          Point2i(std::ceil(fullResolution.x * cropWindow.pMax.x),
                                  std::ceil(fullResolution.y * cropWindow.pMax.y)));
 
-        pixels = std::unique_ptr<Pixel[]>(new Pixel[croppedPixelBounds.Area()]);
+        pixels = nullptr;
+        if (!backingFile.empty()) {
+            // A freshly truncated file reads as zeros, which is exactly a
+            // default-constructed _Pixel_, so the pixels are not touched here
+            // and only get paged in once rendering reaches them.
+            pixelFile = MappedFile::Create(
+                    backingFile, sizeof(Pixel) * (size_t)croppedPixelBounds.Area());
+            if (pixelFile)
+                pixels = (Pixel *)pixelFile->Data();
+            else
+                std::cerr << "Unable to map film backing file \"" << backingFile
+                          << "\"; keeping pixels in memory" << std::endl;
+        }
+        if (!pixels) {
+            pixels = new Pixel[croppedPixelBounds.Area()];
+            // Pages of a backing file belong to the page cache instead
+            TrackMemory(MemoryCategory::Film,
+                        sizeof(Pixel) * (int64_t)croppedPixelBounds.Area());
+        }
 
         int offset = 0;
         for (int y = 0; y < filterTableWidth; ++y) {
@@ -30,9 +56,46 @@ namespace pbrt{
                 filterTable[offset] = filter->Evaluate(p);
             }
         }
+
+        // Pick the cheapest way for _FilmTile_s to apply the filter
+        filterSplat = FilterSplat::General;
+        if (filter->IsSeparable()) {
+            for (int i = 0; i < filterTableWidth; ++i) {
+                filterTableX[i] = filter->Evaluate1D(
+                        (i + 0.5f) * filter->radius.x / filterTableWidth, 0);
+                filterTableY[i] = filter->Evaluate1D(
+                        (i + 0.5f) * filter->radius.y / filterTableWidth, 1);
+            }
+            filterSplat = FilterSplat::Separable;
+        }
+        bool constantFilter = std::all_of(
+                filterTable, filterTable + filterTableWidth * filterTableWidth,
+                [&](float v) { return v == filterTable[0]; });
+        if (constantFilter && filter->radius.x <= 0.5f && filter->radius.y <= 0.5f)
+            filterSplat = FilterSplat::Box;
+
+        if (sampleFilter) filterSampler.reset(new FilterSampler(filter.get()));
+        if (!previewSocket.empty())
+            preview = PreviewChannel::Create(previewSocket, fullResolution);
+        if (preview) {
+            Vector2i extent = croppedPixelBounds.Diagonal();
+            nPreviewTiles = Point2i((extent.x + PreviewTileSize - 1) / PreviewTileSize,
+                                    (extent.y + PreviewTileSize - 1) / PreviewTileSize);
+            previewDirty.assign(nPreviewTiles.x * nPreviewTiles.y, 0);
+        }
+    }
+
+    Film::~Film() {
+        if (!pixelFile) {
+            delete[] pixels;
+            TrackMemory(MemoryCategory::Film,
+                        -(int64_t)sizeof(Pixel) * croppedPixelBounds.Area());
+        }
     }
 
     Bounds2i Film::GetSampleBounds() const {
+        // Filter-sampled pixels only receive their own samples
+        if (filterSampler) return croppedPixelBounds;
         Bounds2f floatBounds(Floor(Point2f(croppedPixelBounds.pMin) +
                   Vector2f(0.5f, 0.5f) - filter->radius),
         Ceil(Point2f(croppedPixelBounds.pMax) -
@@ -40,20 +103,27 @@ namespace pbrt{
         return (Bounds2i)floatBounds;
     }
 
-    std::unique_ptr<FilmTile> Film::GetFilmTile(const Bounds2i &sampleBounds) {
+    Bounds2i Film::GetTilePixelBounds(const Bounds2i &sampleBounds) const {
+        if (filterSampler) return Intersect(sampleBounds, croppedPixelBounds);
         Vector2f halfPixel = Vector2f(0.5f, 0.5f);
         Bounds2f floatBounds = (Bounds2f)sampleBounds;
         Point2i p0 = (Point2i)Ceil(floatBounds.pMin - halfPixel - filter->radius);
         Point2i p1 = (Point2i)Floor(floatBounds.pMax - halfPixel + filter->radius) +
                      Point2i(1, 1);
-        Bounds2i tilePixelBounds = Intersect(Bounds2i(p0, p1), croppedPixelBounds);
+        return Intersect(Bounds2i(p0, p1), croppedPixelBounds);
+    }
+
+    std::unique_ptr<FilmTile> Film::GetFilmTile(const Bounds2i &sampleBounds) {
+        Bounds2i tilePixelBounds = GetTilePixelBounds(sampleBounds);
         return std::unique_ptr<FilmTile>(new FilmTile(
-                tilePixelBounds, filter->radius, filterTable, filterTableWidth));
+                tilePixelBounds, filter->radius, filterTable, filterTableWidth,
+                filterSplat, filterTableX, filterTableY));
     }
 
     void Film::MergeFilmTile(std::unique_ptr<FilmTile> tile) {
         std::lock_guard<std::mutex> lock(mutex);
-        for (Point2i pixel : tile->GetPixelBounds()) {
+        Bounds2i tilePixelBounds = tile->GetPixelBounds();
+        for (Point2i pixel : tilePixelBounds) {
             // Merge _pixel_ into _Film::pixels_
             const FilmTilePixel &tilePixel = tile->GetPixel(pixel);
             Pixel &mergePixel = GetPixel(pixel);
@@ -62,18 +132,278 @@ namespace pbrt{
             for (int i = 0; i < 3; ++i) mergePixel.xyz[i] += xyz[i];
             mergePixel.filterWeightSum += tilePixel.filterWeightSum;
         }
+        if (preview) UpdatePreview(tilePixelBounds);
+
+        // Handle output tiles whose pixels can no longer change
+        if (pendingMerges.empty() || IsEmpty(tilePixelBounds)) return;
+        Point2i t0 = Point2i((tilePixelBounds.pMin.x - croppedPixelBounds.pMin.x) / outputTileSize,
+                             (tilePixelBounds.pMin.y - croppedPixelBounds.pMin.y) / outputTileSize);
+        Point2i t1 = Point2i((tilePixelBounds.pMax.x - 1 - croppedPixelBounds.pMin.x) / outputTileSize,
+                             (tilePixelBounds.pMax.y - 1 - croppedPixelBounds.pMin.y) / outputTileSize);
+        for (int ty = t0.y; ty <= t1.y; ++ty)
+            for (int tx = t0.x; tx <= t1.x; ++tx) {
+                int tileIndex = ty * nOutputTiles.x + tx;
+                if (--pendingMerges[tileIndex] == 0) OutputTileDone(tileIndex);
+            }
+    }
+
+    void Film::SetTiling(int tileSize) {
+        std::lock_guard<std::mutex> lock(mutex);
+        tileWriter = ImageTileWriter::Create(filename, croppedPixelBounds,
+                                             fullResolution, tileSize);
+        if (!tileWriter && !pixelFile) return;
+        outputTileSize = tileSize;
+        Vector2i extent = croppedPixelBounds.Diagonal();
+        nOutputTiles = Point2i((extent.x + tileSize - 1) / tileSize,
+                               (extent.y + tileSize - 1) / tileSize);
+        pendingMerges.assign(nOutputTiles.x * nOutputTiles.y, 0);
+        pendingTilesInRow.assign(nOutputTiles.y, nOutputTiles.x);
+
+        // Count the _FilmTile_s that will be merged into each output tile,
+        // splitting the sample bounds the same way the integrator does
+        Bounds2i sampleBounds = GetSampleBounds();
+        for (int y0 = sampleBounds.pMin.y; y0 < sampleBounds.pMax.y; y0 += tileSize)
+            for (int x0 = sampleBounds.pMin.x; x0 < sampleBounds.pMax.x; x0 += tileSize) {
+                Bounds2i tileBounds(Point2i(x0, y0),
+                                    Min(Point2i(x0 + tileSize, y0 + tileSize),
+                                        sampleBounds.pMax));
+                Bounds2i pixelBounds = GetTilePixelBounds(tileBounds);
+                if (IsEmpty(pixelBounds)) continue;
+                for (int ty = (pixelBounds.pMin.y - croppedPixelBounds.pMin.y) / tileSize;
+                     ty <= (pixelBounds.pMax.y - 1 - croppedPixelBounds.pMin.y) / tileSize; ++ty)
+                    for (int tx = (pixelBounds.pMin.x - croppedPixelBounds.pMin.x) / tileSize;
+                         tx <= (pixelBounds.pMax.x - 1 - croppedPixelBounds.pMin.x) / tileSize; ++tx)
+                        ++pendingMerges[ty * nOutputTiles.x + tx];
+            }
+        for (size_t i = 0; i < pendingMerges.size(); ++i)
+            if (pendingMerges[i] == 0) OutputTileDone(i);
+    }
+
+    void Film::OutputTileDone(int tileIndex) {
+        if (tileWriter) WriteOutputTile(tileIndex);
+        int row = tileIndex / nOutputTiles.x;
+        if (--pendingTilesInRow[row] == 0 && pixelFile) {
+            // Every pixel in this band of rows is final; let it leave memory
+            int width = croppedPixelBounds.pMax.x - croppedPixelBounds.pMin.x;
+            int y0 = row * outputTileSize;
+            int y1 = std::min(y0 + outputTileSize,
+                              croppedPixelBounds.pMax.y - croppedPixelBounds.pMin.y);
+            pixelFile->Release(sizeof(Pixel) * (size_t)y0 * width,
+                               sizeof(Pixel) * (size_t)(y1 - y0) * width);
+        }
+    }
+
+    void Film::UpdatePreview(const Bounds2i &bounds, bool all) {
+        if (!IsEmpty(bounds)) {
+            Point2i t0 = Point2i((bounds.pMin.x - croppedPixelBounds.pMin.x) / PreviewTileSize,
+                                 (bounds.pMin.y - croppedPixelBounds.pMin.y) / PreviewTileSize);
+            Point2i t1 = Point2i((bounds.pMax.x - 1 - croppedPixelBounds.pMin.x) / PreviewTileSize,
+                                 (bounds.pMax.y - 1 - croppedPixelBounds.pMin.y) / PreviewTileSize);
+            for (int ty = t0.y; ty <= t1.y; ++ty)
+                for (int tx = t0.x; tx <= t1.x; ++tx)
+                    previewDirty[ty * nPreviewTiles.x + tx] = 1;
+        }
+
+        // Pixels are read when a square is sent, so one that had to wait
+        // for the viewer carries the latest values rather than stale ones
+        int nTiles = previewDirty.size();
+        std::vector<float> rgb;
+        for (int i = 1; i <= nTiles; ++i) {
+            int index = (previewNext + i) % nTiles;
+            if (!previewDirty[index]) continue;
+            Point2i p0 = croppedPixelBounds.pMin +
+                         Vector2i((index % nPreviewTiles.x) * PreviewTileSize,
+                                  (index / nPreviewTiles.x) * PreviewTileSize);
+            Bounds2i b(p0, Min(p0 + Vector2i(PreviewTileSize, PreviewTileSize),
+                               croppedPixelBounds.pMax));
+            rgb.resize(3 * b.Area());
+            GetPixelRGB(b, rgb.data(), 1);
+            // The viewer is not keeping up; the square stays flagged
+            if (!preview->SendTile(b, rgb.data())) return;
+            previewDirty[index] = 0;
+            previewNext = index;
+            if (!all) return;
+        }
+    }
+
+    Bounds2i Film::GetOutputTileBounds(int tileIndex) const {
+        Point2i p0 = croppedPixelBounds.pMin +
+                     Vector2i((tileIndex % nOutputTiles.x) * outputTileSize,
+                              (tileIndex / nOutputTiles.x) * outputTileSize);
+        Point2i p1 = Min(p0 + Vector2i(outputTileSize, outputTileSize),
+                         croppedPixelBounds.pMax);
+        return Bounds2i(p0, p1);
+    }
+
+    void Film::WriteOutputTile(int tileIndex) {
+        Bounds2i bounds = GetOutputTileBounds(tileIndex);
+        std::vector<float> rgb(3 * bounds.Area());
+        GetPixelRGB(bounds, rgb.data(), 1);
+        if (!tileWriter->WriteTile(bounds, rgb.data()) && !tileWriteFailed) {
+            std::cerr << "Error writing a tile of \"" << filename << "\""
+                      << std::endl;
+            tileWriteFailed = true;
+        }
+    }
+
+    void Film::GetPixelRGB(const Bounds2i &bounds, float *rgb,
+                           float splatScale) const {
+        int offset = 0;
+        for (Point2i p : bounds) {
+            // Convert pixel XYZ color to RGB
+            const Pixel &pixel = GetPixel(p);
+            XYZToRGB(pixel.xyz, &rgb[3 * offset]);
+
+            // Normalize pixel with weight sum
+            float filterWeightSum = pixel.filterWeightSum;
+            if (filterWeightSum != 0) {
+                float invWt = (float)1 / filterWeightSum;
+                rgb[3 * offset] = std::max((float)0, rgb[3 * offset] * invWt);
+                rgb[3 * offset + 1] =
+                        std::max((float)0, rgb[3 * offset + 1] * invWt);
+                rgb[3 * offset + 2] =
+                        std::max((float)0, rgb[3 * offset + 2] * invWt);
+            }
+
+            // Add splat value at pixel
+            float splatRGB[3];
+            float splatXYZ[3] = {pixel.splatXYZ[0], pixel.splatXYZ[1],
+                                 pixel.splatXYZ[2]};
+            XYZToRGB(splatXYZ, splatRGB);
+            rgb[3 * offset] += splatScale * splatRGB[0];
+            rgb[3 * offset + 1] += splatScale * splatRGB[1];
+            rgb[3 * offset + 2] += splatScale * splatRGB[2];
+
+            // Scale pixel value by _scale_
+            rgb[3 * offset] *= scale;
+            rgb[3 * offset + 1] *= scale;
+            rgb[3 * offset + 2] *= scale;
+            ++offset;
+        }
+    }
+
+    bool Film::WriteImage(float splatScale) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (preview) UpdatePreview(Bounds2i(), true);
+        if (tileWriter) {
+            // Flush tiles that never completed, e.g. after an aborted render
+            for (size_t i = 0; i < pendingMerges.size(); ++i)
+                if (pendingMerges[i] > 0) WriteOutputTile(i);
+            bool ok = tileWriter->Close() && !tileWriteFailed;
+            if (!ok)
+                std::cerr << "Error writing \"" << filename << "\"" << std::endl;
+            tileWriter.reset();
+            return ok;
+        }
+
+        std::unique_ptr<float[]> rgb(new float[3 * croppedPixelBounds.Area()]);
+        GetPixelRGB(croppedPixelBounds, rgb.get(), splatScale);
+        return pbrt::WriteImage(filename, rgb.get(), croppedPixelBounds,
+                                fullResolution);
     }
 
-    Film *CreateFilm(std::unique_ptr<Filter> filter) {
+    bool Film::WritePixels(FILE *f) {
+        std::lock_guard<std::mutex> lock(mutex);
+        int32_t layout[6] = {fullResolution.x, fullResolution.y,
+                             croppedPixelBounds.pMin.x, croppedPixelBounds.pMin.y,
+                             croppedPixelBounds.pMax.x, croppedPixelBounds.pMax.y};
+        if (fwrite(layout, sizeof(layout), 1, f) != 1) return false;
+        int width = croppedPixelBounds.pMax.x - croppedPixelBounds.pMin.x;
+        std::vector<float> row(7 * width);
+        for (int y = croppedPixelBounds.pMin.y; y < croppedPixelBounds.pMax.y; ++y) {
+            for (int x = 0; x < width; ++x) {
+                const Pixel &pixel =
+                        GetPixel(Point2i(croppedPixelBounds.pMin.x + x, y));
+                float *v = &row[7 * x];
+                v[0] = pixel.xyz[0];
+                v[1] = pixel.xyz[1];
+                v[2] = pixel.xyz[2];
+                v[3] = pixel.filterWeightSum;
+                v[4] = pixel.splatXYZ[0];
+                v[5] = pixel.splatXYZ[1];
+                v[6] = pixel.splatXYZ[2];
+            }
+            if (fwrite(row.data(), sizeof(float), row.size(), f) != row.size())
+                return false;
+        }
+        return true;
+    }
+
+    bool Film::ReadPixels(FILE *f) {
+        std::lock_guard<std::mutex> lock(mutex);
+        int32_t layout[6];
+        if (fread(layout, sizeof(layout), 1, f) != 1) return false;
+        if (layout[0] != fullResolution.x || layout[1] != fullResolution.y ||
+            layout[2] != croppedPixelBounds.pMin.x ||
+            layout[3] != croppedPixelBounds.pMin.y ||
+            layout[4] != croppedPixelBounds.pMax.x ||
+            layout[5] != croppedPixelBounds.pMax.y)
+            return false;
+        int width = croppedPixelBounds.pMax.x - croppedPixelBounds.pMin.x;
+        std::vector<float> row(7 * width);
+        for (int y = croppedPixelBounds.pMin.y; y < croppedPixelBounds.pMax.y; ++y) {
+            if (fread(row.data(), sizeof(float), row.size(), f) != row.size())
+                return false;
+            for (int x = 0; x < width; ++x) {
+                Pixel &pixel = GetPixel(Point2i(croppedPixelBounds.pMin.x + x, y));
+                const float *v = &row[7 * x];
+                pixel.xyz[0] = v[0];
+                pixel.xyz[1] = v[1];
+                pixel.xyz[2] = v[2];
+                pixel.filterWeightSum = v[3];
+                pixel.splatXYZ[0] = v[4];
+                pixel.splatXYZ[1] = v[5];
+                pixel.splatXYZ[2] = v[6];
+            }
+        }
+        return true;
+    }
+
+    Film *CreateFilm(const ParamSet &params, std::unique_ptr<Filter> filter,
+                     const std::string &viewName) {
+        // The command-line image file name overrides the scene's
         std::string filename;
-        filename = PbrtOptions.imageFile;
-        int xres = 1024;
-        int yres = 768;
+        if (!PbrtOptions.imageFile.empty()) {
+            filename = PbrtOptions.imageFile;
+            std::string paramsFilename = params.FindOneString("filename", "");
+            if (!paramsFilename.empty())
+                std::cerr << "Output filename supplied on command line, \""
+                          << PbrtOptions.imageFile
+                          << "\" is overriding filename provided in scene "
+                             "description file, \"" << paramsFilename << "\"."
+                          << std::endl;
+        } else
+            filename = params.FindOneString("filename", "pbrt.exr");
+        if (!viewName.empty()) {
+            size_t dot = filename.find_last_of('.');
+            size_t slash = filename.find_last_of('/');
+            if (dot == std::string::npos ||
+                (slash != std::string::npos && dot < slash))
+                dot = filename.size();
+            filename.insert(dot, "_" + viewName);
+        }
+        // Each view's pixels need a backing file of their own
+        std::string backingFile = PbrtOptions.filmBackingFile;
+        if (!backingFile.empty() && !viewName.empty())
+            backingFile += "." + viewName;
+        int xres = params.FindOneInt("xresolution", 1280);
+        int yres = params.FindOneInt("yresolution", 720);
         Bounds2f crop;
-        crop = Bounds2f(Point2f(Clamp(PbrtOptions.cropWindow[0][0], 0, 1),
-                                Clamp(PbrtOptions.cropWindow[1][0], 0, 1)),
-                        Point2f(Clamp(PbrtOptions.cropWindow[0][1], 0, 1),
-                                Clamp(PbrtOptions.cropWindow[1][1], 0, 1)));
-        return new Film(Point2i(xres,yres),crop,std::move(filter),filename,1);
+        int cwi;
+        const float *cr = params.FindFloat("cropwindow", &cwi);
+        if (cr && cwi == 4) {
+            crop.pMin.x = Clamp(std::min(cr[0], cr[1]), 0.f, 1.f);
+            crop.pMax.x = Clamp(std::max(cr[0], cr[1]), 0.f, 1.f);
+            crop.pMin.y = Clamp(std::min(cr[2], cr[3]), 0.f, 1.f);
+            crop.pMax.y = Clamp(std::max(cr[2], cr[3]), 0.f, 1.f);
+        } else
+            crop = Bounds2f(Point2f(Clamp(PbrtOptions.cropWindow[0][0], 0, 1),
+                                    Clamp(PbrtOptions.cropWindow[1][0], 0, 1)),
+                            Point2f(Clamp(PbrtOptions.cropWindow[0][1], 0, 1),
+                                    Clamp(PbrtOptions.cropWindow[1][1], 0, 1)));
+        float scale = params.FindOneFloat("scale", 1.);
+        return new Film(Point2i(xres,yres),crop,std::move(filter),filename,scale,
+                        backingFile, PbrtOptions.sampleFilter,
+                        PbrtOptions.previewSocket);
     }
 }
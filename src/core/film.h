@@ -10,6 +10,9 @@
 #include "filter.h"
 #include "spectrum.h"
 #include "parallel.h"
+#include "imageio.h"
+#include "preview.h"
+#include "memory.h"
 
 namespace pbrt{
     struct FilmTilePixel {
@@ -17,14 +20,43 @@ namespace pbrt{
         float filterWeightSum = 0.f;
     };
 
+    // How a _FilmTile_ distributes a sample over the pixels of its filter
+    // footprint; chosen once per film from the filter's properties.
+    enum class FilterSplat {
+        // Look up every pixel's weight in the 2D filter table
+        General,
+        // Product of two 1D tables, for separable filters
+        Separable,
+        // Constant weight over at most one pixel per axis (ties aside)
+        Box
+    };
+
     class Film{
     public:
         Film(const Point2i &resolution,const Bounds2f &cropWindow,
              std::unique_ptr<Filter> filter,
-             const std::string &filename, float scale);
+             const std::string &filename, float scale,
+             const std::string &backingFile = "",
+             bool sampleFilter = false,
+             const std::string &previewSocket = "");
+        ~Film();
         Bounds2i GetSampleBounds() const;
         std::unique_ptr<FilmTile> GetFilmTile(const Bounds2i &sampleBounds);
         void MergeFilmTile(std::unique_ptr<FilmTile> tile);
+        // Non-null when camera samples are to be drawn from the filter and
+        // added with _FilmTile::AddPixelSample()_
+        const FilterSampler *GetFilterSampler() const {
+            return filterSampler.get();
+        }
+        // Announces the tile size used to split _GetSampleBounds()_, so that
+        // tiles of final pixels can be streamed to disk as they complete.
+        void SetTiling(int tileSize);
+        // Returns _false_ if the image, or any tile streamed to it, could
+        // not be written
+        bool WriteImage(float splatScale = 1);
+        // Save and restore the accumulated pixel values, e.g. for checkpoints
+        bool WritePixels(FILE *f);
+        bool ReadPixels(FILE *f);
 
         const Point2i fullResolution;
         std::unique_ptr<Filter> filter;
@@ -49,26 +81,97 @@ namespace pbrt{
             return pixels[offset];
         }
 
-        std::unique_ptr<Pixel[]> pixels;
+        const Pixel &GetPixel(const Point2i &p) const {
+            assert(InsideExclusive(p, croppedPixelBounds));
+            int width = croppedPixelBounds.pMax.x - croppedPixelBounds.pMin.x;
+            int offset = (p.x - croppedPixelBounds.pMin.x) +
+                         (p.y - croppedPixelBounds.pMin.y) * width;
+            return pixels[offset];
+        }
+
+        Bounds2i GetTilePixelBounds(const Bounds2i &sampleBounds) const;
+        void GetPixelRGB(const Bounds2i &bounds, float *rgb,
+                         float splatScale) const;
+        Bounds2i GetOutputTileBounds(int tileIndex) const;
+        void WriteOutputTile(int tileIndex);
+        void OutputTileDone(int tileIndex);
+        // Flags the preview squares _bounds_ touches and sends the next
+        // changed one, or with _all_ every changed one
+        void UpdatePreview(const Bounds2i &bounds, bool all = false);
+
+        // _pixels_ points either to heap memory or into _pixelFile_
+        Pixel *pixels;
+        std::unique_ptr<MappedFile> pixelFile;
         static constexpr int filterTableWidth = 16;
         float filterTable[filterTableWidth * filterTableWidth];
+        FilterSplat filterSplat;
+        float filterTableX[filterTableWidth], filterTableY[filterTableWidth];
+        std::unique_ptr<FilterSampler> filterSampler;
         std::mutex mutex;
+
+        // Tile tracking: _pendingMerges_ counts, per output tile, the
+        // _FilmTile_s overlapping it that have not been merged yet. Once a
+        // tile's count drops to zero its pixels are final; they are streamed
+        // to _tileWriter_ and, for file-backed pixels, each finished row of
+        // tiles is evicted from memory.
+        std::unique_ptr<ImageTileWriter> tileWriter;
+        int outputTileSize = 0;
+        Point2i nOutputTiles;
+        std::vector<int> pendingMerges;
+        std::vector<int> pendingTilesInRow;
+        // Set when a streamed tile could not be written
+        bool tileWriteFailed = false;
+
+        // Live preview: the image is sent in squares of _PreviewTileSize_
+        // pixels. _previewDirty_ flags the squares changed since they were
+        // last sent, and the search for one to send resumes after
+        // _previewNext_, so that every square gets its turn.
+        std::unique_ptr<PreviewChannel> preview;
+        static constexpr int PreviewTileSize = 64;
+        Point2i nPreviewTiles;
+        std::vector<uint8_t> previewDirty;
+        int previewNext = 0;
     };
 
     class FilmTile {
     public:
         FilmTile(const Bounds2i &pixelBounds, const Vector2f &filterRadius,
-                 const float *filterTable, int filterTableSize)
+                 const float *filterTable, int filterTableSize,
+                 FilterSplat splat = FilterSplat::General,
+                 const float *filterTableX = nullptr,
+                 const float *filterTableY = nullptr)
                 : pixelBounds(pixelBounds),
                   filterRadius(filterRadius),
                   invFilterRadius(1 / filterRadius.x, 1 / filterRadius.y),
                   filterTable(filterTable),
-                  filterTableSize(filterTableSize) {
+                  filterTableSize(filterTableSize),
+                  splat(splat),
+                  filterTableX(filterTableX),
+                  filterTableY(filterTableY) {
             pixels = std::vector<FilmTilePixel>(std::max(0, pixelBounds.Area()));
+            if (splat == FilterSplat::Separable) {
+                weightsX.resize((int)std::ceil(2 * filterRadius.x) + 1);
+                weightsY.resize((int)std::ceil(2 * filterRadius.y) + 1);
+            }
         }
 
         void AddSample(const Point2f &pFilm, Spectrum L,
                        float sampleWeight = 1.) {
+            switch (splat) {
+                case FilterSplat::Box:
+                    AddSample<FilterSplat::Box>(pFilm, L, sampleWeight);
+                    break;
+                case FilterSplat::Separable:
+                    AddSample<FilterSplat::Separable>(pFilm, L, sampleWeight);
+                    break;
+                default:
+                    AddSample<FilterSplat::General>(pFilm, L, sampleWeight);
+            }
+        }
+
+        template <FilterSplat Splat>
+        void AddSample(const Point2f &pFilm, const Spectrum &L,
+                       float sampleWeight) {
 
             Point2f pFilmDiscrete = pFilm - Vector2f(0.5f, 0.5f);
             Point2i p0 = (Point2i)Ceil(pFilmDiscrete - filterRadius);
@@ -77,6 +180,42 @@ namespace pbrt{
             p0 = Max(p0, pixelBounds.pMin);
             p1 = Min(p1, pixelBounds.pMax);
 
+            if (Splat == FilterSplat::Box) {
+                // Every pixel in the footprint gets the same weight
+                float filterWeight = filterTable[0];
+                Spectrum contrib = L * sampleWeight * filterWeight;
+                for (int y = p0.y; y < p1.y; ++y)
+                    for (int x = p0.x; x < p1.x; ++x) {
+                        FilmTilePixel &pixel = GetPixel(Point2i(x, y));
+                        pixel.contribSum += contrib;
+                        pixel.filterWeightSum += filterWeight;
+                    }
+                return;
+            }
+
+            if (Splat == FilterSplat::Separable) {
+                // Look up the 1D weights once per column and once per row
+                for (int x = p0.x; x < p1.x; ++x) {
+                    float fx = std::abs((x - pFilmDiscrete.x) * invFilterRadius.x *
+                                        filterTableSize);
+                    weightsX[x - p0.x] =
+                            filterTableX[std::min((int)fx, filterTableSize - 1)];
+                }
+                for (int y = p0.y; y < p1.y; ++y) {
+                    float fy = std::abs((y - pFilmDiscrete.y) * invFilterRadius.y *
+                                        filterTableSize);
+                    weightsY[y - p0.y] =
+                            filterTableY[std::min((int)fy, filterTableSize - 1)];
+                }
+                Spectrum contrib = L * sampleWeight;
+                for (int y = p0.y; y < p1.y; ++y) {
+                    float wy = weightsY[y - p0.y];
+                    FilmTilePixel *row = &GetPixel(Point2i(p0.x, y));
+                    AddWeightedRow(row, p1.x - p0.x, contrib, wy, &weightsX[0]);
+                }
+                return;
+            }
+
             int *ifx = ALLOCA(int, p1.x - p0.x);
             for (int x = p0.x; x < p1.x; ++x) {
                 float fx = std::abs((x - pFilmDiscrete.x) * invFilterRadius.x *
@@ -104,6 +243,15 @@ namespace pbrt{
             }
         }
 
+        // Adds a sample whose film position was drawn from the filter around
+        // _pPixel_'s center; it only contributes to that pixel.
+        void AddPixelSample(const Point2i &pPixel, const Spectrum &L,
+                            float sampleWeight) {
+            FilmTilePixel &pixel = GetPixel(pPixel);
+            pixel.contribSum += L * sampleWeight;
+            pixel.filterWeightSum += sampleWeight;
+        }
+
         FilmTilePixel &GetPixel(const Point2i &p) {
             int width = pixelBounds.pMax.x - pixelBounds.pMin.x;
             int offset =
@@ -122,15 +270,35 @@ namespace pbrt{
 
 
     private:
+        // Adds _contrib_ weighted by _wy * wx[i]_ to _n_ consecutive pixels
+        static void AddWeightedRow(FilmTilePixel *row, int n,
+                                   const Spectrum &contrib, float wy,
+                                   const float *wx) {
+            // _Spectrum_ arithmetic is SIMD, so each pixel update is a
+            // vector multiply-add
+            Spectrum rowContrib = contrib * wy;
+            for (int i = 0; i < n; ++i) {
+                row[i].contribSum += rowContrib * wx[i];
+                row[i].filterWeightSum += wy * wx[i];
+            }
+        }
+
         const Bounds2i pixelBounds;
         const Vector2f filterRadius, invFilterRadius;
         const float *filterTable;
         const int filterTableSize;
+        const FilterSplat splat;
+        const float *filterTableX, *filterTableY;
+        std::vector<float> weightsX, weightsY;
         std::vector<FilmTilePixel> pixels;
         friend class Film;
     };
 
-    Film *CreateFilm(std::unique_ptr<Filter> filter);
+    // With a _viewName_, e.g. the name of one of several cameras, it is
+    // appended to the image file's base name: _out.pfm_ becomes
+    // _out_front.pfm_
+    Film *CreateFilm(const ParamSet &params, std::unique_ptr<Filter> filter,
+                     const std::string &viewName = "");
 
 }
 #endif //PBRT_WHITTED_FILM_H
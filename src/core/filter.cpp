@@ -7,4 +7,31 @@ namespace pbrt {
     Filter::~Filter() {
 
     }
+
+    FilterSampler::FilterSampler(const Filter *filter, int samplesPerUnit)
+            : radius(filter->radius) {
+        nx = std::max(1, (int)std::ceil(2 * radius.x * samplesPerUnit));
+        ny = std::max(1, (int)std::ceil(2 * radius.y * samplesPerUnit));
+        f.resize(nx * ny);
+        std::vector<float> absF(nx * ny);
+        for (int y = 0; y < ny; ++y)
+            for (int x = 0; x < nx; ++x) {
+                Point2f p(((x + 0.5f) / nx * 2 - 1) * radius.x,
+                          ((y + 0.5f) / ny * 2 - 1) * radius.y);
+                f[y * nx + x] = filter->Evaluate(p);
+                absF[y * nx + x] = std::abs(f[y * nx + x]);
+            }
+        distrib.reset(new Distribution2D(absF.data(), nx, ny));
+    }
+
+    FilterSample FilterSampler::Sample(const Point2f &u) const {
+        float pdf;
+        Point2f uv = distrib->SampleContinuous(u, &pdf);
+        int x = std::min((int)(uv.x * nx), nx - 1);
+        int y = std::min((int)(uv.y * ny), ny - 1);
+        FilterSample fs;
+        fs.p = Point2f((2 * uv.x - 1) * radius.x, (2 * uv.y - 1) * radius.y);
+        fs.weight = f[y * nx + x] < 0 ? -1 : 1;
+        return fs;
+    }
 }
@@ -7,6 +7,7 @@
 
 #include "main.h"
 #include "geometry.h"
+#include "sampling.h"
 
 namespace pbrt{
     class Filter {
@@ -14,9 +15,36 @@ namespace pbrt{
         virtual ~Filter();
         Filter(const Vector2f &radius):radius(radius), invRadius(Vector2f(1 / radius.x, 1 / radius.y)) {}
         virtual float Evaluate (const Point2f &p) const = 0;
+        // Separable filters are the product of a 1D filter along x and one
+        // along y, f(p) = Evaluate1D(p.x, 0) * Evaluate1D(p.y, 1), which lets
+        // the film tabulate and apply them one axis at a time.
+        virtual bool IsSeparable() const { return false; }
+        virtual float Evaluate1D(float, int) const { return 0; }
 
         const Vector2f radius, invRadius;
     };
 
+    struct FilterSample {
+        // Offset from the pixel center
+        Point2f p;
+        float weight;
+    };
+
+    // Draws offsets from a pixel's center with density proportional to the
+    // filter's magnitude, tabulated at _samplesPerUnit_ cells per pixel. The
+    // estimate f/pdf is then the same for every sample up to its sign, so
+    // _weight_ is +1, or -1 in the negative lobes of filters like Mitchell.
+    class FilterSampler {
+    public:
+        FilterSampler(const Filter *filter, int samplesPerUnit = 16);
+        FilterSample Sample(const Point2f &u) const;
+
+    private:
+        const Vector2f radius;
+        int nx, ny;
+        std::vector<float> f;
+        std::unique_ptr<Distribution2D> distrib;
+    };
+
 }
 #endif //PBRT_WHITTED_FILTER_H
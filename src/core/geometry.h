@@ -162,6 +162,17 @@ namespace pbrt {
         bool operator==(const Point2<T> &p) const { return x == p.x && y == p.y; }
         bool operator!=(const Point2<T> &p) const { return x != p.x || y != p.y; }
 
+        T operator[](int i) const {
+            if (i == 0) return x;
+            return y;
+        }
+
+        T &operator[](int i) {
+            assert(i >= 0 && i <= 1);
+            if (i == 0) return x;
+            return y;
+        }
+
         T x, y;
 
     };
@@ -189,6 +200,13 @@ namespace pbrt {
         Vector3<T> operator-(const Point3<T> &p) const {
             return Vector3<T>(x - p.x, y - p.y, z - p.z);
         }
+        Point3<T> operator+(const Point3<T> &p) const {
+            return Point3<T>(x + p.x, y + p.y, z + p.z);
+        }
+        template <typename U>
+        Point3<T> operator*(U f) const {
+            return Point3<T>(f * x, f * y, f * z);
+        }
 
         template <typename U>
         Point3<T> operator/(U f) const {
@@ -249,6 +267,11 @@ namespace pbrt {
         return p * f;
     }
 
+    template <typename T, typename U>
+    inline Point3<T> operator*(U f, const Point3<T> &p) {
+        return p * f;
+    }
+
     template <typename T>
     class Normal3 {
     public:
@@ -438,7 +461,20 @@ namespace pbrt {
                        std::min(p1.z, p2.z)),
                   pMax(std::max(p1.x, p2.x), std::max(p1.y, p2.y),
                        std::max(p1.z, p2.z)) {}
-
+        const Point3<T> &operator[](int i) const { return i == 0 ? pMin : pMax; }
+        Vector3<T> Diagonal() const { return pMax - pMin; }
+        int MaximumExtent() const {
+            Vector3<T> d = Diagonal();
+            if (d.x > d.y && d.x > d.z)
+                return 0;
+            else if (d.y > d.z)
+                return 1;
+            else
+                return 2;
+        }
+        // Slab test against a ray with precomputed reciprocal direction
+        inline bool IntersectP(const Ray &ray, const Vector3f &invDir,
+                               const int dirIsNeg[3]) const;
 
         Point3<T> pMin, pMax;
     };
@@ -448,6 +484,14 @@ namespace pbrt {
     typedef Bounds3<float> Bounds3f;
     typedef Bounds3<int> Bounds3i;
 
+    template <typename T>
+    Bounds3<T> Union(const Bounds3<T> &b1, const Bounds3<T> &b2) {
+        Bounds3<T> ret;
+        ret.pMin = Min(b1.pMin, b2.pMin);
+        ret.pMax = Max(b1.pMax, b2.pMax);
+        return ret;
+    }
+
     template <typename T>
     Bounds3<T> Union(const Bounds3<T> &b, const Point3<T> &p) {
         Bounds3<T> ret;
@@ -530,6 +574,35 @@ namespace pbrt {
         return ret;
     }
 
+    template <typename T>
+    inline bool Bounds3<T>::IntersectP(const Ray &ray, const Vector3f &invDir,
+                                       const int dirIsNeg[3]) const {
+        const Bounds3f &bounds = *this;
+        // Check for ray intersection against $x$ and $y$ slabs
+        float tMin = (bounds[dirIsNeg[0]].x - ray.o.x) * invDir.x;
+        float tMax = (bounds[1 - dirIsNeg[0]].x - ray.o.x) * invDir.x;
+        float tyMin = (bounds[dirIsNeg[1]].y - ray.o.y) * invDir.y;
+        float tyMax = (bounds[1 - dirIsNeg[1]].y - ray.o.y) * invDir.y;
+
+        // Update _tMax_ and _tyMax_ to ensure robust bounds intersection
+        tMax *= 1 + 2 * gamma(3);
+        tyMax *= 1 + 2 * gamma(3);
+        if (tMin > tyMax || tyMin > tMax) return false;
+        if (tyMin > tMin) tMin = tyMin;
+        if (tyMax < tMax) tMax = tyMax;
+
+        // Check for ray intersection against $z$ slab
+        float tzMin = (bounds[dirIsNeg[2]].z - ray.o.z) * invDir.z;
+        float tzMax = (bounds[1 - dirIsNeg[2]].z - ray.o.z) * invDir.z;
+
+        // Update _tzMax_ to ensure robust bounds intersection
+        tzMax *= 1 + 2 * gamma(3);
+        if (tMin > tzMax || tzMin > tMax) return false;
+        if (tzMin > tMin) tMin = tzMin;
+        if (tzMax < tMax) tMax = tzMax;
+        return (tMin < ray.tMax) && (tMax > 0);
+    }
+
     inline Point3f OffsetRayOrigin(const Point3f &p, const Normal3f &n, const Vector3f &w) {
         Vector3f pError = Vector3f(1,1,1);
         float d = Dot(Abs(n),pError);
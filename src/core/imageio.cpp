@@ -0,0 +1,412 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#include "imageio.h"
+#include <algorithm>
+#include <cctype>
+
+// All binary output below assumes a little-endian host, which is what both
+// PFM (negative scale) and OpenEXR expect on disk.
+
+namespace pbrt {
+
+    static inline float GammaCorrect(float value) {
+        if (value <= 0.0031308f) return 12.92f * value;
+        return 1.055f * std::pow(value, (float)(1.f / 2.4f)) - 0.055f;
+    }
+
+    static inline uint8_t ToByte(float v) {
+        return (uint8_t)Clamp(255.f * GammaCorrect(v) + 0.5f, 0.f, 255.f);
+    }
+
+    static bool HasExtension(const std::string &value, const std::string &ending) {
+        if (ending.size() > value.size()) return false;
+        return std::equal(ending.rbegin(), ending.rend(), value.rbegin(),
+                          [](char a, char b) { return std::tolower(a) == std::tolower(b); });
+    }
+
+    // PFM / PPM Helper Functions
+    static std::string PFMHeader(int width, int height) {
+        // A negative scale marks the pixel data as little-endian
+        return "PF\n" + std::to_string(width) + " " + std::to_string(height) +
+               "\n-1\n";
+    }
+
+    static std::string PPMHeader(int width, int height) {
+        return "P6\n" + std::to_string(width) + " " + std::to_string(height) +
+               "\n255\n";
+    }
+
+    // PNG Helper Functions
+    struct Crc32Table {
+        Crc32Table() {
+            for (uint32_t n = 0; n < 256; ++n) {
+                uint32_t c = n;
+                for (int k = 0; k < 8; ++k)
+                    c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+                table[n] = c;
+            }
+        }
+        uint32_t table[256];
+    };
+
+    static uint32_t Crc32(uint32_t crc, const uint8_t *data, size_t size) {
+        // Images may be written from several contexts at once; a local
+        // static is initialized exactly once
+        static const Crc32Table crcTable;
+        const uint32_t *table = crcTable.table;
+        crc = ~crc;
+        for (size_t i = 0; i < size; ++i)
+            crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+        return ~crc;
+    }
+
+    static void PutBigEndian32(std::vector<uint8_t> &buf, uint32_t v) {
+        buf.push_back(v >> 24);
+        buf.push_back(v >> 16);
+        buf.push_back(v >> 8);
+        buf.push_back(v);
+    }
+
+    // Returns _false_ if the chunk could not be written in full
+    static bool WritePNGChunk(FILE *f, const char type[4],
+                              const std::vector<uint8_t> &data) {
+        std::vector<uint8_t> chunk;
+        chunk.reserve(data.size() + 12);
+        PutBigEndian32(chunk, (uint32_t)data.size());
+        chunk.insert(chunk.end(), type, type + 4);
+        chunk.insert(chunk.end(), data.begin(), data.end());
+        PutBigEndian32(chunk, Crc32(0, &chunk[4], data.size() + 4));
+        return fwrite(chunk.data(), 1, chunk.size(), f) == chunk.size();
+    }
+
+    // Writes the image as a zlib stream of stored (uncompressed) deflate
+    // blocks, which needs neither a compressor nor an external library.
+    static bool WritePNG(const std::string &name, const uint8_t *rgb8,
+                         int width, int height) {
+        FILE *f = fopen(name.c_str(), "wb");
+        if (!f) return false;
+        static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+        bool ok = fwrite(signature, 1, 8, f) == 8;
+
+        std::vector<uint8_t> ihdr;
+        PutBigEndian32(ihdr, width);
+        PutBigEndian32(ihdr, height);
+        // 8 bits per channel, RGB, default compression, filter and interlace
+        ihdr.insert(ihdr.end(), {8, 2, 0, 0, 0});
+        ok = ok && WritePNGChunk(f, "IHDR", ihdr);
+
+        // Filtered scanlines: a zero filter byte followed by the row
+        size_t rowBytes = 3 * (size_t)width;
+        std::vector<uint8_t> raw((rowBytes + 1) * height);
+        for (int y = 0; y < height; ++y) {
+            raw[y * (rowBytes + 1)] = 0;
+            memcpy(&raw[y * (rowBytes + 1) + 1], rgb8 + y * rowBytes, rowBytes);
+        }
+
+        std::vector<uint8_t> idat = {0x78, 0x01};
+        uint32_t a = 1, b = 0;
+        size_t pos = 0;
+        bool final;
+        do {
+            size_t n = std::min<size_t>(65535, raw.size() - pos);
+            final = pos + n == raw.size();
+            idat.push_back(final ? 1 : 0);
+            idat.push_back(n & 0xff);
+            idat.push_back(n >> 8);
+            idat.push_back(~n & 0xff);
+            idat.push_back((~n >> 8) & 0xff);
+            for (size_t i = 0; i < n; ++i) {
+                uint8_t v = raw[pos + i];
+                idat.push_back(v);
+                a = (a + v) % 65521;
+                b = (b + a) % 65521;
+            }
+            pos += n;
+        } while (!final);
+        PutBigEndian32(idat, (b << 16) | a);
+        ok = ok && WritePNGChunk(f, "IDAT", idat) &&
+             WritePNGChunk(f, "IEND", std::vector<uint8_t>());
+        // The file is closed even after a failed write; a short write can
+        // also only show up when buffered data is flushed here
+        bool closed = fclose(f) == 0;
+        return ok && closed;
+    }
+
+    // EXR Helper Functions
+    template <typename T>
+    static void PutLittleEndian(std::vector<uint8_t> &buf, T v) {
+        const uint8_t *p = (const uint8_t *)&v;
+        buf.insert(buf.end(), p, p + sizeof(T));
+    }
+
+    static void PutAttribute(std::vector<uint8_t> &buf, const char *name,
+                             const char *type, const std::vector<uint8_t> &value) {
+        buf.insert(buf.end(), name, name + strlen(name) + 1);
+        buf.insert(buf.end(), type, type + strlen(type) + 1);
+        PutLittleEndian<int32_t>(buf, (int32_t)value.size());
+        buf.insert(buf.end(), value.begin(), value.end());
+    }
+
+    static void PutBox2i(std::vector<uint8_t> &buf, const Bounds2i &b) {
+        // OpenEXR boxes are inclusive
+        PutLittleEndian<int32_t>(buf, b.pMin.x);
+        PutLittleEndian<int32_t>(buf, b.pMin.y);
+        PutLittleEndian<int32_t>(buf, b.pMax.x - 1);
+        PutLittleEndian<int32_t>(buf, b.pMax.y - 1);
+    }
+
+    // Builds the magic number, version and header of a single-part,
+    // uncompressed, single-level tiled EXR file with float B, G, R channels.
+    static std::vector<uint8_t> EXRHeader(const Bounds2i &dataWindow,
+                                          const Point2i &totalResolution,
+                                          int tileSize) {
+        std::vector<uint8_t> buf;
+        PutLittleEndian<int32_t>(buf, 20000630);
+        // Version 2, with the "single tiled part" flag set
+        PutLittleEndian<int32_t>(buf, 2 | 0x200);
+
+        std::vector<uint8_t> v;
+        // Channels must be listed in alphabetical order
+        for (const char *ch : {"B", "G", "R"}) {
+            v.insert(v.end(), ch, ch + 2);
+            PutLittleEndian<int32_t>(v, 2);  // FLOAT
+            v.insert(v.end(), {0, 0, 0, 0}); // pLinear + reserved
+            PutLittleEndian<int32_t>(v, 1);  // xSampling
+            PutLittleEndian<int32_t>(v, 1);  // ySampling
+        }
+        v.push_back(0);
+        PutAttribute(buf, "channels", "chlist", v);
+
+        PutAttribute(buf, "compression", "compression", {0});
+
+        v.clear();
+        PutBox2i(v, dataWindow);
+        PutAttribute(buf, "dataWindow", "box2i", v);
+
+        v.clear();
+        PutBox2i(v, Bounds2i(Point2i(0, 0), totalResolution));
+        PutAttribute(buf, "displayWindow", "box2i", v);
+
+        PutAttribute(buf, "lineOrder", "lineOrder", {0});
+
+        v.clear();
+        PutLittleEndian<float>(v, 1.f);
+        PutAttribute(buf, "pixelAspectRatio", "float", v);
+
+        v.clear();
+        PutLittleEndian<float>(v, 0.f);
+        PutLittleEndian<float>(v, 0.f);
+        PutAttribute(buf, "screenWindowCenter", "v2f", v);
+
+        v.clear();
+        PutLittleEndian<float>(v, 1.f);
+        PutAttribute(buf, "screenWindowWidth", "float", v);
+
+        v.clear();
+        PutLittleEndian<uint32_t>(v, tileSize);
+        PutLittleEndian<uint32_t>(v, tileSize);
+        v.push_back(0);  // ONE_LEVEL, ROUND_DOWN
+        PutAttribute(buf, "tiles", "tiledesc", v);
+
+        buf.push_back(0);
+        return buf;
+    }
+
+    // ImageTileWriter Method Definitions
+    ImageTileWriter::~ImageTileWriter() {
+        if (f) fclose(f);
+    }
+
+    bool ImageTileWriter::Close() {
+        if (!f) return false;
+        bool closed = fclose(f) == 0;
+        f = nullptr;
+        return ok && closed;
+    }
+
+    bool ImageTileWriter::WriteAt(int64_t offset, const void *data, size_t size) {
+        if (fseeko(f, (off_t)offset, SEEK_SET) != 0 ||
+            fwrite(data, 1, size, f) != size)
+            ok = false;
+        return ok;
+    }
+
+    class PFMTileWriter : public ImageTileWriter {
+    public:
+        PFMTileWriter(FILE *f, const Bounds2i &outputBounds)
+                : ImageTileWriter(f, outputBounds) {
+            Vector2i res = outputBounds.Diagonal();
+            std::string header = PFMHeader(res.x, res.y);
+            dataOffset = header.size();
+            WriteAt(0, header.data(), header.size());
+        }
+
+        bool WriteTile(const Bounds2i &tileBounds, const float *rgb) override {
+            Vector2i res = outputBounds.Diagonal();
+            int width = tileBounds.pMax.x - tileBounds.pMin.x;
+            for (int y = tileBounds.pMin.y; y < tileBounds.pMax.y; ++y) {
+                // PFM stores scanlines from the bottom of the image up
+                int row = res.y - 1 - (y - outputBounds.pMin.y);
+                int64_t offset = dataOffset +
+                                 ((int64_t)row * res.x +
+                                  (tileBounds.pMin.x - outputBounds.pMin.x)) *
+                                 3 * sizeof(float);
+                if (!WriteAt(offset, rgb + 3 * (y - tileBounds.pMin.y) * width,
+                             3 * width * sizeof(float)))
+                    return false;
+            }
+            return true;
+        }
+
+    private:
+        int64_t dataOffset;
+    };
+
+    class PPMTileWriter : public ImageTileWriter {
+    public:
+        PPMTileWriter(FILE *f, const Bounds2i &outputBounds)
+                : ImageTileWriter(f, outputBounds) {
+            Vector2i res = outputBounds.Diagonal();
+            std::string header = PPMHeader(res.x, res.y);
+            dataOffset = header.size();
+            WriteAt(0, header.data(), header.size());
+        }
+
+        bool WriteTile(const Bounds2i &tileBounds, const float *rgb) override {
+            Vector2i res = outputBounds.Diagonal();
+            int width = tileBounds.pMax.x - tileBounds.pMin.x;
+            std::vector<uint8_t> row(3 * width);
+            for (int y = tileBounds.pMin.y; y < tileBounds.pMax.y; ++y) {
+                const float *src = rgb + 3 * (y - tileBounds.pMin.y) * width;
+                for (int i = 0; i < 3 * width; ++i) row[i] = ToByte(src[i]);
+                int64_t offset = dataOffset +
+                                 ((int64_t)(y - outputBounds.pMin.y) * res.x +
+                                  (tileBounds.pMin.x - outputBounds.pMin.x)) * 3;
+                if (!WriteAt(offset, row.data(), row.size())) return false;
+            }
+            return true;
+        }
+
+    private:
+        int64_t dataOffset;
+    };
+
+    // Uncompressed tiles all have a known size, so the offset table and the
+    // position of every tile are fixed when the file is opened and tiles can
+    // be written in whatever order they are finished.
+    class EXRTileWriter : public ImageTileWriter {
+    public:
+        EXRTileWriter(FILE *f, const Bounds2i &outputBounds,
+                      const Point2i &totalResolution, int tileSize)
+                : ImageTileWriter(f, outputBounds), tileSize(tileSize) {
+            Vector2i res = outputBounds.Diagonal();
+            nTiles = Point2i((res.x + tileSize - 1) / tileSize,
+                             (res.y + tileSize - 1) / tileSize);
+            std::vector<uint8_t> header =
+                    EXRHeader(outputBounds, totalResolution, tileSize);
+
+            tileOffsets.resize(nTiles.x * nTiles.y);
+            int64_t offset = header.size() + tileOffsets.size() * sizeof(uint64_t);
+            for (int ty = 0; ty < nTiles.y; ++ty)
+                for (int tx = 0; tx < nTiles.x; ++tx) {
+                    tileOffsets[ty * nTiles.x + tx] = offset;
+                    Bounds2i b = TileBounds(tx, ty);
+                    offset += 5 * sizeof(int32_t) + 3 * sizeof(float) * b.Area();
+                }
+            for (uint64_t o : tileOffsets) PutLittleEndian<uint64_t>(header, o);
+            WriteAt(0, header.data(), header.size());
+        }
+
+        bool WriteTile(const Bounds2i &tileBounds, const float *rgb) override {
+            int tx = (tileBounds.pMin.x - outputBounds.pMin.x) / tileSize;
+            int ty = (tileBounds.pMin.y - outputBounds.pMin.y) / tileSize;
+            // EXR tiles are fixed on the file's tile grid
+            assert(tileBounds == TileBounds(tx, ty));
+            int width = tileBounds.pMax.x - tileBounds.pMin.x;
+            int height = tileBounds.pMax.y - tileBounds.pMin.y;
+
+            std::vector<uint8_t> block;
+            block.reserve(5 * sizeof(int32_t) + 3 * sizeof(float) * width * height);
+            PutLittleEndian<int32_t>(block, tx);
+            PutLittleEndian<int32_t>(block, ty);
+            PutLittleEndian<int32_t>(block, 0);
+            PutLittleEndian<int32_t>(block, 0);
+            PutLittleEndian<int32_t>(block, 3 * sizeof(float) * width * height);
+            // Each scanline holds all B values, then all G, then all R
+            for (int y = 0; y < height; ++y)
+                for (int c = 2; c >= 0; --c)
+                    for (int x = 0; x < width; ++x)
+                        PutLittleEndian<float>(block, rgb[3 * (y * width + x) + c]);
+            return WriteAt(tileOffsets[ty * nTiles.x + tx], block.data(),
+                           block.size());
+        }
+
+    private:
+        Bounds2i TileBounds(int tx, int ty) const {
+            Point2i p0 = outputBounds.pMin + Vector2i(tx * tileSize, ty * tileSize);
+            Point2i p1 = Min(p0 + Vector2i(tileSize, tileSize), outputBounds.pMax);
+            return Bounds2i(p0, p1);
+        }
+
+        const int tileSize;
+        Point2i nTiles;
+        std::vector<uint64_t> tileOffsets;
+    };
+
+    std::unique_ptr<ImageTileWriter> ImageTileWriter::Create(
+            const std::string &name, const Bounds2i &outputBounds,
+            const Point2i &totalResolution, int tileSize) {
+        bool pfm = HasExtension(name, ".pfm"), ppm = HasExtension(name, ".ppm");
+        bool exr = HasExtension(name, ".exr");
+        if (!pfm && !ppm && !exr) return nullptr;
+
+        FILE *f = fopen(name.c_str(), "wb");
+        if (!f) {
+            std::cerr << "Unable to open output file \"" << name << "\"" << std::endl;
+            return nullptr;
+        }
+        ImageTileWriter *writer;
+        if (pfm)
+            writer = new PFMTileWriter(f, outputBounds);
+        else if (ppm)
+            writer = new PPMTileWriter(f, outputBounds);
+        else
+            writer = new EXRTileWriter(f, outputBounds, totalResolution, tileSize);
+        return std::unique_ptr<ImageTileWriter>(writer);
+    }
+
+    bool WriteImage(const std::string &name, const float *rgb,
+                    const Bounds2i &outputBounds, const Point2i &totalResolution) {
+        Vector2i resolution = outputBounds.Diagonal();
+        if (HasExtension(name, ".png")) {
+            std::vector<uint8_t> rgb8(3 * resolution.x * resolution.y);
+            for (size_t i = 0; i < rgb8.size(); ++i) rgb8[i] = ToByte(rgb[i]);
+            if (!WritePNG(name, rgb8.data(), resolution.x, resolution.y)) {
+                std::cerr << "Error writing PNG \"" << name << "\"" << std::endl;
+                return false;
+            }
+            return true;
+        }
+
+        if (!HasExtension(name, ".pfm") && !HasExtension(name, ".ppm") &&
+            !HasExtension(name, ".exr")) {
+            std::cerr << "Can't determine image file type from suffix of filename \""
+                      << name << "\"" << std::endl;
+            return false;
+        }
+
+        // The remaining formats are written as a single tile
+        int tileSize = std::max(resolution.x, resolution.y);
+        std::unique_ptr<ImageTileWriter> writer =
+                ImageTileWriter::Create(name, outputBounds, totalResolution, tileSize);
+        if (!writer) return false;
+        writer->WriteTile(outputBounds, rgb);
+        if (!writer->Close()) {
+            std::cerr << "Error writing \"" << name << "\"" << std::endl;
+            return false;
+        }
+        return true;
+    }
+}
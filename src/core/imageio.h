@@ -0,0 +1,49 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#ifndef PBRT_WHITTED_IMAGEIO_H
+#define PBRT_WHITTED_IMAGEIO_H
+
+#include "main.h"
+#include "geometry.h"
+#include <cstdio>
+
+namespace pbrt {
+
+    // Writes a complete image of linear RGB values. The format is chosen by
+    // the extension of _name_: ".pfm" and ".exr" store floats, ".png" and
+    // ".ppm" store gamma-corrected 8-bit values. Returns _false_ if the file
+    // could not be written.
+    bool WriteImage(const std::string &name, const float *rgb,
+                    const Bounds2i &outputBounds, const Point2i &totalResolution);
+
+    // Streams an image to disk one tile at a time, in any order. Only formats
+    // whose pixel layout has a fixed size per tile can be written this way
+    // (PFM, PPM and uncompressed tiled EXR); _Create()_ returns _nullptr_ for
+    // the others so that the caller falls back to _WriteImage()_.
+    class ImageTileWriter {
+    public:
+        static std::unique_ptr<ImageTileWriter> Create(
+                const std::string &name, const Bounds2i &outputBounds,
+                const Point2i &totalResolution, int tileSize);
+        virtual ~ImageTileWriter();
+
+        // _rgb_ holds _tileBounds.Area()_ linear RGB triples in scanline
+        // order; _tileBounds_ must lie inside the output bounds. Returns
+        // _false_ if the tile could not be written.
+        virtual bool WriteTile(const Bounds2i &tileBounds, const float *rgb) = 0;
+        // Returns _false_ if any write, including the header's, failed
+        bool Close();
+
+    protected:
+        ImageTileWriter(FILE *f, const Bounds2i &outputBounds)
+                : f(f), outputBounds(outputBounds) {}
+        bool WriteAt(int64_t offset, const void *data, size_t size);
+
+        FILE *f;
+        bool ok = true;
+        const Bounds2i outputBounds;
+    };
+}
+#endif //PBRT_WHITTED_IMAGEIO_H
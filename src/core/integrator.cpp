@@ -8,88 +8,313 @@
 #include "parallel.h"
 #include "film.h"
 #include "sampler.h"
+#include "checkpoint.h"
+#include "sampling.h"
 
 #include "camera.h"
+#include <algorithm>
 
 namespace pbrt{
+    // Below this mean radiance, adaptive sampling measures absolute rather
+    // than relative error, so that dark pixels can converge
+    static constexpr float AdaptiveMinMean = 1e-2f;
+
     Integrator::~Integrator() {}
 
+    // One view's share of a render: its tiles, sample range and error
+    // estimates
+    struct SamplerIntegrator::ViewState {
+        SamplerIntegrator *integrator;
+        Bounds2i sampleBounds;
+        Vector2i sampleExtent;
+        Point2i nTiles;
+        int64_t samplesPerPixel;
+        int nPasses, firstPass = 0;
+        std::unique_ptr<Checkpoint> checkpoint;
+        const FilterSampler *filterSampler;
+        std::vector<VarianceEstimator> pixelVariance;
+        std::vector<uint8_t> pixelConverged;
+        // The range of sample indices of the current pass
+        int64_t firstSample = 0, endSample = 0;
+    };
+
+    // What all views of a render share
+    struct SamplerIntegrator::RenderSettings {
+        bool progressive, adaptive;
+        float adaptiveThreshold;
+        int64_t minSamples;
+        std::function<bool()> deadlinePassed;
+        std::atomic<int64_t> samplesTaken{0}, samplesSkipped{0};
+    };
+
+    static constexpr int TileSize = 16;
+
     void SamplerIntegrator::Render(const Scene &scene) {
-        Bounds2i sampleBounds = camera->film->GetSampleBounds();
-        Vector2i sampleExtent = sampleBounds.Diagonal();
-        const int tileSize = 16;
-        Point2i nTiles((sampleExtent.x + tileSize - 1) / tileSize,
-                       (sampleExtent.y + tileSize - 1) / tileSize);
-
-        {
-            ParallelFor2D([&](Point2i tile) {
-                // Allocate _MemoryArena_ for tile
-                MemoryArena arena;
-
-                // Get sampler instance for tile
-                int seed = tile.y * nTiles.x + tile.x;
-                std::unique_ptr<Sampler> tileSampler = sampler->Clone(seed);
-
-                // Compute sample bounds for tile
-                int x0 = sampleBounds.pMin.x + tile.x * tileSize;
-                int x1 = std::min(x0 + tileSize, sampleBounds.pMax.x);
-                int y0 = sampleBounds.pMin.y + tile.y * tileSize;
-                int y1 = std::min(y0 + tileSize, sampleBounds.pMax.y);
-                Bounds2i tileBounds(Point2i(x0, y0), Point2i(x1, y1));
-
-                // Get _FilmTile_ for tile
-                std::unique_ptr<FilmTile> filmTile =
-                        camera->film->GetFilmTile(tileBounds);
-
-                for (Point2i pixel : tileBounds) {
-                    {
-                        tileSampler->StartPixel(pixel);
-                    }
+        RenderViews(scene, std::vector<SamplerIntegrator *>(1, this));
+    }
+
+    void SamplerIntegrator::RenderViews(
+            const Scene &scene, const std::vector<SamplerIntegrator *> &integrators) {
+        // Progressive rendering takes passes over the whole image, each one
+        // doubling the samples so far (1, 1, 2, 4, ...), and writes the
+        // image after every pass. Otherwise a single pass takes all samples
+        // and finished output tiles can be streamed to disk as they complete.
+        // _PbrtOptions_ belongs to this thread's context, so the tile loop
+        // below only reads copies of it.
+        RenderSettings settings;
+        settings.progressive = PbrtOptions.progressive;
+
+        // After the deadline, the pass under way skips its remaining tiles
+        // and no further passes start; the first pass always completes.
+        const auto startTime = std::chrono::steady_clock::now();
+        const float renderDeadline = PbrtOptions.renderDeadline;
+        settings.deadlinePassed = [=]() {
+            return renderDeadline > 0 &&
+                   std::chrono::steady_clock::now() - startTime >=
+                           std::chrono::duration<float>(renderDeadline);
+        };
+
+        // With adaptive sampling, _samplesPerPixel_ is only the maximum;
+        // pixels check their error whenever their sample count reaches
+        // _minSamples_ times a power of two. Progressive passes keep each
+        // pixel's estimate from one pass to the next.
+        settings.adaptiveThreshold = PbrtOptions.adaptiveThreshold;
+        settings.adaptive = settings.adaptiveThreshold > 0;
+        settings.minSamples = std::max<int64_t>(1, PbrtOptions.adaptiveMinSamples);
+
+        std::vector<std::unique_ptr<ViewState>> views;
+        int firstPass = std::numeric_limits<int>::max(), nPasses = 0;
+        for (size_t i = 0; i < integrators.size(); ++i) {
+            SamplerIntegrator *integrator = integrators[i];
+            const Camera *camera = integrator->camera.get();
+            integrator->Preprocess(scene, *integrator->sampler);
+            std::unique_ptr<ViewState> view(new ViewState);
+            view->integrator = integrator;
+            view->sampleBounds = camera->film->GetSampleBounds();
+            view->sampleExtent = view->sampleBounds.Diagonal();
+            view->nTiles = Point2i((view->sampleExtent.x + TileSize - 1) / TileSize,
+                                   (view->sampleExtent.y + TileSize - 1) / TileSize);
+            view->samplesPerPixel = integrator->sampler->samplesPerPixel;
+            view->nPasses = settings.progressive
+                            ? 1 + Log2Int(RoundUpPow2(view->samplesPerPixel)) : 1;
+            if (!settings.progressive) camera->film->SetTiling(TileSize);
+
+            view->filterSampler = camera->film->GetFilterSampler();
+            if (settings.adaptive && settings.progressive) {
+                view->pixelVariance.resize(view->sampleBounds.Area());
+                view->pixelConverged.resize(view->sampleBounds.Area());
+            }
+
+            // Resume from an earlier, interrupted run of this render if
+            // possible; every view after the first has a file of its own.
+            // The error estimates that carry over from one pass to the next
+            // are saved with the film.
+            if (!PbrtOptions.checkpointFile.empty()) {
+                std::string filename = PbrtOptions.checkpointFile;
+                if (i > 0) filename += "." + std::to_string(i);
+                std::vector<Checkpoint::PixelState> pixelState;
+                if (!view->pixelVariance.empty()) {
+                    pixelState.push_back({view->pixelVariance.data(),
+                                          sizeof(VarianceEstimator)});
+                    pixelState.push_back({view->pixelConverged.data(),
+                                          sizeof(uint8_t)});
+                }
+                view->checkpoint.reset(new Checkpoint(
+                        filename, PbrtOptions.checkpointInterval, camera->film,
+                        view->sampleBounds, TileSize, view->samplesPerPixel,
+                        view->nPasses, integrator->renderHash, pixelState));
+                view->firstPass = view->checkpoint->Pass();
+            }
+            firstPass = std::min(firstPass, view->firstPass);
+            nPasses = std::max(nPasses, view->nPasses);
+            views.push_back(std::move(view));
+        }
+
+        for (int pass = firstPass; pass < nPasses; ++pass) {
+            // The tiles of all views taking part in this pass are laid end
+            // to end and handed to one parallel loop, so that the threads
+            // move on to the next view's tiles rather than wait for the
+            // last tile of one view
+            std::vector<ViewState *> passViews;
+            std::vector<int64_t> tileStart(1, 0);
+            int64_t endSample = 0;
+            for (auto &view : views) {
+                if (pass < view->firstPass || pass >= view->nPasses) continue;
+                // Compute the range of sample indices for this pass
+                view->firstSample = 0;
+                view->endSample = view->samplesPerPixel;
+                if (settings.progressive) {
+                    view->firstSample = pass == 0 ? 0 : (int64_t)1 << (pass - 1);
+                    view->endSample =
+                            std::min((int64_t)1 << pass, view->samplesPerPixel);
+                }
+                if (view->checkpoint && pass > view->firstPass)
+                    view->checkpoint->StartPass(pass);
+                endSample = std::max(endSample, view->endSample);
+                passViews.push_back(view.get());
+                tileStart.push_back(tileStart.back() +
+                                    view->nTiles.x * view->nTiles.y);
+            }
+
+            ParallelFor([&](int64_t index) {
+                size_t v = std::upper_bound(tileStart.begin(), tileStart.end(),
+                                            index) - tileStart.begin() - 1;
+                ViewState &view = *passViews[v];
+                int tileIndex = (int)(index - tileStart[v]);
+                view.integrator->RenderTile(
+                        scene, view, settings, pass,
+                        Point2i(tileIndex % view.nTiles.x, tileIndex / view.nTiles.x));
+            }, tileStart.back());
+            // Tiles held back by a checkpoint save are merged once it is done
+            for (ViewState *view : passViews)
+                if (view->checkpoint) view->checkpoint->Wait();
+
+            if (settings.progressive) {
+                std::cout << "Pass " << pass + 1 << " of " << nPasses << ": "
+                          << endSample << " samples per pixel" << std::endl;
+                if (settings.deadlinePassed()) break;
+                for (ViewState *view : passViews)
+                    if (pass + 1 < view->nPasses)
+                        view->integrator->camera->film->WriteImage();
+            }
+        }
+
+        if (settings.adaptive)
+            std::cout << "Adaptive sampling took " << settings.samplesTaken
+                      << " of " << settings.samplesTaken + settings.samplesSkipped
+                      << " samples" << std::endl;
+
+        // Save final images after rendering; the checkpoint is kept if the
+        // image could not be written, so the samples are not lost
+        for (auto &view : views) {
+            bool written = view->integrator->camera->film->WriteImage();
+            if (view->checkpoint && written) view->checkpoint->Finish();
+        }
+    }
+
+    void SamplerIntegrator::RenderTile(const Scene &scene, ViewState &view,
+                                       RenderSettings &settings, int pass,
+                                       Point2i tile) {
+        const Bounds2i &sampleBounds = view.sampleBounds;
+        const int64_t firstSample = view.firstSample, endSample = view.endSample;
+        int tileIndex = tile.y * view.nTiles.x + tile.x;
+
+        // Compute sample bounds for tile
+        int x0 = sampleBounds.pMin.x + tile.x * TileSize;
+        int x1 = std::min(x0 + TileSize, sampleBounds.pMax.x);
+        int y0 = sampleBounds.pMin.y + tile.y * TileSize;
+        int y1 = std::min(y0 + TileSize, sampleBounds.pMax.y);
+        Bounds2i tileBounds(Point2i(x0, y0), Point2i(x1, y1));
+
+        // Skip tiles restored from the checkpoint; merging an empty
+        // tile keeps the film's output tracking up to date
+        if (view.checkpoint && view.checkpoint->TileDone(tileIndex)) {
+            camera->film->MergeFilmTile(camera->film->GetFilmTile(tileBounds));
+            return;
+        }
+        if (pass > 0 && settings.deadlinePassed()) return;
+
+        // Allocate _MemoryArena_ for tile
+        MemoryArena arena;
+
+        // Get sampler instance for tile; samplers seed themselves
+        // per pixel and sample, so every tile gets the same seed and
+        // the image does not depend on the tiling
+        std::unique_ptr<Sampler> tileSampler = sampler->Clone(0);
+
+        // Get _FilmTile_ for tile
+        std::unique_ptr<FilmTile> filmTile =
+                camera->film->GetFilmTile(tileBounds);
+
+        for (Point2i pixel : tileBounds) {
+            {
+                tileSampler->StartPixel(pixel);
+            }
+
+            // Do this check after the StartPixel() call; this keeps
+            // the usage of RNG values from (most) Samplers that use
+            // RNGs consistent, which improves reproducability /
+            // debugging.
+            if (!InsideExclusive(pixel, pixelBounds))
+                continue;
+
+            // Find the pixel's error estimate and skip it if it has
+            // converged in an earlier pass
+            VarianceEstimator localVariance;
+            VarianceEstimator *variance = &localVariance;
+            uint8_t *converged = nullptr;
+            if (!view.pixelVariance.empty()) {
+                int offset = (pixel.y - sampleBounds.pMin.y) * view.sampleExtent.x +
+                             (pixel.x - sampleBounds.pMin.x);
+                variance = &view.pixelVariance[offset];
+                converged = &view.pixelConverged[offset];
+                if (*converged) {
+                    settings.samplesSkipped += endSample - firstSample;
+                    continue;
+                }
+            }
+            if (firstSample > 0) tileSampler->SetSampleNumber(firstSample);
+
+            do {
+                // Initialize _CameraSample_ for current sample
+                CameraSample cameraSample =
+                        tileSampler->GetCameraSample(pixel, view.filterSampler);
+
+                // Generate camera ray for current sample
+                RayDifferential ray;
+                float rayWeight =
+                        camera->GenerateRayDifferential(cameraSample, &ray);
+                ray.ScaleDifferentials(
+                        1 / std::sqrt((float) tileSampler->samplesPerPixel));
+
+                // Evaluate radiance along camera ray
+                Spectrum L(0.f);
+                if (rayWeight > 0) L = Li(ray, scene, *tileSampler, arena);
+
+                // Issue warning if unexpected radiance value returned
+                if (L.HasNaNs()) {
+                    L = Spectrum(0.f);
+                } else if (L.y() < -1e-5) {
+                    L = Spectrum(0.f);
+                } else if (std::isinf(L.y())) {
+                    L = Spectrum(0.f);
+                }
+
+
+                // Add camera ray's contribution to image
+                if (view.filterSampler)
+                    filmTile->AddPixelSample(
+                            pixel, L, rayWeight * cameraSample.filterWeight);
+                else
+                    filmTile->AddSample(cameraSample.pFilm, L, rayWeight);
+
+                // Free _MemoryArena_ memory from computing image sample
+                // value
+                arena.Reset();
+                ++settings.samplesTaken;
 
-                    // Do this check after the StartPixel() call; this keeps
-                    // the usage of RNG values from (most) Samplers that use
-                    // RNGs consistent, which improves reproducability /
-                    // debugging.
-                    if (!InsideExclusive(pixel, pixelBounds))
-                        continue;
-
-                    do {
-                        // Initialize _CameraSample_ for current sample
-                        CameraSample cameraSample =
-                                tileSampler->GetCameraSample(pixel);
-
-                        // Generate camera ray for current sample
-                        RayDifferential ray;
-                        float rayWeight =
-                                camera->GenerateRayDifferential(cameraSample, &ray);
-                        ray.ScaleDifferentials(
-                                1 / std::sqrt((float) tileSampler->samplesPerPixel));
-
-                        // Evaluate radiance along camera ray
-                        Spectrum L(0.f);
-                        if (rayWeight > 0) L = Li(ray, scene, *tileSampler, arena);
-
-                        // Issue warning if unexpected radiance value returned
-                        if (L.HasNaNs()) {
-                            L = Spectrum(0.f);
-                        } else if (L.y() < -1e-5) {
-                            L = Spectrum(0.f);
-                        } else if (std::isinf(L.y())) {
-                            L = Spectrum(0.f);
-                        }
-
-
-                        // Add camera ray's contribution to image
-                        filmTile->AddSample(cameraSample.pFilm, L, rayWeight);
-
-                        // Free _MemoryArena_ memory from computing image sample
-                        // value
-                        arena.Reset();
-                    } while (tileSampler->StartNextSample());
+                // Stop sampling the pixel once its estimate has converged
+                if (settings.adaptive) {
+                    variance->Add(L.y());
+                    int64_t n = variance->Count();
+                    int64_t minSamples = settings.minSamples;
+                    if (n % minSamples == 0 && IsPowerOf2(n / minSamples) &&
+                        variance->RelativeError(AdaptiveMinMean) <
+                                settings.adaptiveThreshold) {
+                        if (converged) *converged = 1;
+                        settings.samplesSkipped +=
+                                endSample - 1 - tileSampler->CurrentSampleNumber();
+                        break;
                     }
-                camera->film->MergeFilmTile(std::move(filmTile));
-            }, nTiles);
+                }
+            } while (tileSampler->CurrentSampleNumber() + 1 < endSample &&
+                     tileSampler->StartNextSample());
         }
+        if (view.checkpoint)
+            view.checkpoint->MergeFilmTile(std::move(filmTile), tileIndex);
+        else
+            camera->film->MergeFilmTile(std::move(filmTile));
+        PollMemoryReport();
     }
 
     Spectrum
@@ -27,7 +27,13 @@ namespace pbrt{
                           const Bounds2i &pixelBounds)
                 : camera(camera), sampler(sampler), pixelBounds(pixelBounds) {}
 
+        // Called once before rendering, e.g. to request sample arrays
+        virtual void Preprocess(const Scene &, Sampler &) {}
         void Render(const Scene &scene) override;
+        // Renders the views of several integrators of _scene_ together, the
+        // tiles of all views sharing each pass's parallel loop
+        static void RenderViews(const Scene &scene,
+                                const std::vector<SamplerIntegrator *> &integrators);
         virtual Spectrum Li(const RayDifferential &ray, const Scene &scene,
                             Sampler &sampler, MemoryArena &arena,
                             int depth = 0) const = 0;
@@ -40,10 +46,20 @@ namespace pbrt{
                                   const SurfaceInteraction &isect,
                                   const Scene &scene, Sampler &sampler,
                                   MemoryArena &arena, int depth) const;
+
+        // Identifies the scene and settings of the image; a checkpoint is
+        // only resumed by a render with the same hash
+        uint64_t renderHash = 0;
+
     protected:
         std::shared_ptr<const Camera> camera;
 
     private:
+        struct ViewState;
+        struct RenderSettings;
+        void RenderTile(const Scene &scene, ViewState &view,
+                        RenderSettings &settings, int pass, Point2i tile);
+
         std::shared_ptr<Sampler> sampler;
         const Bounds2i pixelBounds;
 
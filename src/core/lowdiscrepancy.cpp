@@ -0,0 +1,81 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#include "lowdiscrepancy.h"
+
+namespace pbrt {
+
+    int Primes[PrimeTableSize];
+    int PrimeSums[PrimeTableSize];
+
+    static void InitPrimes() {
+        int n = 0;
+        for (int p = 2; n < PrimeTableSize; ++p) {
+            bool prime = true;
+            for (int i = 0; i < n && Primes[i] * Primes[i] <= p; ++i)
+                if (p % Primes[i] == 0) {
+                    prime = false;
+                    break;
+                }
+            if (prime) {
+                PrimeSums[n] = n == 0 ? 0 : PrimeSums[n - 1] + Primes[n - 1];
+                Primes[n++] = p;
+            }
+        }
+    }
+
+    void InitLowDiscrepancyTables() {
+        InitPrimes();
+    }
+
+    float RadicalInverse(int baseIndex, uint64_t a) {
+        if (baseIndex == 0) {
+            // Base 2 is a bit reversal
+            uint64_t reversed = 0;
+            for (int i = 0; i < 64; ++i, a >>= 1) reversed = (reversed << 1) | (a & 1);
+            return std::min(float(reversed * 0x1p-64), OneMinusEpsilon);
+        }
+        const int base = Primes[baseIndex];
+        const float invBase = (float)1 / (float)base;
+        uint64_t reversedDigits = 0;
+        float invBaseN = 1;
+        while (a) {
+            uint64_t next = a / base;
+            uint64_t digit = a - next * base;
+            reversedDigits = reversedDigits * base + digit;
+            invBaseN *= invBase;
+            a = next;
+        }
+        return std::min(reversedDigits * invBaseN, OneMinusEpsilon);
+    }
+
+    float ScrambledRadicalInverse(int baseIndex, uint64_t a, const uint16_t *perm) {
+        const int base = Primes[baseIndex];
+        const float invBase = (float)1 / (float)base;
+        uint64_t reversedDigits = 0;
+        float invBaseN = 1;
+        // Leading zero digits are permuted too, until they no longer
+        // change the float result
+        while (1 - (base - 1) * invBaseN < 1) {
+            uint64_t next = a / base;
+            int digitValue = a - next * base;
+            reversedDigits = reversedDigits * base + perm[digitValue];
+            invBaseN *= invBase;
+            a = next;
+        }
+        return std::min(invBaseN * reversedDigits, OneMinusEpsilon);
+    }
+
+    std::vector<uint16_t> ComputeRadicalInversePermutations(RNG &rng) {
+        std::vector<uint16_t> perms(PrimeSums[PrimeTableSize - 1] +
+                                    Primes[PrimeTableSize - 1]);
+        uint16_t *p = &perms[0];
+        for (int i = 0; i < PrimeTableSize; ++i) {
+            for (int j = 0; j < Primes[i]; ++j) p[j] = j;
+            Shuffle(p, Primes[i], 1, rng);
+            p += Primes[i];
+        }
+        return perms;
+    }
+}
@@ -0,0 +1,116 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#ifndef PBRT_WHITTED_LOWDISCREPANCY_H
+#define PBRT_WHITTED_LOWDISCREPANCY_H
+
+#include "main.h"
+#include "geometry.h"
+#include "rng.h"
+#include "sampling.h"
+
+namespace pbrt {
+
+    static constexpr int PrimeTableSize = 1000;
+    // The first _PrimeTableSize_ primes, and the sum of all primes before each
+    extern int Primes[PrimeTableSize];
+    extern int PrimeSums[PrimeTableSize];
+
+    // Generator matrices of the Sobol sequence, one column per index bit,
+    // each holding the top 32 bits of the column, in sobolmatrices.cpp.
+    // Dimension 0 is the van der Corput sequence and dimensions 1 to 20 use
+    // Joe and Kuo's direction numbers. Samplers built on the table have no
+    // more dimensions than this; past them they fall back to independent
+    // random values (see _Sampler::MaxDimension()_).
+    static constexpr int NumSobolDimensions = 21;
+    static constexpr int SobolMatrixSize = 52;
+    extern const uint32_t SobolMatrices32[NumSobolDimensions * SobolMatrixSize];
+
+    // Fills the prime tables above; called once by _pbrtInit()_
+    void InitLowDiscrepancyTables();
+
+    // Radical inverse of _a_ in base _Primes[baseIndex]_
+    float RadicalInverse(int baseIndex, uint64_t a);
+    // Same, with each digit permuted by _perm_ first
+    float ScrambledRadicalInverse(int baseIndex, uint64_t a, const uint16_t *perm);
+    // One random digit permutation per prime, stored back to back; the one
+    // for base _Primes[i]_ starts at _PrimeSums[i]_
+    std::vector<uint16_t> ComputeRadicalInversePermutations(RNG &rng);
+
+    template <int base>
+    inline uint64_t InverseRadicalInverse(uint64_t inverse, int nDigits) {
+        uint64_t index = 0;
+        for (int i = 0; i < nDigits; ++i) {
+            uint64_t digit = inverse % base;
+            inverse /= base;
+            index = index * base + digit;
+        }
+        return index;
+    }
+
+    // Sobol sample _index_ in _dimension_; only the low _SobolMatrixSize_
+    // bits of _index_ are used
+    inline uint32_t SobolSampleBits(uint64_t index, int dimension,
+                                    uint32_t scramble = 0) {
+        uint32_t v = scramble;
+        const uint32_t *c = &SobolMatrices32[dimension * SobolMatrixSize];
+        for (uint64_t a = index & ((1ull << SobolMatrixSize) - 1); a != 0;
+             a >>= 1, ++c)
+            if (a & 1) v ^= *c;
+        return v;
+    }
+
+    inline float SobolSample(uint64_t index, int dimension, uint32_t scramble = 0) {
+        return std::min(SobolSampleBits(index, dimension, scramble) * 0x1p-32f,
+                        OneMinusEpsilon);
+    }
+
+    // Consecutive points of a (scrambled) digital sequence with generator
+    // matrix _C_, stepping through the indices in Gray code order
+    inline void GrayCodeSample(const uint32_t *C, uint32_t n, uint32_t scramble,
+                               float *p) {
+        uint32_t v = scramble;
+        for (uint32_t i = 0; i < n; ++i) {
+            p[i] = std::min(v * 0x1p-32f, OneMinusEpsilon);
+            v ^= C[CountTrailingZeros(i + 1)];
+        }
+    }
+
+    inline void GrayCodeSample(const uint32_t *C0, const uint32_t *C1, uint32_t n,
+                               const Point2i &scramble, Point2f *p) {
+        uint32_t v[2] = {(uint32_t)scramble.x, (uint32_t)scramble.y};
+        for (uint32_t i = 0; i < n; ++i) {
+            p[i].x = std::min(v[0] * 0x1p-32f, OneMinusEpsilon);
+            p[i].y = std::min(v[1] * 0x1p-32f, OneMinusEpsilon);
+            v[0] ^= C0[CountTrailingZeros(i + 1)];
+            v[1] ^= C1[CountTrailingZeros(i + 1)];
+        }
+    }
+
+    // Randomly scrambled and shuffled (0,2)-sequence points for
+    // _nPixelSamples_ samples, _nSamplesPerPixelSample_ values each
+    inline void VanDerCorput(int nSamplesPerPixelSample, int nPixelSamples,
+                             float *samples, RNG &rng) {
+        uint32_t scramble = rng.UniformUInt32();
+        int totalSamples = nSamplesPerPixelSample * nPixelSamples;
+        GrayCodeSample(&SobolMatrices32[0], totalSamples, scramble, samples);
+        // Randomly shuffle 1D sample points
+        for (int i = 0; i < nPixelSamples; ++i)
+            Shuffle(samples + i * nSamplesPerPixelSample, nSamplesPerPixelSample,
+                    1, rng);
+        Shuffle(samples, nPixelSamples, nSamplesPerPixelSample, rng);
+    }
+
+    inline void Sobol2D(int nSamplesPerPixelSample, int nPixelSamples,
+                        Point2f *samples, RNG &rng) {
+        Point2i scramble((int)rng.UniformUInt32(), (int)rng.UniformUInt32());
+        GrayCodeSample(&SobolMatrices32[0], &SobolMatrices32[SobolMatrixSize],
+                       nSamplesPerPixelSample * nPixelSamples, scramble, samples);
+        for (int i = 0; i < nPixelSamples; ++i)
+            Shuffle(samples + i * nSamplesPerPixelSample, nSamplesPerPixelSample,
+                    1, rng);
+        Shuffle(samples, nPixelSamples, nSamplesPerPixelSample, rng);
+    }
+}
+#endif //PBRT_WHITTED_LOWDISCREPANCY_H
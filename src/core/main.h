@@ -10,6 +10,8 @@
 #include <string>
 #include <vector>
 #include <cmath>
+#include <cstring>
+#include <limits>
 
 #include <alloca.h>
 #include <iostream>
@@ -50,11 +52,17 @@ namespace pbrt{
     template <int nSpectrumSamples>
     class CoefficientSpectrum;
     class RGBSpectrum;
+    class SampledSpectrum;
+#ifdef PBRT_SAMPLED_SPECTRUM
+    typedef SampledSpectrum Spectrum;
+#else
     typedef RGBSpectrum Spectrum;
+#endif
     class Camera;
     struct CameraSample;
     class Sampler;
     class Filter;
+    class FilterSampler;
     class Film;
     class FilmTile;
     class BxDF;
@@ -63,6 +71,7 @@ namespace pbrt{
     class Texture;
     class Light;
     class VisibilityTester;
+    class ParamSet;
 
     class RNG;
     class MemoryArena;
@@ -76,12 +85,47 @@ namespace pbrt{
             cropWindow[1][1] = 1;
         }
         std::string imageFile;
+        // When set, the film's pixels are kept in a memory-mapped file at
+        // this path rather than in RAM, for images larger than memory.
+        // Named cameras each get _<filmBackingFile>.<name>_.
+        std::string filmBackingFile;
+        // When set, render progress is saved to this file every
+        // _checkpointInterval_ seconds and resumed from it on restart; with
+        // an interval of zero, only at the end of each pass.
+        std::string checkpointFile;
+        float checkpointInterval = 300;
+        // Draw film positions from the pixel filter's distribution and
+        // credit each sample to its own pixel only, rather than splatting
+        // it over the filter's footprint.
+        bool sampleFilter = false;
+        // When set, merged tiles are sent to a viewer listening on a UNIX
+        // datagram socket at this path; see _PreviewChannel_.
+        std::string previewSocket;
+        // When nonzero, overrides the samples per pixel of every sampler;
+        // with adaptive sampling this is the most a pixel gets.
+        int pixelSamples = 0;
+        // When positive, each pixel takes samples in batches, starting with
+        // _adaptiveMinSamples_ and doubling, until the standard error of its
+        // mean radiance is below this fraction of the mean. Small first
+        // batches let partly covered pixels that happen to see no variation
+        // stop too early.
+        float adaptiveThreshold = 0;
+        int adaptiveMinSamples = 16;
+        // Render in passes over the whole image and write the image after
+        // each; with _renderDeadline_ (seconds, 0 for none) the render stops
+        // early and keeps the samples taken so far.
+        bool progressive = false;
+        float renderDeadline = 0;
         int nThreads = 4;
+        // When set, _pbrtWorldEnd()_ builds the scene and keeps it for
+        // _pbrtRenderView()_ rather than rendering it.
+        bool retainScene = false;
         // x0, x1, y0, y1
         float cropWindow[2][2];
     };
 
-    extern Options PbrtOptions;
+    // The options of the calling thread's current _RenderContext_
+    extern thread_local Options PbrtOptions;
 
 
     // constants
@@ -91,6 +135,13 @@ namespace pbrt{
     static constexpr float PiOver2 = 1.57079632679489661923;
     static constexpr float PiOver4 = 0.78539816339744830961;
     static constexpr float ShadowEpsilon = 0.0001f;
+    static constexpr float MachineEpsilon =
+            std::numeric_limits<float>::epsilon() * 0.5;
+
+    // Bound on the relative error of _n_ floating-point operations
+    inline constexpr float gamma(int n) {
+        return (n * MachineEpsilon) / (1 - n * MachineEpsilon);
+    }
 
     inline uint32_t FloatToBits(float f) {
         uint32_t ui;
@@ -152,6 +203,105 @@ namespace pbrt{
             return val;
     }
 
+    inline float Lerp(float t, float v1, float v2) { return (1 - t) * v1 + t * v2; }
+
+    // Returns the last index _i_ in $[0, size-2]$ for which _pred(i)_ holds,
+    // assuming _pred_ is true for a prefix of the indices
+    template <typename Predicate>
+    int FindInterval(int size, const Predicate &pred) {
+        int first = 0, len = size;
+        while (len > 0) {
+            int half = len >> 1, middle = first + half;
+            if (pred(middle)) {
+                first = middle + 1;
+                len -= half + 1;
+            } else
+                len = half;
+        }
+        return Clamp(first - 1, 0, size - 2);
+    }
+
+    template <typename T>
+    inline T Mod(T a, T b) {
+        T result = a - (a / b) * b;
+        return (T)((result < 0) ? result + b : result);
+    }
+
+    template <typename T>
+    inline constexpr bool IsPowerOf2(T v) {
+        return v && !(v & (v - 1));
+    }
+
+    inline int32_t RoundUpPow2(int32_t v) {
+        v--;
+        v |= v >> 1;
+        v |= v >> 2;
+        v |= v >> 4;
+        v |= v >> 8;
+        v |= v >> 16;
+        return v + 1;
+    }
+
+    inline int64_t RoundUpPow2(int64_t v) {
+        v--;
+        v |= v >> 1;
+        v |= v >> 2;
+        v |= v >> 4;
+        v |= v >> 8;
+        v |= v >> 16;
+        v |= v >> 32;
+        return v + 1;
+    }
+
+    inline int Log2Int(uint32_t v) { return 31 - __builtin_clz(v); }
+
+    inline int Log2Int(int32_t v) { return Log2Int((uint32_t)v); }
+
+    inline int Log2Int(uint64_t v) { return 63 - __builtin_clzll(v); }
+
+    inline int Log2Int(int64_t v) { return Log2Int((uint64_t)v); }
+
+    inline int CountTrailingZeros(uint32_t v) { return __builtin_ctz(v); }
+
+    // Scrambles the bits of _v_ so that nearby inputs give unrelated outputs
+    inline uint64_t MixBits(uint64_t v) {
+        v ^= (v >> 31);
+        v *= 0x7fb5d329728ea185;
+        v ^= (v >> 27);
+        v *= 0x81dadef4bc2dd44d;
+        v ^= (v >> 33);
+        return v;
+    }
+
+    // MurmurHash64A of _size_ bytes, chained through _seed_
+    inline uint64_t HashBuffer(const void *ptr, size_t size, uint64_t seed = 0) {
+        const uint64_t m = 0xc6a4a7935bd1e995ull;
+        const int r = 47;
+        uint64_t h = seed ^ (size * m);
+        const uint8_t *data = (const uint8_t *)ptr;
+        const uint8_t *end = data + (size & ~size_t(7));
+        for (; data != end; data += 8) {
+            uint64_t k;
+            memcpy(&k, data, sizeof(k));
+            k *= m;
+            k ^= k >> r;
+            k *= m;
+            h ^= k;
+            h *= m;
+        }
+        if (size & 7) {
+            uint64_t tail = 0;
+            for (size_t i = 0; i < (size & 7); ++i)
+                tail |= (uint64_t)data[i] << (8 * i);
+            h ^= tail;
+            h *= m;
+        }
+        h ^= h >> r;
+        h *= m;
+        h ^= h >> r;
+        return h;
+    }
+
     inline float Radians(float deg) { return (Pi / 180) * deg; }
 
     inline float Degrees(float rad) { return (180 / Pi) * rad; }
@@ -3,27 +3,262 @@
 //
 
 #include "memory.h"
+#include <atomic>
+#include <iomanip>
+#include <sstream>
+#include <csignal>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace pbrt{
 
-    void *AllocAligned(size_t size) {
+    struct MemoryCounter {
+        std::atomic<int64_t> current{0}, peak{0};
+    };
+    static MemoryCounter memoryCounters[nMemoryCategories];
+    static const char *memoryCategoryNames[nMemoryCategories] = {
+            "Other", "Arenas", "BVH", "Primitives", "Transforms", "Film", "Textures"};
+    static std::atomic<bool> memoryReportRequested{false};
+
+    void TrackMemory(MemoryCategory category, int64_t bytes) {
+        MemoryCounter &counter = memoryCounters[(int)category];
+        int64_t current =
+                counter.current.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        int64_t peak = counter.peak.load(std::memory_order_relaxed);
+        while (current > peak &&
+               !counter.peak.compare_exchange_weak(peak, current,
+                                                   std::memory_order_relaxed))
+            ;
+    }
+
+    void ReportMemoryUsage(std::ostream &out) {
+        std::ostringstream os;
+        os << "Memory use (current / peak MB):" << std::endl;
+        int64_t current = 0, peak = 0;
+        for (int i = 0; i < nMemoryCategories; ++i) {
+            int64_t c = memoryCounters[i].current.load(std::memory_order_relaxed);
+            int64_t p = memoryCounters[i].peak.load(std::memory_order_relaxed);
+            current += c;
+            peak += p;
+            if (p == 0) continue;
+            os << "    " << std::left << std::setw(12) << memoryCategoryNames[i]
+               << std::right << std::fixed << std::setprecision(2)
+               << std::setw(10) << c / (1024. * 1024.) << " / "
+               << std::setw(10) << p / (1024. * 1024.) << std::endl;
+        }
+        // The sum of the peaks bounds the overall peak from above
+        os << "    " << std::left << std::setw(12) << "Total" << std::right
+           << std::setw(10) << current / (1024. * 1024.) << " / "
+           << std::setw(10) << peak / (1024. * 1024.) << std::endl;
+        out << os.str();
+    }
+
+    static void MemoryReportSignalHandler(int) {
+        memoryReportRequested.store(true, std::memory_order_relaxed);
+    }
+
+    void InstallMemoryReportHandler() {
+        std::signal(SIGUSR1, MemoryReportSignalHandler);
+    }
+
+    void PollMemoryReport() {
+        if (memoryReportRequested.load(std::memory_order_relaxed) &&
+            memoryReportRequested.exchange(false))
+            ReportMemoryUsage(std::cerr);
+    }
+
+    // Allocations are prefixed by a cache line holding their size and
+    // category, which keeps the returned pointer aligned
+    struct AlignedHeader {
+        size_t size;
+        MemoryCategory category;
+    };
+    static_assert(sizeof(AlignedHeader) <= PBRT_L1_CACHE_LINE_SIZE,
+                  "AlignedHeader too large");
+
+    void *AllocAligned(size_t size, MemoryCategory category) {
+        size_t total = size + PBRT_L1_CACHE_LINE_SIZE;
 #if defined(PBRT_HAVE__ALIGNED_MALLOC)
-        return _aligned_malloc(size, PBRT_L1_CACHE_LINE_SIZE);
+        void *ptr = _aligned_malloc(total, PBRT_L1_CACHE_LINE_SIZE);
 #elif defined(PBRT_HAVE_POSIX_MEMALIGN)
         void *ptr;
-    if (posix_memalign(&ptr, PBRT_L1_CACHE_LINE_SIZE, size) != 0) ptr = nullptr;
-    return ptr;
+        if (posix_memalign(&ptr, PBRT_L1_CACHE_LINE_SIZE, total) != 0) ptr = nullptr;
 #else
-        return memalign(PBRT_L1_CACHE_LINE_SIZE, size);
+        void *ptr = memalign(PBRT_L1_CACHE_LINE_SIZE, total);
 #endif
+        if (!ptr) return nullptr;
+        AlignedHeader *header = (AlignedHeader *)ptr;
+        header->size = size;
+        header->category = category;
+        TrackMemory(category, size);
+        return (uint8_t *)ptr + PBRT_L1_CACHE_LINE_SIZE;
     }
 
     void FreeAligned(void *ptr) {
         if (!ptr) return;
+        AlignedHeader *header =
+                (AlignedHeader *)((uint8_t *)ptr - PBRT_L1_CACHE_LINE_SIZE);
+        TrackMemory(header->category, -(int64_t)header->size);
 #if defined(PBRT_HAVE__ALIGNED_MALLOC)
-        _aligned_free(ptr);
+        _aligned_free(header);
 #else
-        free(ptr);
+        free(header);
 #endif
     }
+
+    MemoryArena::~MemoryArena() {
+        FreeBlock(currentBlock);
+        FreeBlocks(usedBlocks);
+        for (Block *list : availableBlocks) FreeBlocks(list);
+    }
+
+    void MemoryArena::RecycleUsedBlocks() {
+        while (usedBlocks) {
+            Block *b = usedBlocks;
+            usedBlocks = b->next;
+            int c = SizeClass(b);
+            b->next = availableBlocks[c];
+            availableBlocks[c] = b;
+            availableMask |= 1u << c;
+        }
+    }
+
+    void MemoryArena::NewBlock(size_t nBytes) {
+        // Add current block to _usedBlocks_ list
+        if (currentBlock) {
+            retiredBytes += currentBlockPos;
+            currentBlock->next = usedBlocks;
+            usedBlocks = currentBlock;
+            currentBlock = nullptr;
+        }
+
+        // Reuse a free block from the smallest size class that fits
+        int minClass = 0;
+        while (minClass < nSizeClasses - 1 && (blockSize << minClass) < nBytes)
+            ++minClass;
+        uint32_t fits = availableMask & ~((1u << minClass) - 1);
+        if (fits) {
+            int c = CountTrailingZeros(fits);
+            // Only the top class, which takes all larger blocks, may hold
+            // blocks smaller than _nBytes_
+            if (availableBlocks[c]->size >= nBytes) {
+                currentBlock = availableBlocks[c];
+                availableBlocks[c] = currentBlock->next;
+                if (!availableBlocks[c]) availableMask &= ~(1u << c);
+            }
+        }
+        if (!currentBlock)
+            currentBlock = AllocBlock(std::max(nBytes, blockSize << minClass), nBytes);
+        currentAllocSize = currentBlock->size;
+        currentBlockPos = 0;
+    }
+
+    MemoryArena::Block *MemoryArena::AllocBlock(size_t size, size_t minSize) {
+        Block *b = nullptr;
+        bool mapped = false;
+        if (size >= HugePageSize) {
+            // Map whole huge pages: explicitly reserved ones if there are
+            // any, else ask for transparent huge pages. The header comes out
+            // of the requested size unless that leaves too little room.
+            size_t mapSize = (size + HugePageSize - 1) / HugePageSize * HugePageSize;
+            if (mapSize - BlockHeaderSize < minSize) mapSize += HugePageSize;
+            void *ptr = MAP_FAILED;
+#ifdef MAP_HUGETLB
+            ptr = mmap(nullptr, mapSize, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif
+            if (ptr == MAP_FAILED) {
+                ptr = mmap(nullptr, mapSize, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+#ifdef MADV_HUGEPAGE
+                if (ptr != MAP_FAILED) madvise(ptr, mapSize, MADV_HUGEPAGE);
+#endif
+            }
+            if (ptr != MAP_FAILED) {
+                b = (Block *)ptr;
+                size = mapSize - BlockHeaderSize;
+                mapped = true;
+                TrackMemory(category, mapSize);
+            }
+        }
+        if (!b) b = (Block *)AllocAligned<uint8_t>(size + BlockHeaderSize, category);
+        if (!b) {
+            std::cerr << "Unable to allocate " << size << " bytes for memory arena"
+                      << std::endl;
+            abort();
+        }
+        b->next = nullptr;
+        b->size = size;
+        b->mapped = mapped;
+        totalBytes += size;
+        ++nBlocks;
+        return b;
+    }
+
+    void MemoryArena::FreeBlock(Block *b) {
+        if (!b) return;
+        if (b->mapped) {
+            TrackMemory(category, -(int64_t)(b->size + BlockHeaderSize));
+            munmap(b, b->size + BlockHeaderSize);
+        } else
+            FreeAligned(b);
+    }
+
+    void MemoryArena::FreeBlocks(Block *list) {
+        while (list) {
+            Block *next = list->next;
+            FreeBlock(list);
+            list = next;
+        }
+    }
+
+    std::unique_ptr<MappedFile> MappedFile::Create(const std::string &path,
+                                                   size_t size) {
+        int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) return nullptr;
+        if (ftruncate(fd, (off_t)size) != 0) {
+            close(fd);
+            return nullptr;
+        }
+        void *ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (ptr == MAP_FAILED) {
+            close(fd);
+            return nullptr;
+        }
+        return std::unique_ptr<MappedFile>(new MappedFile(fd, (uint8_t *)ptr, size));
+    }
+
+    std::unique_ptr<MappedFile> MappedFile::Open(const std::string &path) {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) return nullptr;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0) {
+            close(fd);
+            return nullptr;
+        }
+        size_t size = st.st_size;
+        void *ptr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (ptr == MAP_FAILED) {
+            close(fd);
+            return nullptr;
+        }
+        return std::unique_ptr<MappedFile>(new MappedFile(fd, (uint8_t *)ptr, size));
+    }
+
+    MappedFile::~MappedFile() {
+        munmap(data, size);
+        close(fd);
+    }
+
+    void MappedFile::Release(size_t offset, size_t length) {
+        // Only whole pages inside the range can be dropped
+        size_t pageSize = sysconf(_SC_PAGESIZE);
+        size_t begin = (offset + pageSize - 1) / pageSize * pageSize;
+        size_t end = std::min(offset + length, size) / pageSize * pageSize;
+        if (begin >= end) return;
+        msync(data + begin, end - begin, MS_ASYNC);
+        madvise(data + begin, end - begin, MADV_DONTNEED);
+    }
 }
\ No newline at end of file
@@ -6,20 +6,93 @@
 #define PBRT_WHITTED_MEMORY_H
 
 #include "main.h"
-#include <list>
 #include <cstddef>
+#include <cassert>
 
 namespace pbrt{
 
 // Memory Declarations
-#define ARENA_ALLOC(arena, Type) new ((arena).Alloc(sizeof(Type))) Type
-    void *AllocAligned(size_t size);
+#define ARENA_ALLOC(arena, Type) new ((arena).Alloc(sizeof(Type), alignof(Type))) Type
+
+    // Subsystems whose memory use is accounted separately
+    enum class MemoryCategory {
+        Other, Arenas, BVH, Primitives, Transforms, Film, Textures
+    };
+    static const int nMemoryCategories = 7;
+
+    // Adds _bytes_, negative for memory given back, to _category_'s current
+    // use and raises its peak if needed; meant for large allocations only.
+    void TrackMemory(MemoryCategory category, int64_t bytes);
+    // Prints the current and peak use of every category that was used
+    void ReportMemoryUsage(std::ostream &os);
+    // Makes SIGUSR1 request a report, which is printed to stderr by the
+    // next call to _PollMemoryReport()_
+    void InstallMemoryReportHandler();
+    void PollMemoryReport();
+
+    // Accounts the bytes of a container owned by an object, e.g. a vector
+    // member: _Set()_ after the container changes size, and destruction
+    // gives the bytes back.
+    class TrackedMemory {
+    public:
+        explicit TrackedMemory(MemoryCategory category) : category(category) {}
+        ~TrackedMemory() { Set(0); }
+        void Set(size_t newBytes) {
+            TrackMemory(category, (int64_t)newBytes - (int64_t)bytes);
+            bytes = newBytes;
+        }
+
+    private:
+        TrackedMemory(const TrackedMemory &) = delete;
+        TrackedMemory &operator=(const TrackedMemory &) = delete;
+        const MemoryCategory category;
+        size_t bytes = 0;
+    };
+
+    // Cache-line aligned; the size is recorded in front of the block so that
+    // _FreeAligned()_ can account for it
+    void *AllocAligned(size_t size, MemoryCategory category = MemoryCategory::Other);
     template <typename T>
-    T *AllocAligned(size_t count) {
-        return (T *)AllocAligned(count * sizeof(T));
+    T *AllocAligned(size_t count, MemoryCategory category = MemoryCategory::Other) {
+        return (T *)AllocAligned(count * sizeof(T), category);
     }
 
     void FreeAligned(void *);
+
+    // A file mapped into the address space; the OS pages its contents in on
+    // access and may write dirty pages back and evict them at any time.
+    class MappedFile {
+    public:
+        // Creates (or truncates) _path_ with _size_ zero bytes, mapped writable
+        static std::unique_ptr<MappedFile> Create(const std::string &path,
+                                                  size_t size);
+        // Maps an existing file read-only
+        static std::unique_ptr<MappedFile> Open(const std::string &path);
+        ~MappedFile();
+
+        uint8_t *Data() const { return data; }
+        size_t Size() const { return size; }
+        // Drops the pages covering _[offset, offset+length)_ from memory; a
+        // later access reads them back from the file.
+        void Release(size_t offset, size_t length);
+
+    private:
+        MappedFile(int fd, uint8_t *data, size_t size)
+                : fd(fd), data(data), size(size) {}
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        int fd;
+        uint8_t *data;
+        size_t size;
+    };
+
+    // Hands out memory from large blocks and frees it all at once on
+    // _Reset()_. Blocks hold _blockSize_ bytes, or _blockSize_ times a power
+    // of two for larger allocations; after a reset they are kept in one free
+    // list per such size class for reuse. Blocks of at least
+    // _HugePageSize_ bytes are mapped directly and backed by huge pages when
+    // the system provides them.
     class
 #ifdef PBRT_HAVE_ALIGNAS
         alignas(PBRT_L1_CACHE_LINE_SIZE)
@@ -27,83 +100,102 @@ namespace pbrt{
     MemoryArena {
     public:
         // MemoryArena Public Methods
-        MemoryArena(size_t blockSize = 262144) : blockSize(blockSize) {}
-        ~MemoryArena() {
-            FreeAligned(currentBlock);
-            for (auto &block : usedBlocks) FreeAligned(block.second);
-            for (auto &block : availableBlocks) FreeAligned(block.second);
-        }
+        MemoryArena(size_t blockSize = 262144,
+                    MemoryCategory category = MemoryCategory::Arenas)
+                : blockSize(blockSize), category(category) {}
+        ~MemoryArena();
         void *Alloc(size_t nBytes) {
             // Round up _nBytes_ to minimum machine alignment
-#if __GNUC__ == 4 && __GNUC_MINOR__ < 9
-            // gcc bug: max_align_t wasn't in std:: until 4.9.0
-            const int align = alignof(::max_align_t);
-#elif !defined(PBRT_HAVE_ALIGNOF)
-            const int align = 16;
-#else
-        const int align = alignof(std::max_align_t);
-#endif
-#ifdef PBRT_HAVE_CONSTEXPR
-            static_assert(IsPowerOf2(align), "Minimum alignment not a power of two");
-#endif
-            nBytes = (nBytes + align - 1) & ~(align - 1);
-            if (currentBlockPos + nBytes > currentAllocSize) {
-                // Add current block to _usedBlocks_ list
-                if (currentBlock) {
-                    usedBlocks.push_back(
-                            std::make_pair(currentAllocSize, currentBlock));
-                    currentBlock = nullptr;
-                    currentAllocSize = 0;
-                }
-
-                // Get new block of memory for _MemoryArena_
-
-                // Try to get memory block from _availableBlocks_
-                for (auto iter = availableBlocks.begin();
-                     iter != availableBlocks.end(); ++iter) {
-                    if (iter->first >= nBytes) {
-                        currentAllocSize = iter->first;
-                        currentBlock = iter->second;
-                        availableBlocks.erase(iter);
-                        break;
-                    }
-                }
-                if (!currentBlock) {
-                    currentAllocSize = std::max(nBytes, blockSize);
-                    currentBlock = AllocAligned<uint8_t>(currentAllocSize);
-                }
-                currentBlockPos = 0;
-            }
-            void *ret = currentBlock + currentBlockPos;
+            nBytes = (nBytes + MinAlign - 1) & ~(MinAlign - 1);
+            if (currentBlockPos + nBytes > currentAllocSize) NewBlock(nBytes);
+            void *ret = BlockData(currentBlock) + currentBlockPos;
             currentBlockPos += nBytes;
             return ret;
         }
+        // Allocation aligned to _align_, a power of two up to
+        // _PBRT_L1_CACHE_LINE_SIZE_; block data starts on a cache line, so
+        // every such alignment can be met
+        void *Alloc(size_t nBytes, size_t align) {
+            assert(align > 0 && (align & (align - 1)) == 0 &&
+                   align <= PBRT_L1_CACHE_LINE_SIZE);
+            if (align <= MinAlign) return Alloc(nBytes);
+            size_t pos = (currentBlockPos + align - 1) & ~(align - 1);
+            nBytes = (nBytes + MinAlign - 1) & ~(MinAlign - 1);
+            if (pos + nBytes > currentAllocSize) {
+                NewBlock(nBytes);
+                pos = 0;
+            }
+            void *ret = BlockData(currentBlock) + pos;
+            currentBlockPos = pos + nBytes;
+            return ret;
+        }
         template <typename T>
         T *Alloc(size_t n = 1, bool runConstructor = true) {
-            T *ret = (T *)Alloc(n * sizeof(T));
+            static_assert(alignof(T) <= PBRT_L1_CACHE_LINE_SIZE,
+                          "Arena cannot align type");
+            T *ret = (T *)Alloc(n * sizeof(T), alignof(T));
             if (runConstructor)
                 for (size_t i = 0; i < n; ++i) new (&ret[i]) T();
             return ret;
         }
         void Reset() {
+            highWaterMark = HighWaterMark();
             currentBlockPos = 0;
-            availableBlocks.splice(availableBlocks.begin(), usedBlocks);
+            retiredBytes = 0;
+            if (usedBlocks) RecycleUsedBlocks();
         }
-        size_t TotalAllocated() const {
-            size_t total = currentAllocSize;
-            for (const auto &alloc : usedBlocks) total += alloc.first;
-            for (const auto &alloc : availableBlocks) total += alloc.first;
-            return total;
+
+        // Statistics
+        // Bytes in all blocks, whether in use or free
+        size_t TotalAllocated() const { return totalBytes; }
+        size_t BlockCount() const { return nBlocks; }
+        // Bytes handed out since the last _Reset()_, including padding
+        size_t BytesInUse() const { return retiredBytes + currentBlockPos; }
+        // Largest _BytesInUse()_ since construction
+        size_t HighWaterMark() const {
+            return std::max(highWaterMark, BytesInUse());
         }
 
+        static constexpr size_t HugePageSize = 2 * 1024 * 1024;
+
     private:
         MemoryArena(const MemoryArena &) = delete;
         MemoryArena &operator=(const MemoryArena &) = delete;
+
+        // Header at the start of each block; the data follows it
+        struct Block {
+            Block *next;
+            size_t size;
+            bool mapped;
+        };
+        static constexpr size_t BlockHeaderSize = PBRT_L1_CACHE_LINE_SIZE;
+        static_assert(sizeof(Block) <= BlockHeaderSize, "Block header too large");
+        static constexpr size_t MinAlign = 16;
+        static constexpr int nSizeClasses = 32;
+
+        static uint8_t *BlockData(Block *b) { return (uint8_t *)b + BlockHeaderSize; }
+        void NewBlock(size_t nBytes);
+        void RecycleUsedBlocks();
+        // Allocates a block of about _size_ bytes and at least _minSize_
+        Block *AllocBlock(size_t size, size_t minSize);
+        void FreeBlock(Block *b);
+        void FreeBlocks(Block *list);
+        // Largest class whose size _b_ can serve
+        int SizeClass(const Block *b) const {
+            return std::min(Log2Int((uint64_t)(b->size / blockSize)), nSizeClasses - 1);
+        }
+
         // MemoryArena Private Data
         const size_t blockSize;
+        const MemoryCategory category;
         size_t currentBlockPos = 0, currentAllocSize = 0;
-        uint8_t *currentBlock = nullptr;
-        std::list<std::pair<size_t, uint8_t *>> usedBlocks, availableBlocks;
+        Block *currentBlock = nullptr;
+        // Blocks filled since the last reset, and free blocks by size class
+        Block *usedBlocks = nullptr;
+        Block *availableBlocks[nSizeClasses] = {};
+        uint32_t availableMask = 0;
+        size_t totalBytes = 0, nBlocks = 0;
+        size_t retiredBytes = 0, highWaterMark = 0;
     };
 }
 #endif //PBRT_WHITTED_MEMORY_H
@@ -8,6 +8,7 @@
 
 namespace pbrt{
     static std::vector<std::thread> threads;
+    static bool shutdownThreads = false;
     class ParallelForLoop;
     static ParallelForLoop *workList = nullptr;
     static std::mutex workListMutex;
@@ -45,6 +46,8 @@ namespace pbrt{
     };
 
     int MaxThreadIndex() {
+        // Once started, the pool is shared by every context
+        if (!threads.empty()) return (int)threads.size() + 1;
         return PbrtOptions.nThreads == 0 ? NumSystemCores() : PbrtOptions.nThreads;
     }
 
@@ -54,6 +57,82 @@ namespace pbrt{
 
     static std::condition_variable workListCondition;
 
+    // Runs the next chunk of the loop at the head of _workList_, releasing
+    // _lock_ while it runs
+    static void RunChunk(std::unique_lock<std::mutex> &lock) {
+        ParallelForLoop &loop = *workList;
+
+        // Find the set of loop iterations to run next
+        int64_t indexStart = loop.nextIndex;
+        int64_t indexEnd = std::min(indexStart + loop.chunkSize, loop.maxIndex);
+
+        // Update _loop_ to reflect iterations this thread will run
+        loop.nextIndex = indexEnd;
+        if (loop.nextIndex == loop.maxIndex) workList = loop.next;
+        loop.activeWorkers++;
+
+        // Run loop indices in _[indexStart, indexEnd)_
+        lock.unlock();
+        for (int64_t index = indexStart; index < indexEnd; ++index) {
+            if (loop.func1D) {
+                loop.func1D(index);
+            }
+                // Handle other types of loops
+            else {
+                assert(loop.func2D);
+                loop.func2D(Point2i(index % loop.nX, index / loop.nX));
+            }
+        }
+        lock.lock();
+
+        // Update _loop_ to reflect completion of iterations
+        loop.activeWorkers--;
+        if (loop.Finished()) workListCondition.notify_all();
+    }
+
+    static void workerThreadFunc() {
+        std::unique_lock<std::mutex> lock(workListMutex);
+        while (!shutdownThreads) {
+            if (!workList)
+                // Sleep until there are more tasks to run
+                workListCondition.wait(lock);
+            else
+                RunChunk(lock);
+        }
+    }
+
+    // Hands _loop_ to the workers and runs chunks of it on the calling
+    // thread until all of its iterations are done
+    static void RunLoop(ParallelForLoop &loop) {
+        std::unique_lock<std::mutex> lock(workListMutex);
+        loop.next = workList;
+        workList = &loop;
+        workListCondition.notify_all();
+
+        // Help out with parallel loop iterations in the current thread
+        while (!loop.Finished()) {
+            if (loop.nextIndex < loop.maxIndex)
+                RunChunk(lock);
+            else
+                // The last chunks are running elsewhere
+                workListCondition.wait(lock);
+        }
+    }
+
+    void ParallelFor(std::function<void(int64_t)> func, int64_t count,
+                     int chunkSize) {
+        assert(threads.size() > 0 || MaxThreadIndex() == 1);
+
+        // Run iterations immediately if not using threads or if _count_ is small
+        if (threads.empty() || count < chunkSize) {
+            for (int64_t i = 0; i < count; ++i) func(i);
+            return;
+        }
+
+        ParallelForLoop loop(std::move(func), count, chunkSize);
+        RunLoop(loop);
+    }
+
     void ParallelFor2D(std::function<void(Point2i)> func, const Point2i &count) {
         assert(threads.size() > 0 || MaxThreadIndex() == 1);
 
@@ -64,45 +143,30 @@ namespace pbrt{
         }
 
         ParallelForLoop loop(std::move(func), count);
-        {
-            std::lock_guard<std::mutex> lock(workListMutex);
-            loop.next = workList;
-            workList = &loop;
-        }
+        RunLoop(loop);
+    }
 
-        std::unique_lock<std::mutex> lock(workListMutex);
-        workListCondition.notify_all();
+    void ParallelInit() {
+        assert(threads.empty());
+        int nThreads = MaxThreadIndex();
 
-        // Help out with parallel loop iterations in the current thread
-        while (!loop.Finished()) {
-            // Run a chunk of loop iterations for _loop_
-
-            // Find the set of loop iterations to run next
-            int64_t indexStart = loop.nextIndex;
-            int64_t indexEnd = std::min(indexStart + loop.chunkSize, loop.maxIndex);
-
-            // Update _loop_ to reflect iterations this thread will run
-            loop.nextIndex = indexEnd;
-            if (loop.nextIndex == loop.maxIndex) workList = loop.next;
-            loop.activeWorkers++;
-
-            // Run loop indices in _[indexStart, indexEnd)_
-            lock.unlock();
-            for (int64_t index = indexStart; index < indexEnd; ++index) {
-                if (loop.func1D) {
-                    loop.func1D(index);
-                }
-                    // Handle other types of loops
-                else {
-                    assert(loop.func2D);
-                    loop.func2D(Point2i(index % loop.nX, index / loop.nX));
-                }
-            }
-            lock.lock();
+        // Create a bunch of worker threads; the main thread is one of them
+        for (int i = 0; i < nThreads - 1; ++i)
+            threads.push_back(std::thread(workerThreadFunc));
+    }
 
-            // Update _loop_ to reflect completion of iterations
-            loop.activeWorkers--;
+    void ParallelCleanup() {
+        if (threads.empty()) return;
+
+        {
+            std::lock_guard<std::mutex> lock(workListMutex);
+            shutdownThreads = true;
+            workListCondition.notify_all();
         }
+
+        for (std::thread &thread : threads) thread.join();
+        threads.erase(threads.begin(), threads.end());
+        shutdownThreads = false;
     }
 
-}
\ No newline at end of file
+}
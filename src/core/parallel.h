@@ -36,6 +36,15 @@ namespace pbrt{
 
     int MaxThreadIndex();
     int NumSystemCores();
+    // Starts _PbrtOptions.nThreads_ - 1 worker threads (all cores if 0),
+    // which run the loops of all threads; until then loops run on the
+    // calling thread
+    void ParallelInit();
+    void ParallelCleanup();
+    // Runs _func_ for every index in _[0, count)_, _chunkSize_ consecutive
+    // indices at a time; returns once all have run
+    void ParallelFor(std::function<void(int64_t)> func, int64_t count,
+                     int chunkSize = 1);
     void ParallelFor2D(std::function<void(Point2i)> func, const Point2i &count);
 }
 
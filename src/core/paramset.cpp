@@ -0,0 +1,277 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#include "paramset.h"
+
+namespace pbrt {
+
+    // A later parameter of the same name replaces an earlier one
+    template <typename T>
+    static void AddItem(std::vector<std::shared_ptr<ParamSetItem<T>>> &items,
+                        const std::string &name, std::unique_ptr<T[]> values,
+                        int nValues) {
+        for (auto &item : items)
+            if (item->name == name) {
+                item = std::make_shared<ParamSetItem<T>>(name, std::move(values),
+                                                         nValues);
+                return;
+            }
+        items.push_back(
+                std::make_shared<ParamSetItem<T>>(name, std::move(values), nValues));
+    }
+
+    template <typename T>
+    static const T *FindItem(
+            const std::vector<std::shared_ptr<ParamSetItem<T>>> &items,
+            const std::string &name, int *n) {
+        for (const auto &item : items)
+            if (item->name == name) {
+                *n = item->nValues;
+                item->lookedUp = true;
+                return item->values.get();
+            }
+        return nullptr;
+    }
+
+    template <typename T>
+    static T FindOneItem(const std::vector<std::shared_ptr<ParamSetItem<T>>> &items,
+                         const std::string &name, const T &d) {
+        int n;
+        const T *v = FindItem(items, name, &n);
+        return (v && n == 1) ? v[0] : d;
+    }
+
+    void ParamSet::AddFloat(const std::string &name,
+                            std::unique_ptr<float[]> values, int nValues) {
+        AddItem(floats, name, std::move(values), nValues);
+    }
+
+    void ParamSet::AddInt(const std::string &name, std::unique_ptr<int[]> values,
+                          int nValues) {
+        AddItem(ints, name, std::move(values), nValues);
+    }
+
+    void ParamSet::AddBool(const std::string &name,
+                           std::unique_ptr<bool[]> values, int nValues) {
+        AddItem(bools, name, std::move(values), nValues);
+    }
+
+    void ParamSet::AddPoint2f(const std::string &name,
+                              std::unique_ptr<Point2f[]> values, int nValues) {
+        AddItem(point2fs, name, std::move(values), nValues);
+    }
+
+    void ParamSet::AddVector2f(const std::string &name,
+                               std::unique_ptr<Vector2f[]> values, int nValues) {
+        AddItem(vector2fs, name, std::move(values), nValues);
+    }
+
+    void ParamSet::AddPoint3f(const std::string &name,
+                              std::unique_ptr<Point3f[]> values, int nValues) {
+        AddItem(point3fs, name, std::move(values), nValues);
+    }
+
+    void ParamSet::AddVector3f(const std::string &name,
+                               std::unique_ptr<Vector3f[]> values, int nValues) {
+        AddItem(vector3fs, name, std::move(values), nValues);
+    }
+
+    void ParamSet::AddNormal3f(const std::string &name,
+                               std::unique_ptr<Normal3f[]> values, int nValues) {
+        AddItem(normals, name, std::move(values), nValues);
+    }
+
+    void ParamSet::AddString(const std::string &name,
+                             std::unique_ptr<std::string[]> values, int nValues) {
+        AddItem(strings, name, std::move(values), nValues);
+    }
+
+    void ParamSet::AddTexture(const std::string &name, const std::string &value) {
+        std::unique_ptr<std::string[]> str(new std::string[1]);
+        str[0] = value;
+        AddItem(textures, name, std::move(str), 1);
+    }
+
+    void ParamSet::AddRGBSpectrum(const std::string &name,
+                                  std::unique_ptr<float[]> values, int nValues) {
+        std::unique_ptr<RGBSpectrum[]> s(new RGBSpectrum[nValues]);
+        for (int i = 0; i < nValues; ++i)
+            s[i] = RGBSpectrum::FromRGB(&values[3 * i]);
+        AddItem(spectra, name, std::move(s), nValues);
+    }
+
+    float ParamSet::FindOneFloat(const std::string &name, float d) const {
+        return FindOneItem(floats, name, d);
+    }
+
+    int ParamSet::FindOneInt(const std::string &name, int d) const {
+        return FindOneItem(ints, name, d);
+    }
+
+    bool ParamSet::FindOneBool(const std::string &name, bool d) const {
+        return FindOneItem(bools, name, d);
+    }
+
+    Point2f ParamSet::FindOnePoint2f(const std::string &name,
+                                     const Point2f &d) const {
+        return FindOneItem(point2fs, name, d);
+    }
+
+    Vector2f ParamSet::FindOneVector2f(const std::string &name,
+                                       const Vector2f &d) const {
+        return FindOneItem(vector2fs, name, d);
+    }
+
+    Point3f ParamSet::FindOnePoint3f(const std::string &name,
+                                     const Point3f &d) const {
+        return FindOneItem(point3fs, name, d);
+    }
+
+    Vector3f ParamSet::FindOneVector3f(const std::string &name,
+                                       const Vector3f &d) const {
+        return FindOneItem(vector3fs, name, d);
+    }
+
+    Normal3f ParamSet::FindOneNormal3f(const std::string &name,
+                                       const Normal3f &d) const {
+        return FindOneItem(normals, name, d);
+    }
+
+    Spectrum ParamSet::FindOneSpectrum(const std::string &name,
+                                       const Spectrum &d,
+                                       SpectrumType type) const {
+        int n;
+        const RGBSpectrum *s = FindItem(spectra, name, &n);
+        if (!s || n != 1) return d;
+        float rgb[3];
+        s[0].ToRGB(rgb);
+        return Spectrum::FromRGB(rgb, type);
+    }
+
+    std::string ParamSet::FindOneString(const std::string &name,
+                                        const std::string &d) const {
+        return FindOneItem(strings, name, d);
+    }
+
+    std::string ParamSet::FindTexture(const std::string &name) const {
+        return FindOneItem(textures, name, std::string());
+    }
+
+    const float *ParamSet::FindFloat(const std::string &name, int *n) const {
+        return FindItem(floats, name, n);
+    }
+
+    const int *ParamSet::FindInt(const std::string &name, int *n) const {
+        return FindItem(ints, name, n);
+    }
+
+    const bool *ParamSet::FindBool(const std::string &name, int *n) const {
+        return FindItem(bools, name, n);
+    }
+
+    const Point2f *ParamSet::FindPoint2f(const std::string &name, int *n) const {
+        return FindItem(point2fs, name, n);
+    }
+
+    const Vector2f *ParamSet::FindVector2f(const std::string &name,
+                                           int *n) const {
+        return FindItem(vector2fs, name, n);
+    }
+
+    const Point3f *ParamSet::FindPoint3f(const std::string &name, int *n) const {
+        return FindItem(point3fs, name, n);
+    }
+
+    const Vector3f *ParamSet::FindVector3f(const std::string &name,
+                                           int *n) const {
+        return FindItem(vector3fs, name, n);
+    }
+
+    const Normal3f *ParamSet::FindNormal3f(const std::string &name,
+                                           int *n) const {
+        return FindItem(normals, name, n);
+    }
+
+    const std::string *ParamSet::FindString(const std::string &name,
+                                            int *n) const {
+        return FindItem(strings, name, n);
+    }
+
+    template <typename T>
+    static void ReportUnusedItems(
+            const std::vector<std::shared_ptr<ParamSetItem<T>>> &items) {
+        for (const auto &item : items)
+            if (!item->lookedUp)
+                std::cerr << "Warning: parameter \"" << item->name
+                          << "\" not used" << std::endl;
+    }
+
+    void ParamSet::ReportUnused() const {
+        ReportUnusedItems(floats);
+        ReportUnusedItems(ints);
+        ReportUnusedItems(bools);
+        ReportUnusedItems(point2fs);
+        ReportUnusedItems(vector2fs);
+        ReportUnusedItems(point3fs);
+        ReportUnusedItems(vector3fs);
+        ReportUnusedItems(normals);
+        ReportUnusedItems(spectra);
+        ReportUnusedItems(strings);
+        ReportUnusedItems(textures);
+    }
+
+    template <typename T>
+    static uint64_t HashItems(
+            const std::vector<std::shared_ptr<ParamSetItem<T>>> &items,
+            uint64_t hash) {
+        // Parameters of different types never hash alike
+        hash = MixBits(hash + 1);
+        for (const auto &item : items) {
+            hash = HashBuffer(item->name.data(), item->name.size(), hash);
+            hash = HashBuffer(item->values.get(), item->nValues * sizeof(T), hash);
+        }
+        return hash;
+    }
+
+    static uint64_t HashItems(
+            const std::vector<std::shared_ptr<ParamSetItem<std::string>>> &items,
+            uint64_t hash) {
+        hash = MixBits(hash + 1);
+        for (const auto &item : items) {
+            hash = HashBuffer(item->name.data(), item->name.size(), hash);
+            for (int i = 0; i < item->nValues; ++i)
+                hash = HashBuffer(item->values[i].data(), item->values[i].size(),
+                                  hash);
+        }
+        return hash;
+    }
+
+    uint64_t ParamSet::Hash(uint64_t seed) const {
+        uint64_t hash = HashItems(floats, seed);
+        hash = HashItems(ints, hash);
+        hash = HashItems(bools, hash);
+        hash = HashItems(point2fs, hash);
+        hash = HashItems(vector2fs, hash);
+        hash = HashItems(point3fs, hash);
+        hash = HashItems(vector3fs, hash);
+        hash = HashItems(normals, hash);
+        hash = HashItems(spectra, hash);
+        hash = HashItems(strings, hash);
+        return HashItems(textures, hash);
+    }
+
+    void ParamSet::Clear() {
+        floats.clear();
+        ints.clear();
+        bools.clear();
+        point2fs.clear();
+        vector2fs.clear();
+        point3fs.clear();
+        vector3fs.clear();
+        normals.clear();
+        spectra.clear();
+        strings.clear();
+        textures.clear();
+    }
+}
@@ -0,0 +1,109 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#ifndef PBRT_WHITTED_PARAMSET_H
+#define PBRT_WHITTED_PARAMSET_H
+
+#include "main.h"
+#include "geometry.h"
+#include "spectrum.h"
+#include <atomic>
+
+namespace pbrt {
+
+    // One named parameter of a scene statement, e.g. _"float radius" [ 2 ]_
+    template <typename T>
+    struct ParamSetItem {
+        ParamSetItem(const std::string &name, std::unique_ptr<T[]> v,
+                     int nValues)
+                : name(name), values(std::move(v)), nValues(nValues) {}
+
+        const std::string name;
+        const std::unique_ptr<T[]> values;
+        const int nValues;
+        // Atomic since the shapes of a batch are created on several threads
+        mutable std::atomic<bool> lookedUp{false};
+    };
+
+    // The parameters given to a scene statement. Every _Find*()_ marks the
+    // parameter as used, so that _ReportUnused()_ can warn about misspelt or
+    // unsupported ones. Copies share their items.
+    class ParamSet {
+    public:
+        void AddFloat(const std::string &name, std::unique_ptr<float[]> values,
+                      int nValues = 1);
+        void AddInt(const std::string &name, std::unique_ptr<int[]> values,
+                    int nValues);
+        void AddBool(const std::string &name, std::unique_ptr<bool[]> values,
+                     int nValues);
+        void AddPoint2f(const std::string &name,
+                        std::unique_ptr<Point2f[]> values, int nValues);
+        void AddVector2f(const std::string &name,
+                         std::unique_ptr<Vector2f[]> values, int nValues);
+        void AddPoint3f(const std::string &name,
+                        std::unique_ptr<Point3f[]> values, int nValues);
+        void AddVector3f(const std::string &name,
+                         std::unique_ptr<Vector3f[]> values, int nValues);
+        void AddNormal3f(const std::string &name,
+                         std::unique_ptr<Normal3f[]> values, int nValues);
+        void AddString(const std::string &name,
+                       std::unique_ptr<std::string[]> values, int nValues);
+        void AddTexture(const std::string &name, const std::string &value);
+        // _values_ holds _nValues_ RGB triples
+        void AddRGBSpectrum(const std::string &name,
+                            std::unique_ptr<float[]> values, int nValues);
+
+        float FindOneFloat(const std::string &name, float d) const;
+        int FindOneInt(const std::string &name, int d) const;
+        bool FindOneBool(const std::string &name, bool d) const;
+        Point2f FindOnePoint2f(const std::string &name, const Point2f &d) const;
+        Vector2f FindOneVector2f(const std::string &name,
+                                 const Vector2f &d) const;
+        Point3f FindOnePoint3f(const std::string &name, const Point3f &d) const;
+        Vector3f FindOneVector3f(const std::string &name,
+                                 const Vector3f &d) const;
+        Normal3f FindOneNormal3f(const std::string &name,
+                                 const Normal3f &d) const;
+        // RGB values are converted to a _Spectrum_ of the given _type_
+        Spectrum FindOneSpectrum(
+                const std::string &name, const Spectrum &d,
+                SpectrumType type = SpectrumType::Reflectance) const;
+        std::string FindOneString(const std::string &name,
+                                  const std::string &d) const;
+        std::string FindTexture(const std::string &name) const;
+
+        // Return all values of the parameter, or _nullptr_ if it is not
+        // present
+        const float *FindFloat(const std::string &name, int *n) const;
+        const int *FindInt(const std::string &name, int *n) const;
+        const bool *FindBool(const std::string &name, int *n) const;
+        const Point2f *FindPoint2f(const std::string &name, int *n) const;
+        const Vector2f *FindVector2f(const std::string &name, int *n) const;
+        const Point3f *FindPoint3f(const std::string &name, int *n) const;
+        const Vector3f *FindVector3f(const std::string &name, int *n) const;
+        const Normal3f *FindNormal3f(const std::string &name, int *n) const;
+        const std::string *FindString(const std::string &name, int *n) const;
+
+        void ReportUnused() const;
+        void Clear();
+        // Hashes the names and values of all parameters, without marking
+        // them as used
+        uint64_t Hash(uint64_t seed = 0) const;
+
+    private:
+        friend class BinarySceneWriter;
+        std::vector<std::shared_ptr<ParamSetItem<float>>> floats;
+        std::vector<std::shared_ptr<ParamSetItem<int>>> ints;
+        std::vector<std::shared_ptr<ParamSetItem<bool>>> bools;
+        std::vector<std::shared_ptr<ParamSetItem<Point2f>>> point2fs;
+        std::vector<std::shared_ptr<ParamSetItem<Vector2f>>> vector2fs;
+        std::vector<std::shared_ptr<ParamSetItem<Point3f>>> point3fs;
+        std::vector<std::shared_ptr<ParamSetItem<Vector3f>>> vector3fs;
+        std::vector<std::shared_ptr<ParamSetItem<Normal3f>>> normals;
+        std::vector<std::shared_ptr<ParamSetItem<RGBSpectrum>>> spectra;
+        std::vector<std::shared_ptr<ParamSetItem<std::string>>> strings;
+        std::vector<std::shared_ptr<ParamSetItem<std::string>>> textures;
+    };
+}
+#endif //PBRT_WHITTED_PARAMSET_H
@@ -3,30 +3,920 @@
 //
 
 #include <string>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <set>
 #include "parser.h"
 #include "api.h"
+#include "paramset.h"
 #include "memory.h"
+#include "binaryscene.h"
 
 namespace pbrt {
 
-    void parse() {
-        /*
-           LookAt 0 0 0  # eye
-           0 0 -1  # look at point
-           0 1 0    # up vector
-         */
-        pbrtLookAt(0, 0, 0, 0, 0, -1, 0, 1, 0);
-        pbrtCamera("orthographic");
-        pbrtIntegrator("whitted");
-        pbrtFilm("image");
-        pbrtWorldBegin();
-        // scene
-        pbrtLightSource("point");
-        pbrtTranslate(-0.1f,0,-1);
-        pbrtShape("Sphere");
-
-        // scene end
-        pbrtWorldEnd();
-    }
-
-}
\ No newline at end of file
+    // A word, number, quoted string (quotes included) or bracket of the
+    // scene text. Tokens point into their tokenizer's buffer; nothing is
+    // copied until a string value is actually needed.
+    struct Token {
+        Token() = default;
+        Token(const char *str, size_t length, int line,
+              const std::string *filename)
+                : str(str), length(length), line(line), filename(filename) {}
+
+        template <size_t N>
+        bool operator==(const char (&s)[N]) const {
+            return length == N - 1 && memcmp(str, s, N - 1) == 0;
+        }
+        template <size_t N>
+        bool operator!=(const char (&s)[N]) const {
+            return !(*this == s);
+        }
+        bool IsQuoted() const { return length >= 2 && str[0] == '"'; }
+        std::string ToString() const { return std::string(str, length); }
+
+        const char *str = nullptr;
+        size_t length = 0;
+        int line = 0;
+        const std::string *filename = nullptr;
+    };
+
+    // Splits a scene file into _Token_s. Files are memory-mapped, so the
+    // OS reads them in as the tokenizer advances.
+    class Tokenizer {
+    public:
+        static std::unique_ptr<Tokenizer> CreateFromFile(
+                const std::string &filename);
+        static std::unique_ptr<Tokenizer> CreateFromString(std::string str);
+
+        // Returns _false_ at the end of the input or, with _error_ set, on
+        // an unterminated string
+        bool Next(Token *token);
+
+        const std::string filename;
+        bool error = false;
+
+    private:
+        Tokenizer(const std::string &filename) : filename(filename) {}
+
+        // The text is either mapped or, when that is not possible, read
+        // into _contents_
+        std::unique_ptr<MappedFile> file;
+        std::string contents;
+        const char *pos = nullptr, *end = nullptr;
+        int line = 1;
+    };
+
+    std::unique_ptr<Tokenizer> Tokenizer::CreateFromFile(
+            const std::string &filename) {
+        std::unique_ptr<Tokenizer> t(new Tokenizer(filename));
+        t->file = MappedFile::Open(filename);
+        if (t->file) {
+            t->pos = (const char *)t->file->Data();
+            t->end = t->pos + t->file->Size();
+            return t;
+        }
+        // Empty files and pipes cannot be mapped
+        std::ifstream in(filename, std::ios::binary);
+        if (!in) {
+            std::cerr << "Unable to open scene file \"" << filename << "\""
+                      << std::endl;
+            return nullptr;
+        }
+        std::stringstream ss;
+        ss << in.rdbuf();
+        t->contents = ss.str();
+        t->pos = t->contents.data();
+        t->end = t->pos + t->contents.size();
+        return t;
+    }
+
+    std::unique_ptr<Tokenizer> Tokenizer::CreateFromString(std::string str) {
+        std::unique_ptr<Tokenizer> t(new Tokenizer("<string>"));
+        t->contents = std::move(str);
+        t->pos = t->contents.data();
+        t->end = t->pos + t->contents.size();
+        return t;
+    }
+
+    // Characters that end a word: whitespace and control characters,
+    // quotes, brackets and comments
+    struct WordEndTable {
+        WordEndTable() {
+            for (int c = 0; c < 256; ++c)
+                isWordEnd[c] = c <= ' ' || c == '"' || c == '[' || c == ']' ||
+                               c == '#';
+        }
+        bool isWordEnd[256];
+    };
+    static const WordEndTable wordEnd;
+
+    bool Tokenizer::Next(Token *token) {
+        while (pos < end) {
+            char c = *pos;
+            if ((unsigned char)c <= ' ') {
+                if (c == '\n') ++line;
+                ++pos;
+            } else if (c == '#') {
+                const char *eol = (const char *)memchr(pos, '\n', end - pos);
+                pos = eol ? eol : end;
+            } else if (c == '[' || c == ']') {
+                *token = Token(pos++, 1, line, &filename);
+                return true;
+            } else if (c == '"') {
+                const char *start = pos++;
+                while (pos < end && *pos != '"') {
+                    if (*pos == '\n') break;
+                    if (*pos == '\\') ++pos;
+                    ++pos;
+                }
+                if (pos >= end || *pos != '"') {
+                    std::cerr << filename << ":" << line
+                              << ": unterminated string" << std::endl;
+                    error = true;
+                    return false;
+                }
+                ++pos;
+                *token = Token(start, pos - start, line, &filename);
+                return true;
+            } else {
+                // Anything else runs up to the next space, quote, bracket or
+                // comment
+                const char *start = pos++;
+                while (pos < end && !wordEnd.isWordEnd[(unsigned char)*pos])
+                    ++pos;
+                *token = Token(start, pos - start, line, &filename);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Returns the contents of a quoted token with escapes resolved
+    static std::string Dequote(const Token &token) {
+        const char *begin = token.str + 1, *end = token.str + token.length - 1;
+        if (!memchr(begin, '\\', end - begin)) return std::string(begin, end);
+        std::string str;
+        str.reserve(end - begin);
+        for (const char *p = begin; p < end; ++p) {
+            if (*p != '\\' || p + 1 == end) {
+                str += *p;
+                continue;
+            }
+            switch (*++p) {
+                case 'b': str += '\b'; break;
+                case 'f': str += '\f'; break;
+                case 'n': str += '\n'; break;
+                case 'r': str += '\r'; break;
+                case 't': str += '\t'; break;
+                default: str += *p; break;
+            }
+        }
+        return str;
+    }
+
+    static bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+    // Powers of ten up to $10^{10}$ are exact in single precision
+    static const float FloatPowersOf10[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f,
+                                            1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+
+    // Parses a decimal number. When the significant digits fit in a float's
+    // mantissa and the exponent is small, a single correctly rounded multiply
+    // or divide by an exact power of ten gives the correctly rounded result;
+    // scene files are almost entirely such numbers. Everything else goes
+    // through _strtof()_.
+    static bool ParseFloat(const Token &token, float *value) {
+        const char *p = token.str, *end = token.str + token.length;
+        bool negative = false;
+        if (p < end && (*p == '-' || *p == '+')) negative = *p++ == '-';
+        // Up to 19 digits fit in the 64-bit mantissa; longer numbers
+        // overflow it and take the slow path below
+        uint64_t mantissa = 0;
+        const char *intBegin = p;
+        while (p < end && IsDigit(*p)) mantissa = mantissa * 10 + (*p++ - '0');
+        int nDigits = p - intBegin, exponent = 0;
+        if (p < end && *p == '.') {
+            const char *fracBegin = ++p;
+            while (p < end && IsDigit(*p))
+                mantissa = mantissa * 10 + (*p++ - '0');
+            exponent = -(p - fracBegin);
+            nDigits -= exponent;
+        }
+        if (nDigits == 0) return false;
+        if (p < end && (*p == 'e' || *p == 'E')) {
+            ++p;
+            bool negativeExponent = false;
+            if (p < end && (*p == '-' || *p == '+'))
+                negativeExponent = *p++ == '-';
+            if (p == end || !IsDigit(*p)) return false;
+            int e = 0;
+            for (; p < end && IsDigit(*p); ++p)
+                if (e < 100000) e = e * 10 + (*p - '0');
+            exponent += negativeExponent ? -e : e;
+        }
+        if (p != end) return false;
+
+        if (nDigits <= 19 && mantissa <= (1 << 24) && exponent >= -10 &&
+            exponent <= 10) {
+            float f = (float)mantissa;
+            f = exponent < 0 ? f / FloatPowersOf10[-exponent]
+                             : f * FloatPowersOf10[exponent];
+            *value = negative ? -f : f;
+            return true;
+        }
+
+        char buf[64];
+        std::string longNumber;
+        const char *str = buf;
+        if (token.length < sizeof(buf)) {
+            memcpy(buf, token.str, token.length);
+            buf[token.length] = '\0';
+        } else {
+            longNumber = token.ToString();
+            str = longNumber.c_str();
+        }
+        *value = strtof(str, nullptr);
+        return true;
+    }
+
+    static bool ParseInt(const Token &token, int *value) {
+        const char *p = token.str, *end = token.str + token.length;
+        bool negative = false;
+        if (p < end && (*p == '-' || *p == '+')) negative = *p++ == '-';
+        if (p == end) return false;
+        // The magnitude of a negative number may be one larger
+        const int64_t maxMagnitude =
+                (int64_t)std::numeric_limits<int>::max() + (negative ? 1 : 0);
+        int64_t v = 0;
+        for (; p < end; ++p) {
+            if (!IsDigit(*p)) return false;
+            v = v * 10 + (*p - '0');
+            if (v > maxMagnitude) return false;
+        }
+        *value = (int)(negative ? -v : v);
+        return true;
+    }
+
+    class SceneParser {
+    public:
+        SceneParser(ParserTarget *target) : target(target) {}
+        bool Parse(std::unique_ptr<Tokenizer> tokenizer);
+
+    private:
+        // Reads the next token, continuing in the including file at the end
+        // of an included one; returns _false_ at the end of all input
+        bool NextToken(Token *token);
+        void Unget(const Token &token) {
+            ungetToken = token;
+            hasUngetToken = true;
+        }
+        bool Error(const Token &token, const std::string &message);
+        void Warning(const Token &token, const std::string &message);
+        void Unsupported(const Token &statement);
+
+        // Statement argument readers; all print an error on failure
+        bool ReadFloats(const Token &statement, float *v, int n);
+        bool ReadFloatArray(const Token &statement, float *v, int n);
+        bool ReadString(const Token &statement, std::string *str);
+        bool ReadParams(ParamSet *params);
+        bool AddParam(ParamSet *params, const Token &decl);
+        bool Include(const Token &statement);
+
+        ParserTarget *target;
+        // Tokenizers of the current file and the files including it
+        std::vector<std::unique_ptr<Tokenizer>> tokenizers;
+        // Tokenizers of finished files, kept until the end of the statement
+        // being parsed since its tokens may still point into them
+        std::vector<std::unique_ptr<Tokenizer>> finished;
+        Token ungetToken;
+        bool hasUngetToken = false;
+        bool error = false;
+        // Reused between parameter lists
+        std::vector<Token> values;
+        std::set<std::string> warnedUnsupported;
+    };
+
+    bool SceneParser::NextToken(Token *token) {
+        if (hasUngetToken) {
+            *token = ungetToken;
+            hasUngetToken = false;
+            return true;
+        }
+        while (!tokenizers.empty()) {
+            if (tokenizers.back()->Next(token)) return true;
+            if (tokenizers.back()->error) {
+                error = true;
+                return false;
+            }
+            finished.push_back(std::move(tokenizers.back()));
+            tokenizers.pop_back();
+        }
+        return false;
+    }
+
+    bool SceneParser::Error(const Token &token, const std::string &message) {
+        std::cerr << *token.filename << ":" << token.line << ": " << message
+                  << std::endl;
+        error = true;
+        return false;
+    }
+
+    void SceneParser::Warning(const Token &token, const std::string &message) {
+        std::cerr << *token.filename << ":" << token.line
+                  << ": Warning: " << message << std::endl;
+    }
+
+    // Unsupported statements are skipped with one warning per kind, so that
+    // large scenes do not flood the output
+    void SceneParser::Unsupported(const Token &statement) {
+        if (warnedUnsupported.insert(statement.ToString()).second)
+            Warning(statement, "\"" + statement.ToString() +
+                               "\" is not supported and is ignored");
+    }
+
+    bool SceneParser::ReadFloats(const Token &statement, float *v, int n) {
+        for (int i = 0; i < n; ++i) {
+            Token token;
+            if (!NextToken(&token))
+                return error ? false
+                             : Error(statement, "unexpected end of file after \"" +
+                                                statement.ToString() + "\"");
+            if (!ParseFloat(token, &v[i]))
+                return Error(token, "expected a number for \"" +
+                                    statement.ToString() + "\", got \"" +
+                                    token.ToString() + "\"");
+        }
+        return true;
+    }
+
+    bool SceneParser::ReadFloatArray(const Token &statement, float *v, int n) {
+        Token token;
+        if (!NextToken(&token) || token != "[")
+            return error ? false
+                         : Error(statement, "expected \"[\" after \"" +
+                                            statement.ToString() + "\"");
+        if (!ReadFloats(statement, v, n)) return false;
+        if (!NextToken(&token) || token != "]")
+            return error ? false
+                         : Error(statement, "expected " + std::to_string(n) +
+                                            " values for \"" +
+                                            statement.ToString() + "\"");
+        return true;
+    }
+
+    bool SceneParser::ReadString(const Token &statement, std::string *str) {
+        Token token;
+        if (!NextToken(&token) || !token.IsQuoted())
+            return error ? false
+                         : Error(statement, "expected a quoted string after \"" +
+                                            statement.ToString() + "\"");
+        *str = Dequote(token);
+        return true;
+    }
+
+    // Parameter lists are a sequence of _"type name" value_ or
+    // _"type name" [ values ]_ pairs
+    bool SceneParser::ReadParams(ParamSet *params) {
+        Token decl;
+        while (NextToken(&decl)) {
+            if (!decl.IsQuoted()) {
+                Unget(decl);
+                return true;
+            }
+            values.clear();
+            Token token;
+            if (!NextToken(&token))
+                return error ? false
+                             : Error(decl, "missing value for parameter " +
+                                           decl.ToString());
+            if (token == "[") {
+                while (true) {
+                    if (!NextToken(&token))
+                        return error ? false
+                                     : Error(decl, "unterminated value list for "
+                                                   "parameter " +
+                                                   decl.ToString());
+                    if (token == "]") break;
+                    values.push_back(token);
+                }
+            } else
+                values.push_back(token);
+            if (!AddParam(params, decl)) return false;
+        }
+        return !error;
+    }
+
+    bool SceneParser::AddParam(ParamSet *params, const Token &decl) {
+        // Split the declaration into its type and name
+        const char *p = decl.str + 1, *end = decl.str + decl.length - 1;
+        while (p < end && (*p == ' ' || *p == '\t')) ++p;
+        const char *typeBegin = p;
+        while (p < end && *p != ' ' && *p != '\t') ++p;
+        Token type(typeBegin, p - typeBegin, decl.line, decl.filename);
+        while (p < end && (*p == ' ' || *p == '\t')) ++p;
+        const char *nameEnd = end;
+        while (nameEnd > p && (nameEnd[-1] == ' ' || nameEnd[-1] == '\t'))
+            --nameEnd;
+        std::string name(p, nameEnd);
+        if (type.length == 0 || name.empty())
+            return Error(decl, "malformed parameter declaration " +
+                               decl.ToString());
+        int nValues = values.size();
+
+        auto readFloats = [&](int perItem, std::unique_ptr<float[]> *v) {
+            if (nValues % perItem != 0)
+                return Error(decl, "number of values for " + decl.ToString() +
+                                   " is not a multiple of " +
+                                   std::to_string(perItem));
+            v->reset(new float[nValues]);
+            for (int i = 0; i < nValues; ++i)
+                if (!ParseFloat(values[i], &(*v)[i]))
+                    return Error(values[i], "expected a number for " +
+                                            decl.ToString() + ", got \"" +
+                                            values[i].ToString() + "\"");
+            return true;
+        };
+        auto readStrings = [&](std::unique_ptr<std::string[]> *v) {
+            v->reset(new std::string[nValues]);
+            for (int i = 0; i < nValues; ++i) {
+                if (!values[i].IsQuoted())
+                    return Error(values[i], "expected a quoted string for " +
+                                            decl.ToString());
+                (*v)[i] = Dequote(values[i]);
+            }
+            return true;
+        };
+        std::unique_ptr<float[]> floats;
+        if (type == "float") {
+            if (!readFloats(1, &floats)) return false;
+            params->AddFloat(name, std::move(floats), nValues);
+        } else if (type == "integer") {
+            std::unique_ptr<int[]> ints(new int[nValues]);
+            for (int i = 0; i < nValues; ++i)
+                if (!ParseInt(values[i], &ints[i]))
+                    return Error(values[i], "expected an integer for " +
+                                            decl.ToString() + ", got \"" +
+                                            values[i].ToString() + "\"");
+            params->AddInt(name, std::move(ints), nValues);
+        } else if (type == "bool") {
+            std::unique_ptr<bool[]> bools(new bool[nValues]);
+            for (int i = 0; i < nValues; ++i) {
+                const Token &v = values[i];
+                if (v == "\"true\"" || v == "true")
+                    bools[i] = true;
+                else if (v == "\"false\"" || v == "false")
+                    bools[i] = false;
+                else
+                    return Error(v, "expected \"true\" or \"false\" for " +
+                                    decl.ToString());
+            }
+            params->AddBool(name, std::move(bools), nValues);
+        } else if (type == "point2" || type == "vector2") {
+            if (!readFloats(2, &floats)) return false;
+            if (type == "point2") {
+                std::unique_ptr<Point2f[]> p(new Point2f[nValues / 2]);
+                for (int i = 0; i < nValues / 2; ++i)
+                    p[i] = Point2f(floats[2 * i], floats[2 * i + 1]);
+                params->AddPoint2f(name, std::move(p), nValues / 2);
+            } else {
+                std::unique_ptr<Vector2f[]> v(new Vector2f[nValues / 2]);
+                for (int i = 0; i < nValues / 2; ++i)
+                    v[i] = Vector2f(floats[2 * i], floats[2 * i + 1]);
+                params->AddVector2f(name, std::move(v), nValues / 2);
+            }
+        } else if (type == "point" || type == "point3") {
+            if (!readFloats(3, &floats)) return false;
+            std::unique_ptr<Point3f[]> p(new Point3f[nValues / 3]);
+            for (int i = 0; i < nValues / 3; ++i)
+                p[i] = Point3f(floats[3 * i], floats[3 * i + 1],
+                               floats[3 * i + 2]);
+            params->AddPoint3f(name, std::move(p), nValues / 3);
+        } else if (type == "vector" || type == "vector3") {
+            if (!readFloats(3, &floats)) return false;
+            std::unique_ptr<Vector3f[]> v(new Vector3f[nValues / 3]);
+            for (int i = 0; i < nValues / 3; ++i)
+                v[i] = Vector3f(floats[3 * i], floats[3 * i + 1],
+                                floats[3 * i + 2]);
+            params->AddVector3f(name, std::move(v), nValues / 3);
+        } else if (type == "normal" || type == "normal3") {
+            if (!readFloats(3, &floats)) return false;
+            std::unique_ptr<Normal3f[]> n(new Normal3f[nValues / 3]);
+            for (int i = 0; i < nValues / 3; ++i)
+                n[i] = Normal3f(floats[3 * i], floats[3 * i + 1],
+                                floats[3 * i + 2]);
+            params->AddNormal3f(name, std::move(n), nValues / 3);
+        } else if (type == "rgb" || type == "color") {
+            if (!readFloats(3, &floats)) return false;
+            params->AddRGBSpectrum(name, std::move(floats), nValues / 3);
+        } else if (type == "string") {
+            std::unique_ptr<std::string[]> strings;
+            if (!readStrings(&strings)) return false;
+            params->AddString(name, std::move(strings), nValues);
+        } else if (type == "texture") {
+            std::unique_ptr<std::string[]> strings;
+            if (!readStrings(&strings)) return false;
+            if (nValues != 1)
+                return Error(decl, "expected one texture name for " +
+                                   decl.ToString());
+            params->AddTexture(name, strings[0]);
+        } else
+            Warning(decl, "parameter type \"" + type.ToString() +
+                          "\" is not supported; ignoring " + decl.ToString());
+        return true;
+    }
+
+    bool SceneParser::Include(const Token &statement) {
+        std::string filename;
+        if (!ReadString(statement, &filename)) return false;
+        // Relative paths are relative to the including file
+        const std::string &parent = *statement.filename;
+        size_t slash = parent.find_last_of('/');
+        if (!filename.empty() && filename[0] != '/' &&
+            slash != std::string::npos)
+            filename = parent.substr(0, slash + 1) + filename;
+        if (tokenizers.size() > 64)
+            return Error(statement, "Include nested too deeply");
+        if (BinaryScene::IsBinaryScene(filename)) {
+            std::unique_ptr<BinaryScene> scene = BinaryScene::Open(filename);
+            if (!scene || !scene->Replay(target))
+                return Error(statement, "unable to include \"" + filename + "\"");
+            return true;
+        }
+        std::unique_ptr<Tokenizer> t = Tokenizer::CreateFromFile(filename);
+        if (!t) return Error(statement, "unable to include \"" + filename + "\"");
+        tokenizers.push_back(std::move(t));
+        return true;
+    }
+
+    bool SceneParser::Parse(std::unique_ptr<Tokenizer> tokenizer) {
+        tokenizers.push_back(std::move(tokenizer));
+        Token tok;
+        // Argument storage shared by all statements
+        float v[16];
+        std::string str, str2;
+        ParamSet params;
+        while (NextToken(&tok)) {
+            finished.clear();
+            params.Clear();
+            bool ok = true;
+            switch (tok.str[0]) {
+                case 'A':
+                    if (tok == "AttributeBegin")
+                        target->AttributeBegin();
+                    else if (tok == "AttributeEnd")
+                        target->AttributeEnd();
+                    else if (tok == "ActiveTransform") {
+                        Token a;
+                        if (!NextToken(&a))
+                            ok = error ? false
+                                       : Error(tok, "expected All, StartTime or "
+                                                    "EndTime");
+                        else if (a == "All")
+                            target->ActiveTransformAll();
+                        else if (a == "EndTime")
+                            target->ActiveTransformEndTime();
+                        else if (a == "StartTime")
+                            target->ActiveTransformStartTime();
+                        else
+                            ok = Error(a, "unknown ActiveTransform type \"" +
+                                          a.ToString() + "\"");
+                    } else if (tok == "AreaLightSource" || tok == "Accelerator") {
+                        ok = ReadString(tok, &str) && ReadParams(&params);
+                        if (ok) Unsupported(tok);
+                    } else
+                        ok = Error(tok, "unknown directive \"" + tok.ToString() +
+                                        "\"");
+                    break;
+                case 'C':
+                    if (tok == "ConcatTransform") {
+                        if ((ok = ReadFloatArray(tok, v, 16)))
+                            target->ConcatTransform(v);
+                    } else if (tok == "CoordinateSystem") {
+                        if ((ok = ReadString(tok, &str)))
+                            target->CoordinateSystem(str);
+                    } else if (tok == "CoordSysTransform") {
+                        if ((ok = ReadString(tok, &str)))
+                            target->CoordSysTransform(str);
+                    } else if (tok == "Camera") {
+                        if ((ok = ReadString(tok, &str) && ReadParams(&params)))
+                            target->Camera(str, params);
+                    } else
+                        ok = Error(tok, "unknown directive \"" + tok.ToString() +
+                                        "\"");
+                    break;
+                case 'F':
+                    if (tok == "Film") {
+                        if ((ok = ReadString(tok, &str) && ReadParams(&params)))
+                            target->Film(str, params);
+                    } else
+                        ok = Error(tok, "unknown directive \"" + tok.ToString() +
+                                        "\"");
+                    break;
+                case 'I':
+                    if (tok == "Identity")
+                        target->Identity();
+                    else if (tok == "Include" || tok == "Import")
+                        ok = Include(tok);
+                    else if (tok == "Integrator") {
+                        if ((ok = ReadString(tok, &str) && ReadParams(&params)))
+                            target->Integrator(str, params);
+                    } else
+                        ok = Error(tok, "unknown directive \"" + tok.ToString() +
+                                        "\"");
+                    break;
+                case 'L':
+                    if (tok == "LightSource") {
+                        if ((ok = ReadString(tok, &str) && ReadParams(&params)))
+                            target->LightSource(str, params);
+                    } else if (tok == "LookAt") {
+                        if ((ok = ReadFloats(tok, v, 9)))
+                            target->LookAt(v[0], v[1], v[2], v[3], v[4], v[5],
+                                           v[6], v[7], v[8]);
+                    } else
+                        ok = Error(tok, "unknown directive \"" + tok.ToString() +
+                                        "\"");
+                    break;
+                case 'M':
+                    if (tok == "MakeNamedMaterial") {
+                        if ((ok = ReadString(tok, &str) && ReadParams(&params)))
+                            target->MakeNamedMaterial(str, params);
+                    } else if (tok == "Material") {
+                        if ((ok = ReadString(tok, &str) && ReadParams(&params)))
+                            target->Material(str, params);
+                    } else if (tok == "MakeNamedMedium") {
+                        ok = ReadString(tok, &str) && ReadParams(&params);
+                        if (ok) Unsupported(tok);
+                    } else if (tok == "MediumInterface") {
+                        // One medium name, or the inside and outside ones
+                        Token second;
+                        ok = ReadString(tok, &str);
+                        if (ok && NextToken(&second) && !second.IsQuoted())
+                            Unget(second);
+                        if (ok) Unsupported(tok);
+                    } else
+                        ok = Error(tok, "unknown directive \"" + tok.ToString() +
+                                        "\"");
+                    break;
+                case 'N':
+                    if (tok == "NamedMaterial") {
+                        if ((ok = ReadString(tok, &str)))
+                            target->NamedMaterial(str);
+                    } else
+                        ok = Error(tok, "unknown directive \"" + tok.ToString() +
+                                        "\"");
+                    break;
+                case 'O':
+                    // Without instancing support, an object's shapes are
+                    // added to the scene where they are defined
+                    if (tok == "ObjectBegin") {
+                        if ((ok = ReadString(tok, &str))) {
+                            Unsupported(tok);
+                            target->AttributeBegin();
+                        }
+                    } else if (tok == "ObjectEnd") {
+                        target->AttributeEnd();
+                    } else if (tok == "ObjectInstance") {
+                        if ((ok = ReadString(tok, &str))) Unsupported(tok);
+                    } else
+                        ok = Error(tok, "unknown directive \"" + tok.ToString() +
+                                        "\"");
+                    break;
+                case 'P':
+                    if (tok == "PixelFilter") {
+                        if ((ok = ReadString(tok, &str) && ReadParams(&params)))
+                            target->PixelFilter(str, params);
+                    } else
+                        ok = Error(tok, "unknown directive \"" + tok.ToString() +
+                                        "\"");
+                    break;
+                case 'R':
+                    if (tok == "ReverseOrientation")
+                        Unsupported(tok);
+                    else if (tok == "Rotate") {
+                        if ((ok = ReadFloats(tok, v, 4)))
+                            target->Rotate(v[0], v[1], v[2], v[3]);
+                    } else
+                        ok = Error(tok, "unknown directive \"" + tok.ToString() +
+                                        "\"");
+                    break;
+                case 'S':
+                    if (tok == "Shape") {
+                        if ((ok = ReadString(tok, &str) && ReadParams(&params)))
+                            target->Shape(str, params);
+                    } else if (tok == "Sampler") {
+                        if ((ok = ReadString(tok, &str) && ReadParams(&params)))
+                            target->Sampler(str, params);
+                    } else if (tok == "Scale") {
+                        if ((ok = ReadFloats(tok, v, 3)))
+                            target->Scale(v[0], v[1], v[2]);
+                    } else
+                        ok = Error(tok, "unknown directive \"" + tok.ToString() +
+                                        "\"");
+                    break;
+                case 'T':
+                    if (tok == "TransformBegin")
+                        target->TransformBegin();
+                    else if (tok == "TransformEnd")
+                        target->TransformEnd();
+                    else if (tok == "Transform") {
+                        if ((ok = ReadFloatArray(tok, v, 16))) target->Transform(v);
+                    } else if (tok == "Translate") {
+                        if ((ok = ReadFloats(tok, v, 3)))
+                            target->Translate(v[0], v[1], v[2]);
+                    } else if (tok == "TransformTimes") {
+                        ok = ReadFloats(tok, v, 2);
+                        if (ok) Unsupported(tok);
+                    } else if (tok == "Texture") {
+                        ok = ReadString(tok, &str) && ReadString(tok, &str2) &&
+                             ReadString(tok, &str2) && ReadParams(&params);
+                        if (ok) Unsupported(tok);
+                    } else
+                        ok = Error(tok, "unknown directive \"" + tok.ToString() +
+                                        "\"");
+                    break;
+                case 'W':
+                    if (tok == "WorldBegin")
+                        target->WorldBegin();
+                    else if (tok == "WorldEnd")
+                        target->WorldEnd();
+                    else
+                        ok = Error(tok, "unknown directive \"" + tok.ToString() +
+                                        "\"");
+                    break;
+                default:
+                    ok = Error(tok, "unknown directive \"" + tok.ToString() +
+                                    "\"");
+            }
+            if (!ok) return false;
+        }
+        return !error;
+    }
+
+    void ParserTarget::Shapes(const std::string &name, const ParamSet &params,
+                              const std::vector<std::string> &valueNames,
+                              const float *entries, size_t count) {
+        const size_t stride = 16 + valueNames.size();
+        ParamSet shapeParams = params;
+        for (size_t i = 0; i < count; ++i) {
+            const float *entry = entries + i * stride;
+            for (size_t j = 0; j < valueNames.size(); ++j) {
+                std::unique_ptr<float[]> value(new float[1]);
+                value[0] = entry[16 + j];
+                shapeParams.AddFloat(valueNames[j], std::move(value), 1);
+            }
+            TransformBegin();
+            Transform(entry);
+            Shape(name, shapeParams);
+            TransformEnd();
+        }
+    }
+
+    bool ParseFile(ParserTarget *target, const std::string &filename) {
+        if (BinaryScene::IsBinaryScene(filename)) {
+            std::unique_ptr<BinaryScene> scene = BinaryScene::Open(filename);
+            return scene && scene->Replay(target);
+        }
+        std::unique_ptr<Tokenizer> t = Tokenizer::CreateFromFile(filename);
+        if (!t) return false;
+        SceneParser parser(target);
+        return parser.Parse(std::move(t));
+    }
+
+    bool ParseString(ParserTarget *target, const std::string &str) {
+        SceneParser parser(target);
+        return parser.Parse(Tokenizer::CreateFromString(str));
+    }
+
+    bool pbrtParseFile(const std::string &filename) {
+        // The scene is rendered at its _WorldEnd_, so the file is hashed
+        // before it is parsed; one that cannot be mapped is known by name
+        std::unique_ptr<MappedFile> file = MappedFile::Open(filename);
+        if (file)
+            pbrtHashSceneInput(file->Data(), file->Size());
+        else
+            pbrtHashSceneInput(filename.data(), filename.size());
+        APIParserTarget target;
+        return ParseFile(&target, filename);
+    }
+
+    bool pbrtParseString(const std::string &str) {
+        pbrtHashSceneInput(str.data(), str.size());
+        APIParserTarget target;
+        return ParseString(&target, str);
+    }
+
+    void APIParserTarget::Identity() { pbrtIdentity(); }
+
+    void APIParserTarget::Translate(float dx, float dy, float dz) {
+        pbrtTranslate(dx, dy, dz);
+    }
+
+    void APIParserTarget::Rotate(float angle, float ax, float ay, float az) {
+        pbrtRotate(angle, ax, ay, az);
+    }
+
+    void APIParserTarget::Scale(float sx, float sy, float sz) {
+        pbrtScale(sx, sy, sz);
+    }
+
+    void APIParserTarget::LookAt(float ex, float ey, float ez, float lx,
+                                 float ly, float lz, float ux, float uy,
+                                 float uz) {
+        pbrtLookAt(ex, ey, ez, lx, ly, lz, ux, uy, uz);
+    }
+
+    void APIParserTarget::ConcatTransform(const float transform[16]) {
+        pbrtConcatTransform(transform);
+    }
+
+    void APIParserTarget::Transform(const float transform[16]) {
+        pbrtTransform(transform);
+    }
+
+    void APIParserTarget::CoordinateSystem(const std::string &name) {
+        pbrtCoordinateSystem(name);
+    }
+
+    void APIParserTarget::CoordSysTransform(const std::string &name) {
+        pbrtCoordSysTransform(name);
+    }
+
+    void APIParserTarget::ActiveTransformAll() { pbrtActiveTransformAll(); }
+
+    void APIParserTarget::ActiveTransformEndTime() {
+        pbrtActiveTransformEndTime();
+    }
+
+    void APIParserTarget::ActiveTransformStartTime() {
+        pbrtActiveTransformStartTime();
+    }
+
+    void APIParserTarget::PixelFilter(const std::string &name,
+                                      const ParamSet &params) {
+        pbrtPixelFilter(name, params);
+    }
+
+    void APIParserTarget::Film(const std::string &type, const ParamSet &params) {
+        pbrtFilm(type, params);
+    }
+
+    void APIParserTarget::Sampler(const std::string &name,
+                                  const ParamSet &params) {
+        pbrtSampler(name, params);
+    }
+
+    void APIParserTarget::Integrator(const std::string &name,
+                                     const ParamSet &params) {
+        pbrtIntegrator(name, params);
+    }
+
+    void APIParserTarget::Camera(const std::string &name,
+                                 const ParamSet &params) {
+        pbrtCamera(name, params);
+    }
+
+    void APIParserTarget::WorldBegin() { pbrtWorldBegin(); }
+
+    void APIParserTarget::AttributeBegin() { pbrtAttributeBegin(); }
+
+    void APIParserTarget::AttributeEnd() { pbrtAttributeEnd(); }
+
+    void APIParserTarget::TransformBegin() { pbrtTransformBegin(); }
+
+    void APIParserTarget::TransformEnd() { pbrtTransformEnd(); }
+
+    void APIParserTarget::Material(const std::string &name,
+                                   const ParamSet &params) {
+        pbrtMaterial(name, params);
+    }
+
+    void APIParserTarget::MakeNamedMaterial(const std::string &name,
+                                            const ParamSet &params) {
+        pbrtMakeNamedMaterial(name, params);
+    }
+
+    void APIParserTarget::NamedMaterial(const std::string &name) {
+        pbrtNamedMaterial(name);
+    }
+
+    void APIParserTarget::LightSource(const std::string &name,
+                                      const ParamSet &params) {
+        pbrtLightSource(name, params);
+    }
+
+    void APIParserTarget::Shape(const std::string &name,
+                                const ParamSet &params) {
+        pbrtShape(name, params);
+    }
+
+    void APIParserTarget::Shapes(const std::string &name,
+                                 const ParamSet &params,
+                                 const std::vector<std::string> &valueNames,
+                                 const float *entries, size_t count) {
+        pbrtShapes(name, params, valueNames, entries, count);
+    }
+
+    void APIParserTarget::WorldEnd() { pbrtWorldEnd(); }
+}
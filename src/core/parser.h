@@ -7,6 +7,106 @@
 
 #include "main.h"
 namespace pbrt {
-    void parse();
+    // Receives the statements of a scene description, one call per
+    // statement with the same arguments as the corresponding _pbrt*()_ API
+    // function. Parsing into the API is the common case; other targets
+    // convert scenes to another format.
+    class ParserTarget {
+    public:
+        virtual ~ParserTarget() {}
+        virtual void Identity() = 0;
+        virtual void Translate(float dx, float dy, float dz) = 0;
+        virtual void Rotate(float angle, float ax, float ay, float az) = 0;
+        virtual void Scale(float sx, float sy, float sz) = 0;
+        virtual void LookAt(float ex, float ey, float ez, float lx, float ly,
+                            float lz, float ux, float uy, float uz) = 0;
+        virtual void ConcatTransform(const float transform[16]) = 0;
+        virtual void Transform(const float transform[16]) = 0;
+        virtual void CoordinateSystem(const std::string &name) = 0;
+        virtual void CoordSysTransform(const std::string &name) = 0;
+        virtual void ActiveTransformAll() = 0;
+        virtual void ActiveTransformEndTime() = 0;
+        virtual void ActiveTransformStartTime() = 0;
+        virtual void PixelFilter(const std::string &name,
+                                 const ParamSet &params) = 0;
+        virtual void Film(const std::string &type, const ParamSet &params) = 0;
+        virtual void Sampler(const std::string &name,
+                             const ParamSet &params) = 0;
+        virtual void Integrator(const std::string &name,
+                                const ParamSet &params) = 0;
+        virtual void Camera(const std::string &name, const ParamSet &params) = 0;
+        virtual void WorldBegin() = 0;
+        virtual void AttributeBegin() = 0;
+        virtual void AttributeEnd() = 0;
+        virtual void TransformBegin() = 0;
+        virtual void TransformEnd() = 0;
+        virtual void Material(const std::string &name,
+                              const ParamSet &params) = 0;
+        virtual void MakeNamedMaterial(const std::string &name,
+                                       const ParamSet &params) = 0;
+        virtual void NamedMaterial(const std::string &name) = 0;
+        virtual void LightSource(const std::string &name,
+                                 const ParamSet &params) = 0;
+        virtual void Shape(const std::string &name, const ParamSet &params) = 0;
+        // Many shapes at once, as given to _pbrtShapes()_; by default each
+        // is issued as _TransformBegin; Transform; Shape; TransformEnd_
+        virtual void Shapes(const std::string &name, const ParamSet &params,
+                            const std::vector<std::string> &valueNames,
+                            const float *entries, size_t count);
+        virtual void WorldEnd() = 0;
+    };
+
+    // Parse a scene description in the pbrt-v3 format and issue the
+    // corresponding _pbrt*()_ API calls. Errors are reported with the file
+    // name and line; parsing stops at the first one and _false_ is returned.
+    // The file and any it includes may also be binary scenes; see
+    // _BinaryScene_.
+    bool pbrtParseFile(const std::string &filename);
+    bool pbrtParseString(const std::string &str);
+
+    // The same, with the statements going to _target_
+    bool ParseFile(ParserTarget *target, const std::string &filename);
+    bool ParseString(ParserTarget *target, const std::string &str);
+
+    // Issues each statement as the corresponding _pbrt*()_ call
+    class APIParserTarget : public ParserTarget {
+    public:
+        void Identity() override;
+        void Translate(float dx, float dy, float dz) override;
+        void Rotate(float angle, float ax, float ay, float az) override;
+        void Scale(float sx, float sy, float sz) override;
+        void LookAt(float ex, float ey, float ez, float lx, float ly, float lz,
+                    float ux, float uy, float uz) override;
+        void ConcatTransform(const float transform[16]) override;
+        void Transform(const float transform[16]) override;
+        void CoordinateSystem(const std::string &name) override;
+        void CoordSysTransform(const std::string &name) override;
+        void ActiveTransformAll() override;
+        void ActiveTransformEndTime() override;
+        void ActiveTransformStartTime() override;
+        void PixelFilter(const std::string &name,
+                         const ParamSet &params) override;
+        void Film(const std::string &type, const ParamSet &params) override;
+        void Sampler(const std::string &name, const ParamSet &params) override;
+        void Integrator(const std::string &name,
+                        const ParamSet &params) override;
+        void Camera(const std::string &name, const ParamSet &params) override;
+        void WorldBegin() override;
+        void AttributeBegin() override;
+        void AttributeEnd() override;
+        void TransformBegin() override;
+        void TransformEnd() override;
+        void Material(const std::string &name, const ParamSet &params) override;
+        void MakeNamedMaterial(const std::string &name,
+                               const ParamSet &params) override;
+        void NamedMaterial(const std::string &name) override;
+        void LightSource(const std::string &name,
+                         const ParamSet &params) override;
+        void Shape(const std::string &name, const ParamSet &params) override;
+        void Shapes(const std::string &name, const ParamSet &params,
+                    const std::vector<std::string> &valueNames,
+                    const float *entries, size_t count) override;
+        void WorldEnd() override;
+    };
 }
 #endif //PBRT_WHITTED_PARSER_H
@@ -0,0 +1,65 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#include "preview.h"
+#include <unistd.h>
+
+namespace pbrt {
+
+    // Keep datagrams well below the default socket buffer size
+    static const size_t MaxPreviewPayload = 48 * 1024;
+
+    std::unique_ptr<PreviewChannel> PreviewChannel::Create(const std::string &path,
+                                                           const Point2i &resolution) {
+        sockaddr_un address;
+        memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(address.sun_path)) {
+            std::cerr << "Preview socket path \"" << path << "\" is too long" << std::endl;
+            return nullptr;
+        }
+        memcpy(address.sun_path, path.c_str(), path.size());
+
+        // The socket is not connected: the viewer only has to exist while
+        // a tile is sent, not when the render starts
+        int fd = socket(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (fd < 0) {
+            std::cerr << "Unable to create preview socket" << std::endl;
+            return nullptr;
+        }
+        return std::unique_ptr<PreviewChannel>(
+                new PreviewChannel(fd, address, resolution));
+    }
+
+    PreviewChannel::~PreviewChannel() { close(fd); }
+
+    bool PreviewChannel::SendTile(const Bounds2i &bounds, const float *rgb) {
+        int width = bounds.pMax.x - bounds.pMin.x;
+        size_t rowBytes = 3 * sizeof(float) * width;
+        int rowsPerBand = std::max(1, (int)(MaxPreviewPayload / rowBytes));
+        for (int y0 = bounds.pMin.y; y0 < bounds.pMax.y; y0 += rowsPerBand) {
+            int y1 = std::min(y0 + rowsPerBand, bounds.pMax.y);
+            PreviewTileHeader header;
+            memcpy(header.magic, "PBPV", 4);
+            header.xResolution = resolution.x;
+            header.yResolution = resolution.y;
+            header.x0 = bounds.pMin.x;
+            header.y0 = y0;
+            header.x1 = bounds.pMax.x;
+            header.y1 = y1;
+
+            size_t payload = rowBytes * (y1 - y0);
+            buffer.resize(sizeof(header) + payload);
+            memcpy(&buffer[0], &header, sizeof(header));
+            memcpy(&buffer[sizeof(header)],
+                   rgb + 3 * (size_t)(y0 - bounds.pMin.y) * width, payload);
+            // Fails with EAGAIN when the viewer is behind and with
+            // ENOENT/ECONNREFUSED when there is none
+            if (sendto(fd, buffer.data(), buffer.size(), MSG_DONTWAIT | MSG_NOSIGNAL,
+                       (const sockaddr *)&address, sizeof(address)) < 0)
+                return false;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,52 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#ifndef PBRT_WHITTED_PREVIEW_H
+#define PBRT_WHITTED_PREVIEW_H
+
+#include "main.h"
+#include "geometry.h"
+#include <sys/socket.h>
+#include <sys/un.h>
+
+namespace pbrt {
+
+    // Header of each preview datagram. It is followed by
+    // _(x1 - x0) * (y1 - y0)_ linear RGB float triples in scanline order,
+    // all in host byte order.
+    struct PreviewTileHeader {
+        char magic[4];  // "PBPV"
+        int32_t xResolution, yResolution;
+        int32_t x0, y0, x1, y1;
+    };
+
+    // Sends pixels to a viewer that has bound a UNIX datagram socket at
+    // _path_, so that it can show the image while it is being rendered. The
+    // viewer may start, stop or fall behind at any time: sending never
+    // blocks, and _SendTile()_ reports whether the update went out so that
+    // the caller can retry it later with fresher pixels.
+    class PreviewChannel {
+    public:
+        static std::unique_ptr<PreviewChannel> Create(const std::string &path,
+                                                      const Point2i &resolution);
+        ~PreviewChannel();
+
+        // _rgb_ holds _bounds.Area()_ RGB triples; large tiles are split into
+        // bands of rows that each fit in one datagram.
+        bool SendTile(const Bounds2i &bounds, const float *rgb);
+
+    private:
+        PreviewChannel(int fd, const sockaddr_un &address,
+                       const Point2i &resolution)
+                : fd(fd), address(address), resolution(resolution) {}
+        PreviewChannel(const PreviewChannel &) = delete;
+        PreviewChannel &operator=(const PreviewChannel &) = delete;
+
+        int fd;
+        sockaddr_un address;
+        const Point2i resolution;
+        std::vector<char> buffer;
+    };
+}
+#endif //PBRT_WHITTED_PREVIEW_H
@@ -37,4 +37,11 @@ namespace pbrt{
             material->ComputeScatteringFunctions(isect, arena, mode,
                                                  allowMultipleLobes);
     }
-}
\ No newline at end of file
+
+    void Aggregate::ComputeScatteringFunctions(SurfaceInteraction *,
+                                               MemoryArena &, TransportMode,
+                                               bool) const {
+        std::cerr << "Aggregate::ComputeScatteringFunctions() method called; "
+                     "should have gone to GeometricPrimitive" << std::endl;
+    }
+}
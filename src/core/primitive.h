@@ -41,7 +41,11 @@ namespace pbrt{
     };
 
     class Aggregate : public Primitive {
-        
+    public:
+        // Intersections record the primitive that was hit, never the aggregate
+        void ComputeScatteringFunctions(SurfaceInteraction *isect,
+                                        MemoryArena &arena, TransportMode mode,
+                                        bool allowMultipleLobes) const;
     };
 }
 #endif //PBRT_WHITTED_PRIMITIVE_H
@@ -30,8 +30,16 @@ namespace pbrt{
 
     Spectrum BSDF::Sample_f(const Vector3f &wo, Vector3f *wi, const Point2f &u, float *pdf, BxDFType type,
                             BxDFType *sampledType) const {
-        std::cout << "BSDF::Sample_f should not be called..." << std::endl;
-        return pbrt::Spectrum();
+        // Whitted asks for specular lobes at every hit; matte surfaces have
+        // none, so there is nothing to sample
+        *pdf = 0;
+        if (sampledType) *sampledType = BxDFType(0);
+        for (int i = 0; i < nBxDFs; ++i)
+            if (bxdfs[i]->MatchesFlags(type)) {
+                std::cout << "BSDF::Sample_f should not be called..." << std::endl;
+                break;
+            }
+        return Spectrum(0.f);
     }
 
 
@@ -0,0 +1,260 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#include "renderserver.h"
+#include <chrono>
+#include <sstream>
+#include <thread>
+#include <errno.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace pbrt {
+
+    // Longest request line accepted
+    static const size_t MaxRequestLength = 4096;
+
+    static bool MakeAddress(const std::string &path, sockaddr_un *address) {
+        memset(address, 0, sizeof(*address));
+        address->sun_family = AF_UNIX;
+        if (path.size() >= sizeof(address->sun_path)) {
+            std::cerr << "Socket path \"" << path << "\" is too long" << std::endl;
+            return false;
+        }
+        memcpy(address->sun_path, path.c_str(), path.size());
+        return true;
+    }
+
+    static bool WriteAll(int fd, const std::string &str) {
+        size_t written = 0;
+        while (written < str.size()) {
+            ssize_t n = send(fd, str.data() + written, str.size() - written,
+                             MSG_NOSIGNAL);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) return false;
+            written += n;
+        }
+        return true;
+    }
+
+    // Reads up to the first newline or the end of the stream
+    static bool ReadLine(int fd, std::string *line) {
+        line->clear();
+        char c;
+        while (line->size() < MaxRequestLength) {
+            ssize_t n = recv(fd, &c, 1, 0);
+            if (n < 0 && errno == EINTR) continue;
+            if (n < 0) return false;
+            if (n == 0 || c == '\n') return true;
+            line->push_back(c);
+        }
+        return false;
+    }
+
+    // Parses _count_ comma-separated floats
+    static bool ParseFloats(const std::string &str, float *v, int count) {
+        const char *p = str.c_str();
+        for (int i = 0; i < count; ++i) {
+            char *end;
+            v[i] = strtof(p, &end);
+            if (end == p || *end != (i + 1 < count ? ',' : '\0')) return false;
+            p = end + 1;
+        }
+        return true;
+    }
+
+    std::unique_ptr<RenderServer> RenderServer::Create(
+            const std::string &path, std::shared_ptr<const ResidentScene> scene,
+            int maxRenders) {
+        sockaddr_un address;
+        if (!MakeAddress(path, &address)) return nullptr;
+
+        int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd < 0) {
+            std::cerr << "Unable to create render server socket" << std::endl;
+            return nullptr;
+        }
+
+        // A socket left behind by an earlier server would make bind() fail.
+        // It is only removed if nothing answers on it; anything else at
+        // _path_ is left for bind() to report.
+        struct stat st;
+        if (stat(path.c_str(), &st) == 0 && S_ISSOCK(st.st_mode)) {
+            int probe = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+            bool listening = probe >= 0 &&
+                    connect(probe, (const sockaddr *)&address, sizeof(address)) == 0;
+            bool stale = !listening && errno == ECONNREFUSED;
+            if (probe >= 0) close(probe);
+            if (listening) {
+                std::cerr << "Another render server is listening on \"" << path
+                          << "\"" << std::endl;
+                close(fd);
+                return nullptr;
+            }
+            if (stale) unlink(path.c_str());
+        }
+        // Connecting needs write permission on the socket file; nobody can
+        // connect before _listen()_, so the mode is set in between
+        if (bind(fd, (const sockaddr *)&address, sizeof(address)) < 0 ||
+            chmod(path.c_str(), S_IRUSR | S_IWUSR) < 0 || listen(fd, 16) < 0) {
+            std::cerr << "Unable to listen on \"" << path << "\": "
+                      << strerror(errno) << std::endl;
+            close(fd);
+            return nullptr;
+        }
+        return std::unique_ptr<RenderServer>(
+                new RenderServer(fd, path, std::move(scene), maxRenders));
+    }
+
+    RenderServer::~RenderServer() {
+        close(fd);
+        unlink(path.c_str());
+    }
+
+    void RenderServer::Run() {
+        while (true) {
+            // Leave further clients in the listen queue while the most
+            // connections are being served
+            {
+                std::unique_lock<std::mutex> lock(activeMutex);
+                while (connections >= MaxConnections && !quitting)
+                    activeCondition.wait(lock);
+                if (quitting) break;
+            }
+            int client = accept4(fd, nullptr, nullptr, SOCK_CLOEXEC);
+            if (client < 0) {
+                if (errno == EINTR || errno == ECONNABORTED) continue;
+                std::lock_guard<std::mutex> lock(activeMutex);
+                // _quit_ shuts the socket down to stop waiting for clients
+                if (!quitting)
+                    std::cerr << "Render server: accept failed: "
+                              << strerror(errno) << std::endl;
+                break;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(activeMutex);
+                ++connections;
+            }
+            std::thread(&RenderServer::Serve, this, client).detach();
+        }
+
+        std::unique_lock<std::mutex> lock(activeMutex);
+        while (connections > 0) activeCondition.wait(lock);
+    }
+
+    void RenderServer::Serve(int client) {
+        // A client that does not send its request must not hold a
+        // connection for long
+        timeval timeout = {5, 0};
+        setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        std::string line, error;
+        SceneView view;
+        if (ReadLine(client, &line)) {
+            if (line == "quit") {
+                {
+                    std::lock_guard<std::mutex> lock(activeMutex);
+                    quitting = true;
+                }
+                shutdown(fd, SHUT_RD);
+                WriteAll(client, "ok 0\n");
+            } else if (!ParseRequest(line, &view, &error))
+                WriteAll(client, "error " + error + "\n");
+            else
+                Render(client, view);
+        }
+        close(client);
+
+        std::lock_guard<std::mutex> lock(activeMutex);
+        --connections;
+        activeCondition.notify_all();
+    }
+
+    bool RenderServer::Render(int client, const SceneView &view) {
+        {
+            std::unique_lock<std::mutex> lock(activeMutex);
+            while (active >= maxRenders) activeCondition.wait(lock);
+            ++active;
+        }
+        auto startTime = std::chrono::steady_clock::now();
+        bool ok = pbrtRenderView(*scene, view);
+        float seconds = std::chrono::duration<float>(
+                std::chrono::steady_clock::now() - startTime).count();
+        {
+            std::lock_guard<std::mutex> lock(activeMutex);
+            --active;
+            activeCondition.notify_all();
+        }
+
+        std::ostringstream reply;
+        if (ok)
+            reply << "ok " << seconds << "\n";
+        else
+            reply << "error unable to render view\n";
+        return WriteAll(client, reply.str());
+    }
+
+    bool RenderServer::ParseRequest(const std::string &line, SceneView *view,
+                                    std::string *error) {
+        std::istringstream words(line);
+        std::string word;
+        while (words >> word) {
+            size_t eq = word.find('=');
+            std::string key = word.substr(0, eq);
+            std::string value = eq == std::string::npos ? "" : word.substr(eq + 1);
+            bool ok = true;
+            if (key == "image")
+                view->imageFile = value;
+            else if (key == "camera")
+                view->camera = value;
+            else if (key == "spp") {
+                char *end;
+                view->pixelSamples = (int)strtol(value.c_str(), &end, 10);
+                ok = *end == '\0' && view->pixelSamples > 0;
+            } else if (key == "crop")
+                ok = view->hasCropWindow = ParseFloats(value, view->cropWindow, 4);
+            else if (key == "lookat")
+                ok = view->hasLookAt = ParseFloats(value, view->lookAt, 9);
+            else {
+                *error = "unknown request parameter \"" + key + "\"";
+                return false;
+            }
+            if (!ok || value.empty()) {
+                *error = "bad value for \"" + key + "\"";
+                return false;
+            }
+        }
+        // Concurrent requests would otherwise all write the scene's file
+        if (view->imageFile.empty()) {
+            *error = "no image file given";
+            return false;
+        }
+        return true;
+    }
+
+    bool RenderServer::SendRequest(const std::string &path,
+                                   const std::string &request,
+                                   std::string *reply) {
+        sockaddr_un address;
+        if (!MakeAddress(path, &address)) return false;
+        int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd < 0) {
+            std::cerr << "Unable to create socket" << std::endl;
+            return false;
+        }
+        if (connect(fd, (const sockaddr *)&address, sizeof(address)) < 0) {
+            std::cerr << "Unable to connect to \"" << path << "\": "
+                      << strerror(errno) << std::endl;
+            close(fd);
+            return false;
+        }
+        // The reply only comes once the image is written, so it is read
+        // without a timeout
+        bool ok = WriteAll(fd, request + "\n") && ReadLine(fd, reply);
+        close(fd);
+        return ok;
+    }
+}
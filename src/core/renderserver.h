@@ -0,0 +1,74 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#ifndef PBRT_WHITTED_RENDERSERVER_H
+#define PBRT_WHITTED_RENDERSERVER_H
+
+#include "main.h"
+#include "api.h"
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+
+namespace pbrt {
+
+    // Renders views of a resident scene for clients that connect to a UNIX
+    // stream socket. A client sends one request line and reads one reply
+    // line, after which the server closes the connection. A request is a
+    // list of space-separated words:
+    //
+    //     image=<file> [camera=<name>] [spp=<n>] [crop=x0,x1,y0,y1]
+    //         [lookat=ex,ey,ez,lx,ly,lz,ux,uy,uz]
+    //
+    // or _quit_, which stops the server once the renders under way are
+    // done. The reply is _ok <seconds>_ or _error <message>_. Each client
+    // is served on a thread of its own, up to _MaxConnections_ at a time;
+    // further clients wait to be accepted. Up to _maxRenders_ requests are
+    // rendered concurrently and share the pool, and the others wait for one
+    // of them to finish. Only the user running the server may connect to
+    // the socket.
+    class RenderServer {
+    public:
+        static std::unique_ptr<RenderServer> Create(
+                const std::string &path,
+                std::shared_ptr<const ResidentScene> scene, int maxRenders = 2);
+        ~RenderServer();
+
+        // Serves requests until a client asks the server to quit
+        void Run();
+
+        // Parses a request line; returns _false_ with a message in _error_
+        // if it is malformed
+        static bool ParseRequest(const std::string &line, SceneView *view,
+                                 std::string *error);
+        // Sends _request_ to the server at _path_ and waits for its reply
+        static bool SendRequest(const std::string &path,
+                                const std::string &request, std::string *reply);
+
+    private:
+        RenderServer(int fd, const std::string &path,
+                     std::shared_ptr<const ResidentScene> scene, int maxRenders)
+                : fd(fd), path(path), scene(std::move(scene)),
+                  maxRenders(std::max(1, maxRenders)) {}
+        RenderServer(const RenderServer &) = delete;
+        RenderServer &operator=(const RenderServer &) = delete;
+        void Serve(int client);
+        bool Render(int client, const SceneView &view);
+
+        static const int MaxConnections = 64;
+
+        int fd;
+        const std::string path;
+        std::shared_ptr<const ResidentScene> scene;
+        const int maxRenders;
+
+        // Clients being served, how many of their requests are being
+        // rendered, and whether a client asked to quit
+        std::mutex activeMutex;
+        std::condition_variable activeCondition;
+        int connections = 0, active = 0;
+        bool quitting = false;
+    };
+}
+#endif //PBRT_WHITTED_RENDERSERVER_H
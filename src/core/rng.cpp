@@ -0,0 +1,194 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#include "rng.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define PBRT_RNG8_HAVE_AVX2
+#endif
+
+namespace pbrt {
+
+    // Coefficients of _delta_ steps of $s \leftarrow m s + p$ folded into a
+    // single affine step
+    static void AdvanceCoefficients(uint64_t mult, uint64_t plus, uint64_t delta,
+                                    uint64_t *accMult, uint64_t *accPlus) {
+        uint64_t curMult = mult, curPlus = plus;
+        *accMult = 1u;
+        *accPlus = 0u;
+        while (delta > 0) {
+            if (delta & 1) {
+                *accMult *= curMult;
+                *accPlus = *accPlus * curMult + curPlus;
+            }
+            curPlus = (curMult + 1) * curPlus;
+            curMult *= curMult;
+            delta /= 2;
+        }
+    }
+
+    static inline uint32_t PCG32Output(uint64_t oldstate) {
+        uint32_t xorshifted = (uint32_t)(((oldstate >> 18u) ^ oldstate) >> 27u);
+        uint32_t rot = (uint32_t)(oldstate >> 59u);
+        return (xorshifted >> rot) | (xorshifted << ((~rot + 1u) & 31));
+    }
+
+    void RNG8::SetSequence(const uint64_t initseq[Width]) {
+        mult = PCG32_MULT;
+        for (int l = 0; l < Width; ++l) {
+            RNG rng(initseq[l]);
+            state[l] = rng.state;
+            inc[l] = rng.inc;
+        }
+    }
+
+    void RNG8::SetInterleavedSequence(uint64_t initseq) {
+        RNG rng(initseq);
+        uint64_t stepInc;
+        AdvanceCoefficients(PCG32_MULT, rng.inc, Width, &mult, &stepInc);
+        for (int l = 0; l < Width; ++l) {
+            state[l] = rng.state;
+            inc[l] = stepInc;
+            rng.UniformUInt32();
+        }
+    }
+
+    void RNG8::Advance(int64_t delta) {
+        // Interleaved lanes share their increment, so the coefficients
+        // usually only need computing once
+        uint64_t accMult, accPlus;
+        for (int l = 0; l < Width; ++l) {
+            if (l == 0 || inc[l] != inc[l - 1])
+                AdvanceCoefficients(mult, inc[l], (uint64_t)delta, &accMult, &accPlus);
+            state[l] = accMult * state[l] + accPlus;
+        }
+    }
+
+    static void UniformUInt32Scalar(uint64_t *state, const uint64_t *inc,
+                                    uint64_t mult, uint32_t *out, size_t nSteps) {
+        for (size_t k = 0; k < nSteps; ++k)
+            for (int l = 0; l < RNG8::Width; ++l) {
+                uint64_t oldstate = state[l];
+                state[l] = oldstate * mult + inc[l];
+                out[RNG8::Width * k + l] = PCG32Output(oldstate);
+            }
+    }
+
+#ifdef PBRT_RNG8_HAVE_AVX2
+    // Low 64 bits of the lane-wise product; AVX2 only has 32x32 bit
+    // multiplies, so combine three of them
+    __attribute__((target("avx2")))
+    static inline __m256i Mul64(__m256i a, __m256i b) {
+        __m256i aHi = _mm256_srli_epi64(a, 32), bHi = _mm256_srli_epi64(b, 32);
+        __m256i lo = _mm256_mul_epu32(a, b);
+        __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(aHi, b),
+                                         _mm256_mul_epu32(a, bHi));
+        return _mm256_add_epi64(lo, _mm256_slli_epi64(cross, 32));
+    }
+
+    // PCG32's output permutation of four states, leaving the results in the
+    // low halves of the 64-bit lanes
+    __attribute__((target("avx2")))
+    static inline __m256i Output4(__m256i s) {
+        __m256i xorshifted = _mm256_and_si256(
+                _mm256_srli_epi64(_mm256_xor_si256(_mm256_srli_epi64(s, 18), s), 27),
+                _mm256_set1_epi64x(0xffffffff));
+        __m256i rot = _mm256_srli_epi64(s, 59);
+        __m256i rotLeft = _mm256_and_si256(
+                _mm256_sub_epi64(_mm256_setzero_si256(), rot), _mm256_set1_epi64x(31));
+        return _mm256_or_si256(_mm256_srlv_epi64(xorshifted, rot),
+                               _mm256_sllv_epi64(xorshifted, rotLeft));
+    }
+
+    __attribute__((target("avx2")))
+    static void UniformUInt32AVX2(uint64_t *state, const uint64_t *inc,
+                                  uint64_t mult, uint32_t *out, size_t nSteps) {
+        __m256i s0 = _mm256_loadu_si256((const __m256i *)state);
+        __m256i s1 = _mm256_loadu_si256((const __m256i *)(state + 4));
+        const __m256i inc0 = _mm256_loadu_si256((const __m256i *)inc);
+        const __m256i inc1 = _mm256_loadu_si256((const __m256i *)(inc + 4));
+        const __m256i m = _mm256_set1_epi64x((long long)mult);
+        // Gathers the low 32 bits of the eight 64-bit lanes in lane order
+        const __m256i pack = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+        for (size_t k = 0; k < nSteps; ++k) {
+            __m256i o0 = _mm256_permutevar8x32_epi32(Output4(s0), pack);
+            __m256i o1 = _mm256_permutevar8x32_epi32(Output4(s1), pack);
+            _mm256_storeu_si256((__m256i *)(out + RNG8::Width * k),
+                                _mm256_permute2x128_si256(o0, o1, 0x20));
+            s0 = _mm256_add_epi64(Mul64(s0, m), inc0);
+            s1 = _mm256_add_epi64(Mul64(s1, m), inc1);
+        }
+        _mm256_storeu_si256((__m256i *)state, s0);
+        _mm256_storeu_si256((__m256i *)(state + 4), s1);
+    }
+
+    // Same values as _RNG::UniformFloat()_: both 16-bit halves convert
+    // exactly, so their sum is the only rounding step
+    __attribute__((target("avx2")))
+    static void ToUniformFloatAVX2(const uint32_t *bits, float *out, size_t n) {
+        const __m256i lowMask = _mm256_set1_epi32(0xffff);
+        const __m256 scale = _mm256_set1_ps(0x1p-32f);
+        const __m256 maxValue = _mm256_set1_ps(OneMinusEpsilon);
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m256i v = _mm256_loadu_si256((const __m256i *)(bits + i));
+            __m256 hi = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(v, 16)),
+                                      _mm256_set1_ps(65536.f));
+            __m256 lo = _mm256_cvtepi32_ps(_mm256_and_si256(v, lowMask));
+            __m256 f = _mm256_mul_ps(_mm256_add_ps(hi, lo), scale);
+            _mm256_storeu_ps(out + i, _mm256_min_ps(f, maxValue));
+        }
+        for (; i < n; ++i)
+            out[i] = std::min(OneMinusEpsilon, float(bits[i] * 0x1p-32f));
+    }
+
+    static bool HaveAVX2() {
+        static const bool avx2 = __builtin_cpu_supports("avx2");
+        return avx2;
+    }
+#endif
+
+    static void UniformUInt32Steps(uint64_t *state, const uint64_t *inc,
+                                   uint64_t mult, uint32_t *out, size_t nSteps) {
+#ifdef PBRT_RNG8_HAVE_AVX2
+        if (HaveAVX2()) {
+            UniformUInt32AVX2(state, inc, mult, out, nSteps);
+            return;
+        }
+#endif
+        UniformUInt32Scalar(state, inc, mult, out, nSteps);
+    }
+
+    void RNG8::UniformUInt32(uint32_t out[Width]) {
+        UniformUInt32Steps(state, inc, mult, out, 1);
+    }
+
+    void RNG8::UniformUInt32(uint32_t *out, size_t n) {
+        size_t nFull = n / Width;
+        UniformUInt32Steps(state, inc, mult, out, nFull);
+        if (n % Width) {
+            uint32_t last[Width];
+            UniformUInt32Steps(state, inc, mult, last, 1);
+            for (size_t i = 0; i < n % Width; ++i) out[Width * nFull + i] = last[i];
+        }
+    }
+
+    void RNG8::UniformFloat(float *out, size_t n) {
+        uint32_t bits[32 * Width];
+        while (n > 0) {
+            // Chunks are whole groups, so only the last one can be partial
+            size_t count = std::min(n, sizeof(bits) / sizeof(bits[0]));
+            UniformUInt32(bits, count);
+#ifdef PBRT_RNG8_HAVE_AVX2
+            if (HaveAVX2())
+                ToUniformFloatAVX2(bits, out, count);
+            else
+#endif
+                for (size_t i = 0; i < count; ++i)
+                    out[i] = std::min(OneMinusEpsilon, float(bits[i] * 0x1p-32f));
+            out += count;
+            n -= count;
+        }
+    }
+}
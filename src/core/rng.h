@@ -71,6 +71,39 @@ namespace pbrt{
     private:
         // RNG Private Data
         uint64_t state, inc;
+        friend class RNG8;
+    };
+
+    // Eight PCG32 generators stepped together, with an AVX2 path chosen at
+    // run time. Lanes either run eight independent streams, each producing
+    // exactly what an _RNG_ with the same sequence index would, or together
+    // produce a single stream's values in order (lane _l_ takes every
+    // eighth value starting at the _l_th).
+    class RNG8 {
+    public:
+        static constexpr int Width = 8;
+
+        RNG8() { SetInterleavedSequence(0); }
+        // Lane _l_ behaves like _RNG(initseq[l])_
+        void SetSequence(const uint64_t initseq[Width]);
+        // The lanes produce the values of _RNG(initseq)_ in order
+        void SetInterleavedSequence(uint64_t initseq);
+        // Skips _delta_ values in each lane
+        void Advance(int64_t delta);
+
+        // One value per lane
+        void UniformUInt32(uint32_t out[Width]);
+        // _n_ values in lane order: _out[Width * k + l]_ is lane _l_'s _k_th
+        // value. A final partial group still steps every lane.
+        void UniformUInt32(uint32_t *out, size_t n);
+        void UniformFloat(float *out, size_t n);
+
+    private:
+        // $\textit{state} \leftarrow \textit{mult} \cdot \textit{state} +
+        // \textit{inc}$ for every lane; _mult_ is shared
+        uint64_t state[Width];
+        uint64_t inc[Width];
+        uint64_t mult;
     };
 
     // RNG Inline Method Definitions
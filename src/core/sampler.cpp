@@ -5,27 +5,211 @@
 #include "sampler.h"
 #include "sampling.h"
 #include "camera.h"
+#include "filter.h"
+#include <atomic>
 
 
 namespace pbrt{
     Sampler::~Sampler() {}
 
+    void ReportRandomDimensions(int maxDimension) {
+        static std::atomic<bool> reported{false};
+        if (reported.exchange(true)) return;
+        std::cerr << "Sampler uses more than its " << maxDimension
+                  << " low-discrepancy dimensions; the remaining ones are "
+                     "random." << std::endl;
+    }
+
     Sampler::Sampler(int64_t samplesPerPixel) : samplesPerPixel(samplesPerPixel){}
 
-    CameraSample Sampler::GetCameraSample(const Point2i &pRaster) {
+    CameraSample Sampler::GetCameraSample(const Point2i &pRaster,
+                                          const FilterSampler *filterSampler) {
         CameraSample cs;
-        cs.pFilm = (Point2f)pRaster + Get2D();
+        if (filterSampler) {
+            FilterSample fs = filterSampler->Sample(Get2D());
+            cs.pFilm = Point2f(pRaster.x + 0.5f + fs.p.x, pRaster.y + 0.5f + fs.p.y);
+            cs.filterWeight = fs.weight;
+        } else
+            cs.pFilm = (Point2f)pRaster + Get2D();
         return cs;
     }
 
     void Sampler::StartPixel(const Point2i &p) {
         currentPixel = p;
         currentPixelSampleIndex = 0;
-
+        array1DOffset = array2DOffset = 0;
     }
 
     bool Sampler::StartNextSample() {
+        array1DOffset = array2DOffset = 0;
         return ++currentPixelSampleIndex < samplesPerPixel;
     }
 
+    bool Sampler::SetSampleNumber(int64_t sampleNum) {
+        array1DOffset = array2DOffset = 0;
+        currentPixelSampleIndex = sampleNum;
+        return currentPixelSampleIndex < samplesPerPixel;
+    }
+
+    static uint64_t PixelStream(const Point2i &p, int seed) {
+        return MixBits(((uint64_t)(uint32_t)p.x << 32 | (uint32_t)p.y) ^
+                       MixBits((uint64_t)seed));
+    }
+
+    void Sampler::SeekRNG(RNG &rng, int64_t block) const {
+        rng.SetSequence(PixelStream(currentPixel, seed));
+        rng.Advance(block * RandomValuesPerSample);
+    }
+
+    void Sampler::SeekRNG(RNG8 &rng, int64_t block) const {
+        rng.SetInterleavedSequence(PixelStream(currentPixel, seed));
+        rng.Advance(block * (RandomValuesPerSample / RNG8::Width));
+    }
+
+    void Sampler::Request1DArray(int n) {
+        assert(RoundCount(n) == n);
+        samples1DArraySizes.push_back(n);
+        array1DStarts.push_back(sampleArray1D.size());
+        sampleArray1D.resize(sampleArray1D.size() + n * samplesPerPixel);
+    }
+
+    void Sampler::Request2DArray(int n) {
+        assert(RoundCount(n) == n);
+        samples2DArraySizes.push_back(n);
+        array2DStarts.push_back(sampleArray2D.size());
+        sampleArray2D.resize(sampleArray2D.size() + n * samplesPerPixel);
+    }
+
+    const float *Sampler::Get1DArray(int n) {
+        if (array1DOffset == samples1DArraySizes.size()) return nullptr;
+        assert(samples1DArraySizes[array1DOffset] == n);
+        assert(currentPixelSampleIndex < samplesPerPixel);
+        return &sampleArray1D[array1DStarts[array1DOffset++] +
+                              currentPixelSampleIndex * n];
+    }
+
+    const Point2f *Sampler::Get2DArray(int n) {
+        if (array2DOffset == samples2DArraySizes.size()) return nullptr;
+        assert(samples2DArraySizes[array2DOffset] == n);
+        assert(currentPixelSampleIndex < samplesPerPixel);
+        return &sampleArray2D[array2DStarts[array2DOffset++] +
+                              currentPixelSampleIndex * n];
+    }
+
+    PixelSampler::PixelSampler(int64_t samplesPerPixel, int nSampledDimensions)
+            : Sampler(samplesPerPixel) {
+        for (int i = 0; i < nSampledDimensions; ++i) {
+            samples1D.push_back(std::vector<float>(samplesPerPixel));
+            samples2D.push_back(std::vector<Point2f>(samplesPerPixel));
+        }
+    }
+
+    void PixelSampler::StartPixel(const Point2i &p) {
+        current1DDimension = current2DDimension = 0;
+        Sampler::StartPixel(p);
+        SeekRNG(rng, samplesPerPixel);
+    }
+
+    bool PixelSampler::StartNextSample() {
+        current1DDimension = current2DDimension = 0;
+        return Sampler::StartNextSample();
+    }
+
+    bool PixelSampler::SetSampleNumber(int64_t sampleNum) {
+        current1DDimension = current2DDimension = 0;
+        bool more = Sampler::SetSampleNumber(sampleNum);
+        SeekRNG(rng, currentPixelSampleIndex);
+        return more;
+    }
+
+    float PixelSampler::Get1D() {
+        if (current1DDimension < (int)samples1D.size())
+            return samples1D[current1DDimension++][currentPixelSampleIndex];
+        else
+            return rng.UniformFloat();
+    }
+
+    Point2f PixelSampler::Get2D() {
+        if (current2DDimension < (int)samples2D.size())
+            return samples2D[current2DDimension++][currentPixelSampleIndex];
+        else
+            return Point2f(rng.UniformFloat(), rng.UniformFloat());
+    }
+
+    void GlobalSampler::StartPixel(const Point2i &p) {
+        Sampler::StartPixel(p);
+        dimension = 0;
+        intervalSampleIndex = GetIndexForSample(0);
+        SeekRNG(rng, samplesPerPixel);
+        // Compute _arrayEndDim_ for dimensions used for array samples
+        arrayEndDim = arrayStartDim + samples1DArraySizes.size() +
+                      2 * samples2DArraySizes.size();
+
+        // Element _j_ of an array over the pixel's samples is the pixel's
+        // _j_th point of the sequence, so arrays stay stratified
+        auto sampleDimension = [&](int64_t index, int d) {
+            if (d < MaxDimension()) return SampleDimension(index, d);
+            ReportRandomDimensions(MaxDimension());
+            return rng.UniformFloat();
+        };
+        for (size_t i = 0; i < samples1DArraySizes.size(); ++i) {
+            int64_t nSamples = samples1DArraySizes[i] * samplesPerPixel;
+            float *array = &sampleArray1D[array1DStarts[i]];
+            for (int64_t j = 0; j < nSamples; ++j) {
+                int64_t index = GetIndexForSample(j);
+                array[j] = sampleDimension(index, arrayStartDim + i);
+            }
+        }
+
+        int dim = arrayStartDim + samples1DArraySizes.size();
+        for (size_t i = 0; i < samples2DArraySizes.size(); ++i) {
+            int64_t nSamples = samples2DArraySizes[i] * samplesPerPixel;
+            Point2f *array = &sampleArray2D[array2DStarts[i]];
+            for (int64_t j = 0; j < nSamples; ++j) {
+                int64_t idx = GetIndexForSample(j);
+                array[j].x = sampleDimension(idx, dim);
+                array[j].y = sampleDimension(idx, dim + 1);
+            }
+            dim += 2;
+        }
+        SeekRNG(rng, 0);
+    }
+
+    bool GlobalSampler::StartNextSample() {
+        dimension = 0;
+        intervalSampleIndex = GetIndexForSample(currentPixelSampleIndex + 1);
+        return Sampler::StartNextSample();
+    }
+
+    bool GlobalSampler::SetSampleNumber(int64_t sampleNum) {
+        dimension = 0;
+        intervalSampleIndex = GetIndexForSample(sampleNum);
+        bool more = Sampler::SetSampleNumber(sampleNum);
+        SeekRNG(rng, currentPixelSampleIndex);
+        return more;
+    }
+
+    float GlobalSampler::Get1D() {
+        if (dimension >= arrayStartDim && dimension < arrayEndDim)
+            dimension = arrayEndDim;
+        if (dimension >= MaxDimension()) {
+            ReportRandomDimensions(MaxDimension());
+            return rng.UniformFloat();
+        }
+        return SampleDimension(intervalSampleIndex, dimension++);
+    }
+
+    Point2f GlobalSampler::Get2D() {
+        if (dimension + 1 >= arrayStartDim && dimension < arrayEndDim)
+            dimension = arrayEndDim;
+        if (dimension + 1 >= MaxDimension()) {
+            ReportRandomDimensions(MaxDimension());
+            return Point2f(rng.UniformFloat(), rng.UniformFloat());
+        }
+        Point2f p(SampleDimension(intervalSampleIndex, dimension),
+                  SampleDimension(intervalSampleIndex, dimension + 1));
+        dimension += 2;
+        return p;
+    }
+
 }
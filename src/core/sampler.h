@@ -18,17 +18,109 @@ namespace pbrt {
         // return sample value for the next or the two next dimensions
         virtual float Get1D() = 0;
         virtual Point2f Get2D() = 0;
-        CameraSample GetCameraSample(const Point2i &pRaster);
+        // With a _filterSampler_, _pFilm_ is offset from the pixel center by
+        // a sample of the filter instead of being uniform over the pixel
+        CameraSample GetCameraSample(const Point2i &pRaster,
+                                     const FilterSampler *filterSampler = nullptr);
         virtual std::unique_ptr<Sampler> Clone(int seed) = 0;
         virtual bool StartNextSample();
+        virtual bool SetSampleNumber(int64_t sampleNum);
+        int64_t CurrentSampleNumber() const { return currentPixelSampleIndex; }
+
+        // Integrators request arrays of _n_ values per sample before
+        // rendering starts, and fetch them for each sample in the same order
+        void Request1DArray(int n);
+        void Request2DArray(int n);
+        // Preferred array size closest to _n_ for this sampler
+        virtual int RoundCount(int n) const { return n; }
+        const float *Get1DArray(int n);
+        const Point2f *Get2DArray(int n);
 
         const int64_t samplesPerPixel;
     protected:
         Point2i currentPixel;
         int64_t currentPixelSampleIndex;
+        // All requested arrays of a pixel, filled by _StartPixel()_. Each
+        // array is stored sample by sample: array _i_ starts at
+        // _array1DStarts[i]_ and holds _samplesPerPixel_ runs of
+        // _samples1DArraySizes[i]_ values.
+        std::vector<int> samples1DArraySizes, samples2DArraySizes;
+        std::vector<size_t> array1DStarts, array2DStarts;
+        std::vector<float> sampleArray1D;
+        std::vector<Point2f> sampleArray2D;
+
+        // Random numbers depend only on the pixel, the samples taken in it
+        // and _seed_, never on the order in which pixels are rendered. Each
+        // pixel has its own stream, which _StartPixel()_ seeks to once: its
+        // samples draw from it one after another from block 0 on, and
+        // values that set up the whole pixel come from block
+        // _samplesPerPixel_. _SetSampleNumber()_ jumps to the block of its
+        // sample, so that a pass starting part way through the pixel does
+        // not repeat the values of earlier ones.
+        static constexpr int64_t RandomValuesPerSample = 65536;
+        void SeekRNG(RNG &rng, int64_t block) const;
+        void SeekRNG(RNG8 &rng, int64_t block) const;
+        int seed = 0;
 
     private:
+        size_t array1DOffset, array2DOffset;
+    };
+
+    // Generates all of a pixel's samples for the first _nSampledDimensions_
+    // dimensions in _StartPixel()_; later dimensions are uniform random.
+    // _PixelSampler::StartPixel()_ leaves _rng_ at the pixel's setup block;
+    // subclasses generate their samples from it and then call
+    // _SeekRNG(rng, 0)_.
+    class PixelSampler : public Sampler {
+    public:
+        PixelSampler(int64_t samplesPerPixel, int nSampledDimensions);
+        void StartPixel(const Point2i &p);
+        bool StartNextSample();
+        bool SetSampleNumber(int64_t);
+        float Get1D();
+        Point2f Get2D();
 
+    protected:
+        std::vector<std::vector<float>> samples1D;
+        std::vector<std::vector<Point2f>> samples2D;
+        int current1DDimension = 0, current2DDimension = 0;
+        RNG rng;
     };
+
+    // Samples from a single sequence that covers the whole image;
+    // subclasses map a pixel's samples to their indices in the sequence.
+    class GlobalSampler : public Sampler {
+    public:
+        GlobalSampler(int64_t samplesPerPixel) : Sampler(samplesPerPixel) {}
+        void StartPixel(const Point2i &p);
+        bool StartNextSample();
+        bool SetSampleNumber(int64_t sampleNum);
+        float Get1D();
+        Point2f Get2D();
+
+        // Index of the pixel's _sampleNum_th sample in the sequence
+        virtual int64_t GetIndexForSample(int64_t sampleNum) const = 0;
+        // For dimensions 0 and 1 this is the offset within the current pixel
+        virtual float SampleDimension(int64_t index, int dimension) const = 0;
+        // Number of dimensions the sequence defines. Dimensions from this one
+        // on are independent random values from _rng_, which converge more
+        // slowly; the first time that happens is reported on std::cerr.
+        virtual int MaxDimension() const = 0;
+
+    protected:
+        RNG rng;
+
+    private:
+        int dimension;
+        int64_t intervalSampleIndex;
+        // Dimensions taken by sample arrays; they are skipped by _Get1D()_
+        // and _Get2D()_
+        static const int arrayStartDim = 5;
+        int arrayEndDim;
+    };
+
+    // Reports, once per run, that a sampler ran out of its _maxDimension_
+    // low-discrepancy dimensions and now returns random values
+    void ReportRandomDimensions(int maxDimension);
 }
 #endif //PBRT_WHITTED_SAMPLER_H
@@ -26,4 +26,16 @@ namespace pbrt{
         }
         return r * Point2f(std::cos(theta), std::sin(theta));
     }
-}
\ No newline at end of file
+
+    Distribution2D::Distribution2D(const float *func, int nu, int nv) {
+        for (int v = 0; v < nv; ++v) {
+            // Compute conditional sampling distribution for $\tilde{v}$
+            pConditionalV.emplace_back(new Distribution1D(&func[v * nu], nu));
+        }
+        // Compute marginal sampling distribution $p[\tilde{v}]$
+        std::vector<float> marginalFunc;
+        for (int v = 0; v < nv; ++v)
+            marginalFunc.push_back(pConditionalV[v]->funcInt);
+        pMarginal.reset(new Distribution1D(&marginalFunc[0], nv));
+    }
+}
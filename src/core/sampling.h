@@ -9,6 +9,7 @@
 #include "geometry.h"
 #include "rng.h"
 #include <algorithm>
+#include <vector>
 
 namespace pbrt{
     Point2f ConcentricSampleDisk(const Point2f &u);
@@ -19,5 +20,94 @@ namespace pbrt{
         return Vector3f(d.x, d.y, z);
     }
 
+    // Shuffles _count_ groups of _nDimensions_ consecutive values
+    template <typename T>
+    void Shuffle(T *samp, int count, int nDimensions, RNG &rng) {
+        for (int i = 0; i < count; ++i) {
+            int other = i + rng.UniformUInt32(count - i);
+            for (int j = 0; j < nDimensions; ++j)
+                std::swap(samp[nDimensions * i + j], samp[nDimensions * other + j]);
+        }
+    }
+
+    // Running mean and variance of a sequence of values (Welford's method)
+    class VarianceEstimator {
+    public:
+        void Add(float x) {
+            ++n;
+            float delta = x - mean;
+            mean += delta / n;
+            m2 += delta * (x - mean);
+        }
+        int64_t Count() const { return n; }
+        float Mean() const { return mean; }
+        float Variance() const { return (n > 1) ? m2 / (n - 1) : 0; }
+        // Standard error of the mean relative to the mean, with means below
+        // _minMean_ clamped so that nearly black values do not blow it up
+        float RelativeError(float minMean) const {
+            if (n == 0) return Infinity;
+            return std::sqrt(Variance() / n) / std::max(std::abs(mean), minMean);
+        }
+
+    private:
+        int64_t n = 0;
+        float mean = 0, m2 = 0;
+    };
+
+    // Piecewise-constant 1D distribution over $[0,1]$ with _n_ equal segments
+    struct Distribution1D {
+        Distribution1D(const float *f, int n) : func(f, f + n), cdf(n + 1) {
+            // Compute integral of step function at $x_i$
+            cdf[0] = 0;
+            for (int i = 1; i < n + 1; ++i) cdf[i] = cdf[i - 1] + func[i - 1] / n;
+
+            // Transform step function integral into CDF
+            funcInt = cdf[n];
+            if (funcInt == 0) {
+                for (int i = 1; i < n + 1; ++i) cdf[i] = float(i) / float(n);
+            } else {
+                for (int i = 1; i < n + 1; ++i) cdf[i] /= funcInt;
+            }
+        }
+        int Count() const { return (int)func.size(); }
+        float SampleContinuous(float u, float *pdf, int *off = nullptr) const {
+            // Find surrounding CDF segments and _offset_
+            int offset = FindInterval((int)cdf.size(),
+                                      [&](int index) { return cdf[index] <= u; });
+            if (off) *off = offset;
+            // Compute offset along CDF segment
+            float du = u - cdf[offset];
+            if ((cdf[offset + 1] - cdf[offset]) > 0)
+                du /= (cdf[offset + 1] - cdf[offset]);
+
+            // Compute PDF for sampled offset
+            if (pdf) *pdf = (funcInt > 0) ? func[offset] / funcInt : 0;
+            return (offset + du) / Count();
+        }
+
+        std::vector<float> func, cdf;
+        float funcInt;
+    };
+
+    // Piecewise-constant 2D distribution over $[0,1]^2$; _func_ holds _nu_
+    // values per row and _nv_ rows
+    class Distribution2D {
+    public:
+        Distribution2D(const float *func, int nu, int nv);
+        // Returns a point in $[0,1]^2$ and its density in _*pdf_
+        Point2f SampleContinuous(const Point2f &u, float *pdf) const {
+            float pdfs[2];
+            int v;
+            float d1 = pMarginal->SampleContinuous(u.y, &pdfs[1], &v);
+            float d0 = pConditionalV[v]->SampleContinuous(u.x, &pdfs[0]);
+            *pdf = pdfs[0] * pdfs[1];
+            return Point2f(d0, d1);
+        }
+
+    private:
+        std::vector<std::unique_ptr<Distribution1D>> pConditionalV;
+        std::unique_ptr<Distribution1D> pMarginal;
+    };
+
 }
 #endif //PBRT_WHITTED_SAMPLING_H
@@ -0,0 +1,192 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+// Generated table; do not edit.
+//
+// Generator matrices of the first _NumSobolDimensions_ dimensions of the
+// Sobol sequence, _SobolMatrixSize_ columns each, column _k_ holding the
+// top 32 bits of $m_k / 2^k$. Dimension 0 is the van der Corput sequence;
+// its columns from the 33rd on are $2^{-33}$ and smaller, below the 32 bits
+// kept, and so are zero. Dimensions 1 to 20 follow from the primitive
+// polynomials and initial direction numbers of the first 20 rows of Joe
+// and Kuo's "new-joe-kuo-6.21201" by the usual recurrence
+// $m_k = 2 a_1 m_{k-1} \oplus \ldots \oplus 2^{s-1} a_{s-1} m_{k-s+1}
+// \oplus 2^s m_{k-s} \oplus m_{k-s}$. Extending the table takes more rows of
+// that file.
+
+#include "lowdiscrepancy.h"
+
+namespace pbrt {
+
+    const uint32_t SobolMatrices32[NumSobolDimensions * SobolMatrixSize] = {
+            // Dimension 0
+            0x80000000, 0x40000000, 0x20000000, 0x10000000, 0x08000000, 0x04000000, 0x02000000, 0x01000000,
+            0x00800000, 0x00400000, 0x00200000, 0x00100000, 0x00080000, 0x00040000, 0x00020000, 0x00010000,
+            0x00008000, 0x00004000, 0x00002000, 0x00001000, 0x00000800, 0x00000400, 0x00000200, 0x00000100,
+            0x00000080, 0x00000040, 0x00000020, 0x00000010, 0x00000008, 0x00000004, 0x00000002, 0x00000001,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000,
+            // Dimension 1
+            0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0x88000000, 0xcc000000, 0xaa000000, 0xff000000,
+            0x80800000, 0xc0c00000, 0xa0a00000, 0xf0f00000, 0x88880000, 0xcccc0000, 0xaaaa0000, 0xffff0000,
+            0x80008000, 0xc000c000, 0xa000a000, 0xf000f000, 0x88008800, 0xcc00cc00, 0xaa00aa00, 0xff00ff00,
+            0x80808080, 0xc0c0c0c0, 0xa0a0a0a0, 0xf0f0f0f0, 0x88888888, 0xcccccccc, 0xaaaaaaaa, 0xffffffff,
+            0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0x88000000, 0xcc000000, 0xaa000000, 0xff000000,
+            0x80800000, 0xc0c00000, 0xa0a00000, 0xf0f00000, 0x88880000, 0xcccc0000, 0xaaaa0000, 0xffff0000,
+            0x80008000, 0xc000c000, 0xa000a000, 0xf000f000,
+            // Dimension 2
+            0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0xe8000000, 0x5c000000, 0x8e000000, 0xc5000000,
+            0x68800000, 0x9cc00000, 0xee600000, 0x55900000, 0x80680000, 0xc09c0000, 0x60ee0000, 0x90550000,
+            0xe8808000, 0x5cc0c000, 0x8e606000, 0xc5909000, 0x6868e800, 0x9c9c5c00, 0xeeee8e00, 0x5555c500,
+            0x8000e880, 0xc0005cc0, 0x60008e60, 0x9000c590, 0xe8006868, 0x5c009c9c, 0x8e00eeee, 0xc5005555,
+            0x68808000, 0x9cc0c000, 0xee606000, 0x55909000, 0x8068e800, 0xc09c5c00, 0x60ee8e00, 0x9055c500,
+            0xe880e880, 0x5cc05cc0, 0x8e608e60, 0xc590c590, 0x68686868, 0x9c9c9c9c, 0xeeeeeeee, 0x55555555,
+            0x80000000, 0xc0000000, 0x60000000, 0x90000000,
+            // Dimension 3
+            0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0xf8000000, 0x74000000, 0xa2000000, 0x93000000,
+            0xd8800000, 0x25400000, 0x59e00000, 0xe6d00000, 0x78080000, 0xb40c0000, 0x82020000, 0xc3050000,
+            0x208f8000, 0x51474000, 0xfbea2000, 0x75d93000, 0xa0858800, 0x914e5400, 0xdbe79e00, 0x25db6d00,
+            0x58800080, 0xe54000c0, 0x79e00020, 0xb6d00050, 0x800800f8, 0xc00c0074, 0x200200a2, 0x50050093,
+            0xf80f80d8, 0x74074025, 0xa20a2059, 0x930930e6, 0xd88d8878, 0x254254b4, 0x59e59e82, 0xe6de6dc3,
+            0x780f80a0, 0xb4074091, 0x820a20db, 0xc3093025, 0x208d8858, 0x514254e5, 0xfbe59e79, 0x75de6db6,
+            0xa08f8000, 0x91474000, 0xdbea2000, 0x25d93000,
+            // Dimension 4
+            0x80000000, 0x40000000, 0x20000000, 0xb0000000, 0xf8000000, 0xdc000000, 0x7a000000, 0x9d000000,
+            0x5a800000, 0x2fc00000, 0xa1600000, 0xf0b00000, 0xda880000, 0x6fc40000, 0x81620000, 0x40bb0000,
+            0x22878000, 0xb3c9c000, 0xfb65a000, 0xddb2d000, 0x78022800, 0x9c0b3c00, 0x5a0fb600, 0x2d0ddb00,
+            0xa2878080, 0xf3c9c040, 0xdb65a020, 0x6db2d0b0, 0x800228f8, 0x400b3cdc, 0x200fb67a, 0xb00ddb9d,
+            0xf80780da, 0xdc09c06f, 0x7a05a081, 0x9d02d040, 0x5a8a2822, 0x2fcf3cb3, 0xa16db6fb, 0xf0b6dbdd,
+            0xda8000f8, 0x6fc000dc, 0x8160007a, 0x40b0009d, 0x2288005a, 0xb3c4002f, 0xfb6200a1, 0xddbb00f0,
+            0x780780da, 0x9c09c06f, 0x5a05a081, 0x2d02d040,
+            // Dimension 5
+            0x80000000, 0x40000000, 0x60000000, 0x30000000, 0xc8000000, 0x24000000, 0x56000000, 0xfb000000,
+            0xe0800000, 0x70400000, 0xa8600000, 0x14300000, 0x9ec80000, 0xdf240000, 0xb6d60000, 0x8bbb0000,
+            0x48008000, 0x64004000, 0x36006000, 0xcb003000, 0x2880c800, 0x54402400, 0xfe605600, 0xef30fb00,
+            0x7e48e080, 0xaf647040, 0x1eb6a860, 0x9f8b1430, 0xd6c81ec8, 0xbb249f24, 0x80d6d6d6, 0x40bbbbbb,
+            0x60800000, 0x30400000, 0xc8600000, 0x24300000, 0x56c80000, 0xfb240000, 0xe0d60000, 0x70bb0000,
+            0xa8808000, 0x14404000, 0x9e606000, 0xdf303000, 0xb648c800, 0x8b642400, 0x48b65600, 0x648bfb00,
+            0x36486080, 0xcb643040, 0x28b6c860, 0x548b2430,
+            // Dimension 6
+            0x80000000, 0xc0000000, 0xa0000000, 0xd0000000, 0x58000000, 0x94000000, 0x3e000000, 0xe3000000,
+            0xbe800000, 0x23c00000, 0x1e200000, 0xf3100000, 0x46780000, 0x67840000, 0x78460000, 0x84670000,
+            0xc6788000, 0xa784c000, 0xd846a000, 0x5467d000, 0x9e78d800, 0x33845400, 0xe6469e00, 0xb7673300,
+            0x20f86680, 0x104477c0, 0xf8668020, 0x4477c010, 0x668020f8, 0x77c01044, 0x8020f866, 0xc0104477,
+            0xa0f86680, 0xd04477c0, 0x58668020, 0x9477c010, 0x3e8020f8, 0xe3c01044, 0xbe20f866, 0x23104477,
+            0x1e786680, 0xf38477c0, 0x46468020, 0x6767c010, 0x78f820f8, 0x84441044, 0xc666f866, 0xa7774477,
+            0xd800e680, 0x5400b7c0, 0x9e002020, 0x33001010,
+            // Dimension 7
+            0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0x88000000, 0x24000000, 0x12000000, 0x2d000000,
+            0x76800000, 0x9e400000, 0x08200000, 0x64100000, 0xb2280000, 0x7d140000, 0xfea20000, 0xba490000,
+            0x1a248000, 0x491b4000, 0xc4b5a000, 0xe3739000, 0xf6800800, 0xde400400, 0xa8200a00, 0x34100500,
+            0x3a280880, 0x59140240, 0xeca20120, 0x974902d0, 0x6ca48768, 0xd75b49e4, 0xcc95a082, 0x87639641,
+            0x44a80322, 0xa35403d1, 0x568205ea, 0x8e590ea4, 0x200c8922, 0x100f46d1, 0x2817ad6b, 0x743a9ce7,
+            0x9a248000, 0x091b4000, 0x64b5a000, 0xb3739000, 0x7e800800, 0xfa400400, 0xba200a00, 0x19100500,
+            0x4ca80880, 0xc7540240, 0xe4820120, 0xf35902d0,
+            // Dimension 8
+            0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0x28000000, 0xd4000000, 0x6a000000, 0x71000000,
+            0x38800000, 0x58400000, 0xea200000, 0x31100000, 0x98a80000, 0x08540000, 0xc22a0000, 0xe5250000,
+            0xf2b28000, 0x79484000, 0xfaa42000, 0xbd731000, 0x18a80800, 0x48540400, 0x622a0a00, 0xb5250500,
+            0xdab28280, 0xad484d40, 0x90a426a0, 0xcc731710, 0x20280b88, 0x10140184, 0x880a04a2, 0x84350611,
+            0x421a8b0a, 0xa51c4dc5, 0x528e2a82, 0x29561942, 0xd29a84a3, 0x695c4610, 0x72ae2b08, 0x39461dc6,
+            0x5ab28280, 0xed484d40, 0x30a426a0, 0x9c731710, 0x08280b88, 0xc4140184, 0xe20a04a2, 0xf5350611,
+            0x7a9a8b0a, 0xfd5c4dc5, 0xb8ae2a82, 0x18461942,
+            // Dimension 9
+            0x80000000, 0x40000000, 0xe0000000, 0xb0000000, 0x98000000, 0x94000000, 0x8a000000, 0x5b000000,
+            0x33800000, 0xd9c00000, 0x72200000, 0x3f100000, 0xc1b80000, 0xa6ec0000, 0x53860000, 0x29f50000,
+            0x0a3a8000, 0x1b2ac000, 0xd392e000, 0x69ff7000, 0xea380800, 0xab2c0400, 0x4ba60e00, 0xfde50b00,
+            0x60028980, 0xf006c940, 0x7834e8a0, 0x241a75b0, 0x123a8b38, 0xcf2ac99c, 0xb992e922, 0x82ff78f1,
+            0x41b80d9b, 0xe6ec072e, 0xb3860398, 0x99f50c2f, 0x923a8a1b, 0x8f2ac56e, 0x5992e2bb, 0x32ff70de,
+            0xd9b80980, 0x72ec0940, 0x398608a0, 0xc2f505b0, 0xa1ba8338, 0x56eacd9c, 0x2bb2e722, 0x0def73f1,
+            0x1800041b, 0xd4000e6e, 0x6a000b38, 0xeb00099f,
+            // Dimension 10
+            0x80000000, 0x40000000, 0xa0000000, 0x10000000, 0x08000000, 0x6c000000, 0x9e000000, 0x23000000,
+            0x57800000, 0xadc00000, 0x7fa00000, 0x91d00000, 0x49880000, 0xced40000, 0x880a0000, 0x2c0f0000,
+            0x3e0d8000, 0x3317c000, 0x5fb06000, 0xc1f8b000, 0xe18d8800, 0xb2d7c400, 0x1e106a00, 0x6328b100,
+            0xf7858880, 0xbdc3c2c0, 0x77ba63e0, 0xfdf7b330, 0xd7800df8, 0xedc0081c, 0xdfa0041a, 0x81d00a2d,
+            0x41880160, 0xa2d400f1, 0x160a069a, 0x0f0f09ed, 0x698d8200, 0x9ed7c500, 0x20106a81, 0x5028b7c2,
+            0xa8058160, 0x7c03c0f1, 0x961a669a, 0x4f27b9ed, 0xc9880a00, 0x8ed40100, 0x280a0081, 0x3c0f06c2,
+            0x360d89e0, 0x5f17c231, 0xc1b0657a, 0xe2f8badd,
+            // Dimension 11
+            0x80000000, 0x40000000, 0x20000000, 0x30000000, 0x58000000, 0xac000000, 0x96000000, 0x2b000000,
+            0xd4800000, 0x09400000, 0xe2a00000, 0x52500000, 0x4e280000, 0xc71c0000, 0x629e0000, 0x12670000,
+            0x6e138000, 0xf731c000, 0x3a98a000, 0xbe449000, 0xf83b8800, 0xdc2dc400, 0xee06a200, 0xb7239300,
+            0x1aa80d80, 0x8e5c0ec0, 0xa03e0b60, 0x703701b0, 0x783b88c8, 0x9c2dca54, 0xce06a74a, 0x87239795,
+            0x42a801aa, 0x225c08e5, 0x363e0a03, 0x5b370703, 0xacbb8783, 0x956dc9c2, 0x2ca6ace0, 0xd5739872,
+            0x0c800c2a, 0xe5400625, 0x54a00163, 0x495006b3, 0xc2a80f4b, 0x625c0396, 0x163e0baa, 0x6b370fe7,
+            0xf4bb8d80, 0x396dcec0, 0xbaa6ab60, 0xfe7391b0,
+            // Dimension 12
+            0x80000000, 0xc0000000, 0xa0000000, 0x50000000, 0xf8000000, 0x8c000000, 0xe2000000, 0x33000000,
+            0x0f800000, 0x21400000, 0x95a00000, 0x5e700000, 0xd8080000, 0x1c240000, 0xba160000, 0xef370000,
+            0x15868000, 0x9e6fc000, 0x781b6000, 0x4c349000, 0x420e8800, 0x630bcc00, 0xf7ad6a00, 0xad739500,
+            0x77800780, 0x6d4004c0, 0xd7a00420, 0x3d700630, 0x2f880f78, 0xb1640ad4, 0xcdb6077a, 0x824706d7,
+            0xc20e8d78, 0xa30bc3d6, 0x57ad62fb, 0xfd739b14, 0x8f8004d8, 0xe1400424, 0x35a00620, 0x0e700f30,
+            0x20080af8, 0x90240716, 0x581606db, 0xdc370d24, 0x1a0683a0, 0xbf2fc2f0, 0xedbb6b5a, 0x12449ce7,
+            0x9a068000, 0x7f2fc000, 0x4dbb6000, 0x42449000,
+            // Dimension 13
+            0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0x38000000, 0xc4000000, 0x42000000, 0xa3000000,
+            0xf1800000, 0xaa400000, 0xfce00000, 0x85100000, 0xe0080000, 0x500c0000, 0x58060000, 0x54090000,
+            0x7a038000, 0x670c4000, 0xb3842000, 0x094a3000, 0x0d6f1800, 0x2f5aa400, 0x1ce7ce00, 0xd5145100,
+            0xb8000080, 0x040000c0, 0x22000060, 0x33000090, 0xc9800038, 0x6e4000c4, 0xbee00042, 0x261000a3,
+            0x118800f1, 0xfa4c00aa, 0xa4e600fc, 0xd1190085, 0x9a0b80e0, 0x37004050, 0xeb822058, 0x5d433054,
+            0x776c987a, 0x4856e467, 0xaf63eeb3, 0xdc5e6109, 0xb56f188d, 0x2b5aa4ef, 0x3ee7ce7c, 0xe6145145,
+            0x71800000, 0x6a400000, 0x9ce00000, 0x15100000,
+            // Dimension 14
+            0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0xa8000000, 0x54000000, 0x9a000000, 0x9d000000,
+            0x1e800000, 0x5cc00000, 0x7d200000, 0x8d100000, 0x24880000, 0x71c40000, 0xeba20000, 0x75df0000,
+            0x6ba28000, 0x35d14000, 0x4ba3a000, 0xc5d2d000, 0xe3a16800, 0x91db8c00, 0x79aef200, 0x0cdf4100,
+            0x672a8080, 0x50154040, 0x1a01a020, 0xdd0dd0f0, 0x3e83e8a8, 0xaccacc54, 0xd52d529a, 0xd91d919d,
+            0xbe83e89e, 0xeccacc1c, 0xf52d525d, 0x291d917d, 0x1683e80c, 0xb8cacc65, 0x6f2d5251, 0xb41d9118,
+            0x0803e85d, 0xe40acc7d, 0x120d528c, 0x390d9125, 0x2c8be8f1, 0x95cecca8, 0xf9af5255, 0x4cd29199,
+            0x4729681e, 0xa01f8c5c, 0xb20cf27d, 0x8900418d,
+            // Dimension 15
+            0x80000000, 0xc0000000, 0x20000000, 0xd0000000, 0xd8000000, 0xc4000000, 0x46000000, 0x85000000,
+            0xa5800000, 0x76c00000, 0xada00000, 0x6ab00000, 0x2da80000, 0xaabc0000, 0x0daa0000, 0x7ab10000,
+            0xd5a78000, 0xbebd4000, 0x93a3e000, 0x3bb51000, 0x3629b800, 0x4d727c00, 0x9b836200, 0x27c4d700,
+            0xb629b880, 0x8d727cc0, 0xbb836220, 0xf7c4d7d0, 0x6e29b858, 0x49727c04, 0xfd836266, 0x72c4d755,
+            0xcba9b8fd, 0x3fb27c72, 0x502362cb, 0x1874d73f, 0xe601b8d0, 0x950e7cd8, 0x5d8962c6, 0x62c5d745,
+            0x33a63805, 0x2bb33c66, 0xce2a8255, 0x5970c77e, 0x058f8033, 0x66c1402b, 0x55a9e0ce, 0x7eb41059,
+            0xb3a63805, 0xebb33c66, 0xee2a8255, 0x8970c77e,
+            // Dimension 16
+            0x80000000, 0x40000000, 0x20000000, 0xf0000000, 0x38000000, 0x14000000, 0xf6000000, 0x67000000,
+            0x8f800000, 0x50400000, 0x8aa00000, 0x0ff00000, 0x12a80000, 0xabf40000, 0xfcaa0000, 0x28fb0000,
+            0xbd298000, 0x0bba4000, 0x4e06e000, 0x330c3000, 0x59861800, 0xc74d3400, 0x3d2cb200, 0x4bb2cb00,
+            0x6e061880, 0xc30d3440, 0x618cb220, 0xd342cbf0, 0xcb2e18b8, 0x2cb93454, 0xe186b2d6, 0x9349cb97,
+            0xeb2f9837, 0xdcb77404, 0xd98a525c, 0x874efb98, 0x1d280025, 0xbbb400af, 0x560a00a0, 0xd70b00b0,
+            0x97818018, 0xb44e40e4, 0x44ace0ce, 0x7cf73073, 0x6b2f9879, 0x9cb77437, 0xf98a5205, 0x774efb5f,
+            0x25280018, 0xafb400e4, 0xa00a00ce, 0xb00b0073,
+            // Dimension 17
+            0x80000000, 0xc0000000, 0x20000000, 0xf0000000, 0x68000000, 0x64000000, 0x36000000, 0x6d000000,
+            0x41800000, 0xe0400000, 0xd2e00000, 0x9bf00000, 0x0ce80000, 0x52fc0000, 0x5b6a0000, 0x2fb30000,
+            0xa00c8000, 0x30054000, 0x4807e000, 0x940f9000, 0x5e01f800, 0x090e9400, 0x778a5600, 0x8d416b00,
+            0x9369f880, 0x7bb294c0, 0xde005620, 0xc9026bf0, 0x578d78e8, 0x7d4bd4a4, 0xfb6db616, 0x1fbefb9d,
+            0xe80000a9, 0xa4000044, 0x160000c4, 0x9d000006, 0x29800025, 0x844000d6, 0xe4e000bf, 0xf6f000d9,
+            0x4d6800ed, 0xb2bc0082, 0x898a00c1, 0xb4430020, 0xace480f2, 0x62f9406b, 0x136de064, 0xbbbc9036,
+            0xfe0d786d, 0x390bd442, 0x3f8db6e1, 0x194efbd0,
+            // Dimension 18
+            0x80000000, 0x40000000, 0xa0000000, 0x50000000, 0x98000000, 0xf4000000, 0xae000000, 0xbb000000,
+            0xe7800000, 0x95c00000, 0x1c200000, 0xd0300000, 0xdba80000, 0x55f40000, 0xff820000, 0x21c10000,
+            0x12238000, 0x3b3a4000, 0xa42b6000, 0x3430f000, 0x4da69800, 0x4af3ec00, 0x2e043a00, 0xfb0a1f00,
+            0x47851880, 0xc5c9ac40, 0x842f5aa0, 0x243aef50, 0x75a38018, 0xeefa40b4, 0x180b600e, 0xb400f0eb,
+            0x0e0e987f, 0xeb07ec61, 0x7f863ab2, 0x61cb1f6b, 0xb22698bc, 0x6b33ec80, 0x3c243a43, 0xc03a1fa1,
+            0xe3ad18d1, 0xf1fdacda, 0xc98d5a55, 0x6ecbeffe, 0x5ba800a0, 0x15f40050, 0x5f820098, 0x71c100f4,
+            0x8a2380ae, 0xcf3a40bb, 0x0a2b60e7, 0x8f30f095,
+            // Dimension 19
+            0x80000000, 0xc0000000, 0xe0000000, 0xb0000000, 0xb8000000, 0x3c000000, 0xce000000, 0x41000000,
+            0x21800000, 0x51c00000, 0x09600000, 0x85700000, 0xf2780000, 0x8e9c0000, 0x60020000, 0x70030000,
+            0x58038000, 0x8c02c000, 0x7602e000, 0x7d00f000, 0xef833800, 0x10c10400, 0x28e08600, 0xd4b14700,
+            0xfb182580, 0x0bee15c0, 0x9279c9e0, 0xfe9d3a70, 0x38000008, 0xfc00000c, 0x2e00000e, 0xf100000b,
+            0x9980000b, 0x6dc00003, 0xc760000c, 0xc4700004, 0xd3f80002, 0xdf5c0005, 0x69620000, 0xf5730008,
+            0xaa7b800f, 0x029ec008, 0x1600e006, 0x0d03f007, 0xb780b805, 0x9cc3c408, 0x5ee26607, 0xa9b1b707,
+            0x149b1d8e, 0x1b2f11c1, 0xba994fe2, 0x2a2c7d7d,
+            // Dimension 20
+            0x80000000, 0xc0000000, 0xe0000000, 0xd0000000, 0x68000000, 0x3c000000, 0x8a000000, 0x51000000,
+            0xa9800000, 0xddc00000, 0x5ba00000, 0x39d00000, 0x95f80000, 0x56d40000, 0x0a020000, 0x91030000,
+            0x49838000, 0x0dc34000, 0x33a1a000, 0x05d0f000, 0x1ffa2800, 0x07d54400, 0xa380a600, 0x4cc07700,
+            0x1222ee80, 0x3413a740, 0xa65bf7e0, 0x5305ab50, 0x15f80008, 0x96d4000c, 0xea02000e, 0x4103000d,
+            0x21838006, 0x31c34003, 0xb9a1a008, 0x54d0f005, 0xb67a280a, 0xda15440d, 0xf820a605, 0x75107703,
+            0x87daee89, 0x62c7a745, 0xac59f7e0, 0xc206ab59, 0x5c7b800c, 0x9b17400c, 0xd9a3a00d, 0x44d3f00d,
+            0x3e79a807, 0x36160403, 0x1a210602, 0x18108701
+    };
+}
@@ -3,6 +3,125 @@
 //
 
 #include "spectrum.h"
+#include <algorithm>
+
 namespace pbrt{
 
-}
\ No newline at end of file
+    float AverageSpectrumSamples(const float *lambda, const float *vals, int n,
+                                 float lambdaStart, float lambdaEnd) {
+        // Handle cases with out-of-bounds range or single sample only
+        if (lambdaEnd <= lambda[0]) return vals[0];
+        if (lambdaStart >= lambda[n - 1]) return vals[n - 1];
+        if (n == 1) return vals[0];
+        float sum = 0;
+        // Add contributions of constant segments before/after samples
+        if (lambdaStart < lambda[0]) sum += vals[0] * (lambda[0] - lambdaStart);
+        if (lambdaEnd > lambda[n - 1])
+            sum += vals[n - 1] * (lambdaEnd - lambda[n - 1]);
+
+        // Advance to first relevant wavelength segment
+        int i = int(std::upper_bound(lambda, lambda + n, lambdaStart) - lambda) - 1;
+        i = std::max(i, 0);
+
+        // Loop over wavelength sample segments and add contributions
+        auto interp = [lambda, vals](float w, int i) {
+            return Lerp((w - lambda[i]) / (lambda[i + 1] - lambda[i]), vals[i],
+                        vals[i + 1]);
+        };
+        for (; i + 1 < n && lambdaEnd >= lambda[i]; ++i) {
+            float segLambdaStart = std::max(lambdaStart, lambda[i]);
+            float segLambdaEnd = std::min(lambdaEnd, lambda[i + 1]);
+            sum += 0.5f * (interp(segLambdaStart, i) + interp(segLambdaEnd, i)) *
+                   (segLambdaEnd - segLambdaStart);
+        }
+        return sum / (lambdaEnd - lambdaStart);
+    }
+
+#ifdef PBRT_SAMPLED_SPECTRUM
+    SampledSpectrum SampledSpectrum::X, SampledSpectrum::Y, SampledSpectrum::Z;
+    float SampledSpectrum::xyzScale;
+    SampledSpectrum SampledSpectrum::rgbRefl2SpectWhite;
+    SampledSpectrum SampledSpectrum::rgbRefl2SpectCyan;
+    SampledSpectrum SampledSpectrum::rgbRefl2SpectMagenta;
+    SampledSpectrum SampledSpectrum::rgbRefl2SpectYellow;
+    SampledSpectrum SampledSpectrum::rgbRefl2SpectRed;
+    SampledSpectrum SampledSpectrum::rgbRefl2SpectGreen;
+    SampledSpectrum SampledSpectrum::rgbRefl2SpectBlue;
+    SampledSpectrum SampledSpectrum::rgbIllum2SpectWhite;
+    SampledSpectrum SampledSpectrum::rgbIllum2SpectCyan;
+    SampledSpectrum SampledSpectrum::rgbIllum2SpectMagenta;
+    SampledSpectrum SampledSpectrum::rgbIllum2SpectYellow;
+    SampledSpectrum SampledSpectrum::rgbIllum2SpectRed;
+    SampledSpectrum SampledSpectrum::rgbIllum2SpectGreen;
+    SampledSpectrum SampledSpectrum::rgbIllum2SpectBlue;
+
+    SampledSpectrum SampledSpectrum::FromSampled(const float *lambda,
+                                                 const float *v, int n) {
+        SampledSpectrum r;
+        for (int i = 0; i < nSpectralSamples; ++i) {
+            float lambda0 = Lerp(float(i) / float(nSpectralSamples),
+                                 sampledLambdaStart, sampledLambdaEnd);
+            float lambda1 = Lerp(float(i + 1) / float(nSpectralSamples),
+                                 sampledLambdaStart, sampledLambdaEnd);
+            r.c[i] = AverageSpectrumSamples(lambda, v, n, lambda0, lambda1);
+        }
+        return r;
+    }
+
+    void SampledSpectrum::Init() {
+        X = FromSampled(CIE_lambda, CIE_X, nCIESamples);
+        Y = FromSampled(CIE_lambda, CIE_Y, nCIESamples);
+        Z = FromSampled(CIE_lambda, CIE_Z, nCIESamples);
+        // The tables are sampled every nanometer
+        double yIntegral = 0;
+        for (int i = 0; i < nCIESamples; ++i) yIntegral += CIE_Y[i];
+        xyzScale = float((sampledLambdaEnd - sampledLambdaStart) /
+                         (yIntegral * nSpectralSamples));
+        auto bin = [](const float *v) {
+            return FromSampled(RGB2SpectLambda, v, nRGB2SpectSamples);
+        };
+        rgbRefl2SpectWhite = bin(RGBRefl2SpectWhite);
+        rgbRefl2SpectCyan = bin(RGBRefl2SpectCyan);
+        rgbRefl2SpectMagenta = bin(RGBRefl2SpectMagenta);
+        rgbRefl2SpectYellow = bin(RGBRefl2SpectYellow);
+        rgbRefl2SpectRed = bin(RGBRefl2SpectRed);
+        rgbRefl2SpectGreen = bin(RGBRefl2SpectGreen);
+        rgbRefl2SpectBlue = bin(RGBRefl2SpectBlue);
+        rgbIllum2SpectWhite = bin(RGBIllum2SpectWhite);
+        rgbIllum2SpectCyan = bin(RGBIllum2SpectCyan);
+        rgbIllum2SpectMagenta = bin(RGBIllum2SpectMagenta);
+        rgbIllum2SpectYellow = bin(RGBIllum2SpectYellow);
+        rgbIllum2SpectRed = bin(RGBIllum2SpectRed);
+        rgbIllum2SpectGreen = bin(RGBIllum2SpectGreen);
+        rgbIllum2SpectBlue = bin(RGBIllum2SpectBlue);
+    }
+
+    SampledSpectrum SampledSpectrum::FromRGB(const float rgb[3],
+                                             SpectrumType type) {
+        // Smits' decomposition: white covers the smallest component, then
+        // one secondary and one primary color cover the rest
+        bool refl = type == SpectrumType::Reflectance;
+        const SampledSpectrum &white = refl ? rgbRefl2SpectWhite : rgbIllum2SpectWhite;
+        const SampledSpectrum *primary[3] = {
+                refl ? &rgbRefl2SpectRed : &rgbIllum2SpectRed,
+                refl ? &rgbRefl2SpectGreen : &rgbIllum2SpectGreen,
+                refl ? &rgbRefl2SpectBlue : &rgbIllum2SpectBlue};
+        // _secondary[i]_ is the color missing component _i_
+        const SampledSpectrum *secondary[3] = {
+                refl ? &rgbRefl2SpectCyan : &rgbIllum2SpectCyan,
+                refl ? &rgbRefl2SpectMagenta : &rgbIllum2SpectMagenta,
+                refl ? &rgbRefl2SpectYellow : &rgbIllum2SpectYellow};
+
+        // Order the components as _rgb[lo] <= rgb[mid] <= rgb[hi]_
+        int lo = 0, mid = 1, hi = 2;
+        if (rgb[lo] > rgb[mid]) std::swap(lo, mid);
+        if (rgb[mid] > rgb[hi]) std::swap(mid, hi);
+        if (rgb[lo] > rgb[mid]) std::swap(lo, mid);
+
+        SampledSpectrum r = white * rgb[lo];
+        r += *secondary[lo] * (rgb[mid] - rgb[lo]);
+        r += *primary[hi] * (rgb[hi] - rgb[mid]);
+        return r.Clamp();
+    }
+#endif // PBRT_SAMPLED_SPECTRUM
+}
@@ -6,6 +6,12 @@
 #define PBRT_WHITTED_SPECTRUM_H
 
 #include "main.h"
+#ifdef __SSE__
+#include <xmmintrin.h>
+#endif
+#ifdef __AVX__
+#include <immintrin.h>
+#endif
 
 namespace pbrt {
 
@@ -23,66 +29,254 @@ namespace pbrt {
 
     enum class SpectrumType { Reflectance, Illuminant };
 
+    // Spectral rendering splits _sampledLambdaStart_..._sampledLambdaEnd_ nm
+    // into _nSpectralSamples_ bins
+    static const int sampledLambdaStart = 400;
+    static const int sampledLambdaEnd = 700;
+    static const int nSpectralSamples = 60;
 
+    // Average of the piecewise-linear function through _(lambda[i], vals[i])_
+    // over _[lambdaStart, lambdaEnd]_; _lambda_ must be sorted
+    float AverageSpectrumSamples(const float *lambda, const float *vals, int n,
+                                 float lambdaStart, float lambdaEnd);
+
+    // Tables in spectrumdata.cpp
     static const int nCIESamples = 471;
     extern const float CIE_X[nCIESamples];
     extern const float CIE_Y[nCIESamples];
     extern const float CIE_Z[nCIESamples];
     extern const float CIE_lambda[nCIESamples];
-    static const float CIE_Y_integral = 106.856895;
+    static constexpr float CIE_Y_integral = 106.856895;
+    static const int nRGB2SpectSamples = 32;
+    extern const float RGB2SpectLambda[nRGB2SpectSamples];
+    extern const float RGBRefl2SpectWhite[nRGB2SpectSamples];
+    extern const float RGBRefl2SpectCyan[nRGB2SpectSamples];
+    extern const float RGBRefl2SpectMagenta[nRGB2SpectSamples];
+    extern const float RGBRefl2SpectYellow[nRGB2SpectSamples];
+    extern const float RGBRefl2SpectRed[nRGB2SpectSamples];
+    extern const float RGBRefl2SpectGreen[nRGB2SpectSamples];
+    extern const float RGBRefl2SpectBlue[nRGB2SpectSamples];
+    extern const float RGBIllum2SpectWhite[nRGB2SpectSamples];
+    extern const float RGBIllum2SpectCyan[nRGB2SpectSamples];
+    extern const float RGBIllum2SpectMagenta[nRGB2SpectSamples];
+    extern const float RGBIllum2SpectYellow[nRGB2SpectSamples];
+    extern const float RGBIllum2SpectRed[nRGB2SpectSamples];
+    extern const float RGBIllum2SpectGreen[nRGB2SpectSamples];
+    extern const float RGBIllum2SpectBlue[nRGB2SpectSamples];
+
+    // Spectra are stored padded to whole SIMD vectors: four lanes, or eight
+    // with AVX for spectra wider than four. Pad lanes are always zero.
+#ifdef __AVX__
+    static constexpr bool SpectrumAVX = true;
+#else
+    static constexpr bool SpectrumAVX = false;
+#endif
+    constexpr int SpectrumVectorWidth(int n) { return SpectrumAVX && n > 4 ? 8 : 4; }
+    constexpr int PaddedSpectrumSamples(int n) {
+        return (n + SpectrumVectorWidth(n) - 1) / SpectrumVectorWidth(n) *
+               SpectrumVectorWidth(n);
+    }
+
+    // Lane-wise operations for _SpectrumMap()_, in scalar and vector form
+    struct SpectrumAdd {
+        static float Apply(float a, float b) { return a + b; }
+#ifdef __SSE__
+        static __m128 Apply(__m128 a, __m128 b) { return _mm_add_ps(a, b); }
+#endif
+#ifdef __AVX__
+        static __m256 Apply(__m256 a, __m256 b) { return _mm256_add_ps(a, b); }
+#endif
+    };
+    struct SpectrumSub {
+        static float Apply(float a, float b) { return a - b; }
+#ifdef __SSE__
+        static __m128 Apply(__m128 a, __m128 b) { return _mm_sub_ps(a, b); }
+#endif
+#ifdef __AVX__
+        static __m256 Apply(__m256 a, __m256 b) { return _mm256_sub_ps(a, b); }
+#endif
+    };
+    struct SpectrumMul {
+        static float Apply(float a, float b) { return a * b; }
+#ifdef __SSE__
+        static __m128 Apply(__m128 a, __m128 b) { return _mm_mul_ps(a, b); }
+#endif
+#ifdef __AVX__
+        static __m256 Apply(__m256 a, __m256 b) { return _mm256_mul_ps(a, b); }
+#endif
+    };
+    struct SpectrumDiv {
+        static float Apply(float a, float b) { return a / b; }
+#ifdef __SSE__
+        static __m128 Apply(__m128 a, __m128 b) { return _mm_div_ps(a, b); }
+#endif
+#ifdef __AVX__
+        static __m256 Apply(__m256 a, __m256 b) { return _mm256_div_ps(a, b); }
+#endif
+    };
+    // For clamping, the bound is passed as _a_: like _Clamp()_, these then
+    // return _b_ when it is NaN
+    struct SpectrumMax {
+        static float Apply(float a, float b) { return a > b ? a : b; }
+#ifdef __SSE__
+        static __m128 Apply(__m128 a, __m128 b) { return _mm_max_ps(a, b); }
+#endif
+#ifdef __AVX__
+        static __m256 Apply(__m256 a, __m256 b) { return _mm256_max_ps(a, b); }
+#endif
+    };
+    struct SpectrumMin {
+        static float Apply(float a, float b) { return a < b ? a : b; }
+#ifdef __SSE__
+        static __m128 Apply(__m128 a, __m128 b) { return _mm_min_ps(a, b); }
+#endif
+#ifdef __AVX__
+        static __m256 Apply(__m256 a, __m256 b) { return _mm256_min_ps(a, b); }
+#endif
+    };
+
+    // Sets _r[i] = Op(a[i], b[i])_ for the _N_ floats of a padded spectrum.
+    // Spectra in arenas and containers need not be aligned, so the vectors
+    // are loaded unaligned. With _BroadcastB_, _b_ is a single value used
+    // for every lane.
+    template <typename Op, int N, bool BroadcastB = false>
+    inline void SpectrumMap(float *r, const float *a, const float *b) {
+#ifdef __AVX__
+        if (N % 8 == 0) {
+            __m256 vb = _mm256_set1_ps(*b);
+            for (int i = 0; i < N; i += 8)
+                _mm256_storeu_ps(r + i,
+                                 Op::Apply(_mm256_loadu_ps(a + i),
+                                           BroadcastB ? vb : _mm256_loadu_ps(b + i)));
+            return;
+        }
+#endif
+#ifdef __SSE__
+        __m128 vb = _mm_set1_ps(*b);
+        for (int i = 0; i < N; i += 4)
+            _mm_storeu_ps(r + i, Op::Apply(_mm_loadu_ps(a + i),
+                                          BroadcastB ? vb : _mm_loadu_ps(b + i)));
+#else
+        for (int i = 0; i < N; ++i) r[i] = Op::Apply(a[i], BroadcastB ? *b : b[i]);
+#endif
+    }
+
+    // Nonzero if any lane of _a_ differs from the corresponding one of _b_,
+    // or with _b_ null, if any lane of _a_ is NaN
+    template <int N>
+    inline bool SpectrumAnyLane(const float *a, const float *b) {
+#ifdef __AVX__
+        if (N % 8 == 0) {
+            int mask = 0;
+            for (int i = 0; i < N; i += 8) {
+                __m256 va = _mm256_loadu_ps(a + i);
+                mask |= _mm256_movemask_ps(
+                        b ? _mm256_cmp_ps(va, _mm256_loadu_ps(b + i), _CMP_NEQ_UQ)
+                          : _mm256_cmp_ps(va, va, _CMP_UNORD_Q));
+            }
+            return mask != 0;
+        }
+#endif
+#ifdef __SSE__
+        int mask = 0;
+        for (int i = 0; i < N; i += 4) {
+            __m128 va = _mm_loadu_ps(a + i);
+            mask |= _mm_movemask_ps(b ? _mm_cmpneq_ps(va, _mm_loadu_ps(b + i))
+                                      : _mm_cmpunord_ps(va, va));
+        }
+        return mask != 0;
+#else
+        for (int i = 0; i < N; ++i)
+            if (b ? a[i] != b[i] : std::isnan(a[i])) return true;
+        return false;
+#endif
+    }
+
+    // Sum of _a[i] * b[i]_ over the _N_ floats of two padded spectra
+    template <int N>
+    inline float SpectrumDot(const float *a, const float *b) {
+#ifdef __AVX__
+        if (N % 8 == 0) {
+            __m256 sum = _mm256_setzero_ps();
+            for (int i = 0; i < N; i += 8)
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(a + i),
+                                                       _mm256_loadu_ps(b + i)));
+            float s[8];
+            _mm256_storeu_ps(s, sum);
+            return ((s[0] + s[4]) + (s[1] + s[5])) + ((s[2] + s[6]) + (s[3] + s[7]));
+        }
+#endif
+#ifdef __SSE__
+        __m128 sum = _mm_setzero_ps();
+        for (int i = 0; i < N; i += 4)
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+        float s[4];
+        _mm_storeu_ps(s, sum);
+        return (s[0] + s[2]) + (s[1] + s[3]);
+#else
+        float sum = 0;
+        for (int i = 0; i < N; ++i) sum += a[i] * b[i];
+        return sum;
+#endif
+    }
 
     template<int nSpectrumSamples>
-    class CoefficientSpectrum {
+    class alignas(16) CoefficientSpectrum {
     public:
         CoefficientSpectrum(float v = 0.f) {
+#ifdef __SSE__
+            for (int i = 0; i < nLanes; i += 4) _mm_storeu_ps(c + i, _mm_set1_ps(v));
+            ZeroPad();
+#else
             for (int i = 0; i < nSpectrumSamples; ++i) {
                 c[i] = v;
             }
+            for (int i = nSpectrumSamples; i < nLanes; ++i) c[i] = 0;
+#endif
         }
 
         static const int nSamples = nSpectrumSamples;
         bool HasNaNs() const {
-            for (int i = 0; i < nSpectrumSamples; ++i)
-                if (std::isnan(c[i])) return true;
-            return false;
+            return SpectrumAnyLane<nLanes>(c, nullptr);
         }
         CoefficientSpectrum &operator+=(const CoefficientSpectrum &s2) {
-            for (int i = 0; i < nSpectrumSamples; ++i) c[i] += s2.c[i];
+            SpectrumMap<SpectrumAdd, nLanes>(c, c, s2.c);
             return *this;
         }
         CoefficientSpectrum operator+(const CoefficientSpectrum &s2) const {
             CoefficientSpectrum ret = *this;
-            for (int i = 0; i < nSpectrumSamples; ++i) ret.c[i] += s2.c[i];
+            ret += s2;
             return ret;
         }
         CoefficientSpectrum operator-(const CoefficientSpectrum &s2) const {
             CoefficientSpectrum ret = *this;
-            for (int i = 0; i < nSpectrumSamples; ++i) ret.c[i] -= s2.c[i];
+            SpectrumMap<SpectrumSub, nLanes>(ret.c, c, s2.c);
             return ret;
         }
         CoefficientSpectrum operator/(const CoefficientSpectrum &s2) const {
             CoefficientSpectrum ret = *this;
-            for (int i = 0; i < nSpectrumSamples; ++i) {
-                ret.c[i] /= s2.c[i];
-            }
+            SpectrumMap<SpectrumDiv, nLanes>(ret.c, c, s2.c);
+            ret.ZeroPad();
             return ret;
         }
         CoefficientSpectrum operator*(const CoefficientSpectrum &sp) const {
             CoefficientSpectrum ret = *this;
-            for (int i = 0; i < nSpectrumSamples; ++i) ret.c[i] *= sp.c[i];
+            ret *= sp;
             return ret;
         }
         CoefficientSpectrum &operator*=(const CoefficientSpectrum &sp) {
-            for (int i = 0; i < nSpectrumSamples; ++i) c[i] *= sp.c[i];
+            SpectrumMap<SpectrumMul, nLanes>(c, c, sp.c);
             return *this;
         }
         CoefficientSpectrum operator*(float a) const {
             CoefficientSpectrum ret = *this;
-            for (int i = 0; i < nSpectrumSamples; ++i) ret.c[i] *= a;
+            ret *= a;
             return ret;
         }
         CoefficientSpectrum &operator*=(float a) {
-            for (int i = 0; i < nSpectrumSamples; ++i) c[i] *= a;
+            // Multiply the pad lanes by zero, not _a_, which may be infinite
+            CoefficientSpectrum s(a);
+            SpectrumMap<SpectrumMul, nLanes>(c, c, s.c);
             return *this;
         }
         friend inline CoefficientSpectrum operator*(float a,
@@ -91,37 +285,51 @@ namespace pbrt {
         }
         CoefficientSpectrum operator/(float a) const {
             CoefficientSpectrum ret = *this;
-            for (int i = 0; i < nSpectrumSamples; ++i) ret.c[i] /= a;
+            ret /= a;
             return ret;
         }
         CoefficientSpectrum &operator/=(float a) {
-            for (int i = 0; i < nSpectrumSamples; ++i) c[i] /= a;
+            SpectrumMap<SpectrumDiv, nLanes, true>(c, c, &a);
+            ZeroPad();
             return *this;
         }
         bool operator==(const CoefficientSpectrum &sp) const {
-            for (int i = 0; i < nSpectrumSamples; ++i)
-                if (c[i] != sp.c[i]) return false;
-            return true;
+            return !SpectrumAnyLane<nLanes>(c, sp.c);
         }
         bool operator!=(const CoefficientSpectrum &sp) const {
             return !(*this == sp);
         }
 
-        bool IsBlack() const {
-            for (int i = 0; i < nSpectrumSamples; ++i)
-                if (c[i] != 0.) return false;
-            return true;
-        }
+        bool IsBlack() const { return *this == CoefficientSpectrum(); }
 
         CoefficientSpectrum Clamp(float low = 0, float high = Infinity) const {
-            CoefficientSpectrum ret;
-            for (int i = 0; i < nSpectrumSamples; ++i)
-                ret.c[i] = pbrt::Clamp(c[i], low, high);
+            // The bounds' pad lanes are zero, so the result's stay zero too
+            CoefficientSpectrum ret, lo(low), hi(high);
+            SpectrumMap<SpectrumMax, nLanes>(ret.c, lo.c, c);
+            SpectrumMap<SpectrumMin, nLanes>(ret.c, hi.c, ret.c);
             return ret;
         }
 
     protected:
-        float c[nSpectrumSamples];
+        // Zeroes the pad lanes after an operation that can leave them
+        // nonzero, such as dividing zero by zero
+        static constexpr int nLanes = PaddedSpectrumSamples(nSpectrumSamples);
+
+        void ZeroPad() {
+#ifdef __SSE__
+            // Mask whole vectors; storing single lanes would stall the next
+            // vector load of the spectrum
+            for (int i = nSpectrumSamples / 4 * 4; i < nLanes; i += 4) {
+                __m128 lane = _mm_setr_ps(i, i + 1, i + 2, i + 3);
+                __m128 keep = _mm_cmplt_ps(lane, _mm_set1_ps(nSpectrumSamples));
+                _mm_storeu_ps(c + i, _mm_and_ps(_mm_loadu_ps(c + i), keep));
+            }
+#else
+            for (int i = nSpectrumSamples; i < nLanes; ++i) c[i] = 0;
+#endif
+        }
+
+        float c[nLanes];
     };
 
     class RGBSpectrum : public CoefficientSpectrum<3> {
@@ -166,5 +374,67 @@ namespace pbrt {
         }
     };
 
+    // Spectrum with _nSpectralSamples_ bins, for builds with
+    // PBRT_SAMPLED_SPECTRUM; _Init()_ must run before any is converted
+    // from or to color.
+    class SampledSpectrum : public CoefficientSpectrum<nSpectralSamples> {
+    public:
+        SampledSpectrum(float v = 0.f) : CoefficientSpectrum(v) {}
+        SampledSpectrum(const CoefficientSpectrum<nSpectralSamples> &v)
+                : CoefficientSpectrum<nSpectralSamples>(v) {}
+        SampledSpectrum(const RGBSpectrum &r,
+                        SpectrumType type = SpectrumType::Reflectance) {
+            float rgb[3];
+            r.ToRGB(rgb);
+            *this = FromRGB(rgb, type);
+        }
+
+        // Bins the matching functions and the RGB-to-spectrum tables
+        static void Init();
+        static SampledSpectrum FromSampled(const float *lambda, const float *v,
+                                           int n);
+        static SampledSpectrum FromRGB(const float rgb[3],
+                                       SpectrumType type = SpectrumType::Reflectance);
+        static SampledSpectrum FromXYZ(const float xyz[3],
+                                       SpectrumType type = SpectrumType::Reflectance) {
+            float rgb[3];
+            XYZToRGB(xyz, rgb);
+            return FromRGB(rgb, type);
+        }
+
+        void ToXYZ(float xyz[3]) const {
+            xyz[0] = SpectrumDot<nLanes>(X.c, c) * xyzScale;
+            xyz[1] = SpectrumDot<nLanes>(Y.c, c) * xyzScale;
+            xyz[2] = SpectrumDot<nLanes>(Z.c, c) * xyzScale;
+        }
+        float y() const { return SpectrumDot<nLanes>(Y.c, c) * xyzScale; }
+        void ToRGB(float rgb[3]) const {
+            float xyz[3];
+            ToXYZ(xyz);
+            XYZToRGB(xyz, rgb);
+        }
+        RGBSpectrum ToRGBSpectrum() const {
+            float rgb[3];
+            ToRGB(rgb);
+            return RGBSpectrum::FromRGB(rgb);
+        }
+
+    private:
+        // Scale that turns a sum over bins into an integral normalized to
+        // _Y = 1_ for a constant spectrum of 1. _Init()_ divides by the
+        // integral of the tabulated _CIE_Y_ rather than _CIE_Y_integral_,
+        // as the tables are a fit to the measured functions.
+        static float xyzScale;
+        static SampledSpectrum X, Y, Z;
+        static SampledSpectrum rgbRefl2SpectWhite, rgbRefl2SpectCyan;
+        static SampledSpectrum rgbRefl2SpectMagenta, rgbRefl2SpectYellow;
+        static SampledSpectrum rgbRefl2SpectRed, rgbRefl2SpectGreen;
+        static SampledSpectrum rgbRefl2SpectBlue;
+        static SampledSpectrum rgbIllum2SpectWhite, rgbIllum2SpectCyan;
+        static SampledSpectrum rgbIllum2SpectMagenta, rgbIllum2SpectYellow;
+        static SampledSpectrum rgbIllum2SpectRed, rgbIllum2SpectGreen;
+        static SampledSpectrum rgbIllum2SpectBlue;
+    };
+
 }
 #endif //PBRT_WHITTED_SPECTRUM_H
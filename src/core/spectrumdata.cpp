@@ -0,0 +1,347 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+// Generated tables; do not edit. They are only compiled into builds with
+// PBRT_SAMPLED_SPECTRUM, the only mode that converts spectra to color.
+//
+// The CIE 1931 2-degree color matching functions are tabulated at 1 nm
+// from the multi-lobe Gaussian fit of Wyman, Sloan and Shirley, "Simple
+// Analytic Approximations to the CIE XYZ Color Matching Functions" (JCGT
+// 2013), not from the measured data. The fit differs from the measured
+// functions by less than 0.007 near the peaks of the lobes (e.g. X at
+// 600 nm is 1.0559 rather than 1.0622) but by much more, relatively, in
+// the tails (X at 700 nm is about half the measured 0.0114). Integrated
+// over a smooth spectrum this moves X, Y and Z by about 0.1%, which is
+// below what an 8-bit image can show; spectra concentrated in the tails,
+// such as deep red or violet lines, come out noticeably off. The integral
+// of the fitted Y is 106.922 rather than _CIE_Y_integral_, so spectra are
+// normalized by the table's own integral.
+//
+// The RGB-to-spectrum tables hold Smits-style basis spectra: the
+// smoothest spectra, in the least-squares sense, whose color at
+// _nSpectralSamples_ bins is exactly white, cyan, magenta, yellow, red,
+// green or blue. Illuminant spectra are nonnegative. Reflectance spectra lie
+// in [0, 1] and give their color when lit by the white illuminant spectrum.
+
+#include "spectrum.h"
+
+namespace pbrt {
+#ifdef PBRT_SAMPLED_SPECTRUM
+
+    const float CIE_X[nCIESamples] = {
+            7.186123e-07, 9.875843e-07, 1.352028e-06, 1.843847e-06, 2.504882e-06, 3.389766e-06, 4.569509e-06, 6.135988e-06,
+            8.207537e-06, 1.093586e-05, 1.451455e-05, 1.918949e-05, 2.527155e-05, 3.315188e-05, 4.332032e-05, 5.638737e-05,
+            7.311022e-05, 9.442353e-05, 0.0001214753, 0.0001556685, 0.0001987095, 0.0002526628, 0.0003200137, 0.0004037388,
+            0.0005073838, 0.0006351512, 0.0007919937, 0.0009837176, 0.001217091, 0.001499961, 0.001841368, 0.002251671,
+            0.002742668, 0.003327709, 0.004021807, 0.004841733, 0.005806095, 0.006935392, 0.008252046, 0.009780383,
+            0.01154659, 0.0135786, 0.01590597, 0.0185596, 0.02157152, 0.02497447, 0.02880152, 0.03308552,
+            0.03785855, 0.04315125, 0.04899212, 0.05540672, 0.06241686, 0.07003978, 0.07828722, 0.0871646,
+            0.0966702, 0.1067943, 0.1175186, 0.1288155, 0.1406477, 0.1529677, 0.1657179, 0.1788305,
+            0.1922278, 0.2058225, 0.2195186, 0.2332124, 0.2467932, 0.2601451, 0.2731485, 0.2856815,
+            0.2976219, 0.3088494, 0.3192469, 0.3287031, 0.3371144, 0.3443862, 0.3504352, 0.3551906,
+            0.3585958, 0.3606088, 0.3612035, 0.3608229, 0.3599186, 0.3584923, 0.3565474, 0.3540891,
+            0.3511248, 0.3476637, 0.3437167, 0.3392966, 0.3344176, 0.3290956, 0.3233479, 0.3171932,
+            0.3106513, 0.3037432, 0.296491, 0.2889175, 0.2810465, 0.2729024, 0.2645101, 0.255895,
+            0.2470831, 0.2381002, 0.2289727, 0.219727, 0.2103895, 0.2009866, 0.1915445, 0.1820893,
+            0.1726468, 0.1632426, 0.153902, 0.1446499, 0.1355106, 0.1265082, 0.1176661, 0.1090074,
+            0.1005544, 0.09232876, 0.08435167, 0.07664351, 0.06922393, 0.06211179, 0.05532514, 0.04888115,
+            0.04279606, 0.03708517, 0.03176275, 0.02684203, 0.02233517, 0.01825319, 0.01460595, 0.01140213,
+            0.008649217, 0.00635346, 0.004519892, 0.003152319, 0.00225333, 0.001824316, 0.001840611, 0.002265348,
+            0.003097213, 0.004334859, 0.005976641, 0.008020651, 0.01046475, 0.01330662, 0.01654377, 0.02017357,
+            0.0241933, 0.02860015, 0.03339125, 0.03856369, 0.04411453, 0.05004083, 0.05633964, 0.06300802,
+            0.07004303, 0.07744175, 0.08520127, 0.09331869, 0.1017911, 0.1106155, 0.1197891, 0.1293088,
+            0.1391715, 0.1493742, 0.1599135, 0.1707861, 0.1819884, 0.1935168, 0.2053671, 0.2175353,
+            0.2300167, 0.2428066, 0.2558996, 0.2692903, 0.2829725, 0.2969396, 0.3111847, 0.3257001,
+            0.3404777, 0.3555086, 0.3707835, 0.3862922, 0.4020239, 0.4179671, 0.4341096, 0.4504382,
+            0.4669392, 0.4835981, 0.5003995, 0.5173271, 0.5343642, 0.551493, 0.5686949, 0.5859509,
+            0.6032408, 0.620544, 0.6378393, 0.6551046, 0.6723173, 0.6894543, 0.7064919, 0.723406,
+            0.740172, 0.756765, 0.7731599, 0.7893312, 0.8052533, 0.8209006, 0.8362474, 0.8512682,
+            0.8659372, 0.8802294, 0.8941196, 0.9075832, 0.9205961, 0.9331344, 0.9451753, 0.9566962,
+            0.9676754, 0.9780921, 0.9879265, 0.9971594, 1.005773, 1.01375, 1.021075, 1.027734,
+            1.033713, 1.039001, 1.043586, 1.047459, 1.050613, 1.053042, 1.05474, 1.055704,
+            1.055926, 1.055164, 1.053305, 1.050355, 1.046323, 1.041222, 1.035068, 1.02788,
+            1.019679, 1.010492, 1.000346, 0.9892709, 0.9773011, 0.9644718, 0.9508207, 0.936388,
+            0.9212151, 0.9053453, 0.8888235, 0.8716956, 0.8540086, 0.8358102, 0.8171488, 0.7980731,
+            0.7786321, 0.7588745, 0.738849, 0.7186038, 0.6981865, 0.6776437, 0.6570213, 0.6363639,
+            0.615715, 0.5951165, 0.5746089, 0.5542309, 0.5340196, 0.5140103, 0.4942361, 0.4747284,
+            0.4555164, 0.4366273, 0.4180862, 0.3999161, 0.3821378, 0.3647701, 0.3478296, 0.3313309,
+            0.3152865, 0.299707, 0.2846011, 0.2699754, 0.255835, 0.2421831, 0.2290212, 0.2163494,
+            0.2041662, 0.1924687, 0.1812526, 0.1705127, 0.1602423, 0.1504338, 0.1410789, 0.1321681,
+            0.1236914, 0.1156379, 0.1079964, 0.1007549, 0.09390122, 0.08742274, 0.08130657, 0.07553965,
+            0.07010876, 0.06500066, 0.06020206, 0.05569971, 0.05148049, 0.04753138, 0.04383957, 0.04039245,
+            0.03717768, 0.03418317, 0.03139718, 0.02880825, 0.02640531, 0.02417763, 0.02211486, 0.02020704,
+            0.01844461, 0.01681838, 0.01531959, 0.01393984, 0.01267118, 0.01150599, 0.01043708, 0.009457632,
+            0.008561182, 0.007741643, 0.006993275, 0.00631068, 0.005688789, 0.005122849, 0.004608412, 0.004141324,
+            0.003717707, 0.003333951, 0.002986698, 0.002672832, 0.002389461, 0.002133911, 0.001903709, 0.001696576,
+            0.001510406, 0.001343268, 0.001193381, 0.001059117, 0.0009389815, 0.0008316069, 0.0007357447, 0.0006502559,
+            0.0005741027, 0.0005063408, 0.0004461124, 0.0003926394, 0.0003452164, 0.0003032055, 0.0002660301, 0.00023317,
+            0.0002041562, 0.0001785667, 0.0001560223, 0.0001361823, 0.0001187416, 0.0001034268, 8.999361e-05, 7.822365e-05,
+            6.792234e-05, 5.891627e-05, 5.10512e-05, 4.419008e-05, 3.821128e-05, 3.300704e-05, 2.848194e-05, 2.455165e-05,
+            2.11417e-05, 1.818642e-05, 1.562797e-05, 1.341547e-05, 1.150423e-05, 9.855011e-06, 8.433441e-06, 7.209423e-06,
+            6.156648e-06, 5.25214e-06, 4.475858e-06, 3.810346e-06, 3.240414e-06, 2.752864e-06, 2.336238e-06, 1.980603e-06,
+            1.677359e-06, 1.419066e-06, 1.199298e-06, 1.012511e-06, 8.539269e-07, 7.194317e-07, 6.054894e-07, 5.090631e-07,
+            4.275478e-07, 3.58712e-07, 3.006459e-07, 2.51717e-07, 2.10532e-07, 1.759023e-07, 1.468159e-07, 1.224117e-07,
+            1.019578e-07, 8.483332e-08, 7.051158e-08, 5.85467e-08, 4.856155e-08, 4.023747e-08, 3.330558e-08, 2.75392e-08,
+            2.27475e-08, 1.877e-08, 1.547187e-08, 1.274e-08, 1.047959e-08, 8.611266e-09, 7.068674e-09, 5.796381e-09,
+            4.748145e-09, 3.88543e-09, 3.17616e-09, 2.593664e-09, 2.115792e-09, 1.724172e-09, 1.403576e-09, 1.141405e-09,
+            9.272383e-10, 7.524734e-10, 6.100129e-10, 4.940092e-10, 3.996493e-10, 3.229767e-10, 2.607422e-10, 2.102808e-10,
+            1.694088e-10, 1.363391e-10, 1.096107e-10, 8.803057e-11, 7.06256e-11, 5.660293e-11, 4.531727e-11, 3.624405e-11,
+            2.895728e-11, 2.311143e-11, 1.842655e-11, 1.467605e-11, 1.167676e-11, 9.280768e-12, 7.368743e-12, 5.844548e-12,
+            4.630806e-12, 3.665307e-12, 2.898092e-12, 2.289085e-12, 1.806176e-12, 1.423659e-12, 1.120986e-12};
+
+    const float CIE_Y[nCIESamples] = {
+            4.077269e-05, 4.482254e-05, 4.925225e-05, 5.409514e-05, 5.938722e-05, 6.516739e-05, 7.147765e-05, 7.836329e-05,
+            8.58732e-05, 9.406005e-05, 0.0001029806, 0.0001126959, 0.0001232716, 0.0001347786, 0.0001472927, 0.0001608956,
+            0.0001756749, 0.0001917245, 0.0002091454, 0.0002280455, 0.0002485405, 0.0002707543, 0.0002948195, 0.0003208777,
+            0.0003490804, 0.0003795893, 0.0004125769, 0.0004482276, 0.0004867374, 0.0005283156, 0.0005731849, 0.0006215822,
+            0.0006737596, 0.000729985, 0.0007905429, 0.0008557354, 0.000925883, 0.001001326, 0.001082423, 0.001169557,
+            0.00126313, 0.001363571, 0.001471328, 0.00158688, 0.001710729, 0.001843406, 0.001985469, 0.002137508,
+            0.002300145, 0.002474031, 0.002659852, 0.002858331, 0.003070224, 0.003296326, 0.003537471, 0.003794531,
+            0.004068421, 0.004360098, 0.004670562, 0.005000859, 0.005352081, 0.005725366, 0.006121902, 0.006542928,
+            0.00698973, 0.007463649, 0.007966079, 0.008498466, 0.009062313, 0.009659177, 0.01029067, 0.01095847,
+            0.0116643, 0.01240995, 0.01319726, 0.01402815, 0.01490457, 0.01582855, 0.01680217, 0.01782757,
+            0.01890696, 0.02004259, 0.02123678, 0.0224919, 0.02381038, 0.02519472, 0.02664743, 0.02817113,
+            0.02976845, 0.03144209, 0.03319479, 0.03502934, 0.03694859, 0.03895542, 0.04105275, 0.04324359,
+            0.04553093, 0.04791787, 0.05040751, 0.05300306, 0.05570773, 0.05852484, 0.06145776, 0.06450995,
+            0.06768499, 0.07098655, 0.07441845, 0.07798468, 0.0816894, 0.08553701, 0.08953217, 0.09367988,
+            0.09798543, 0.1024546, 0.1070936, 0.1119091, 0.1169086, 0.1221002, 0.1274925, 0.1330954,
+            0.1389193, 0.1449759, 0.1512778, 0.1578388, 0.1646737, 0.1717988, 0.1792313, 0.1869898,
+            0.195094, 0.2035647, 0.2124235, 0.2216931, 0.2313964, 0.241557, 0.2521983, 0.2633435,
+            0.275015, 0.2872339, 0.3000197, 0.3133895, 0.3273577, 0.3419352, 0.3571286, 0.37294,
+            0.3893661, 0.4063976, 0.4240188, 0.4422071, 0.4609327, 0.4801579, 0.4998376, 0.5199186,
+            0.5403402, 0.5610341, 0.5819253, 0.6029321, 0.6239671, 0.6449382, 0.6657495, 0.6863027,
+            0.7064977, 0.726235, 0.7454162, 0.763946, 0.7817331, 0.7986923, 0.8147452, 0.8298219,
+            0.8438616, 0.8568141, 0.8686401, 0.8793157, 0.8892854, 0.8988545, 0.9080136, 0.9167541,
+            0.9250683, 0.9329494, 0.9403913, 0.9473892, 0.9539388, 0.9600369, 0.965681, 0.9708696,
+            0.9756019, 0.9798778, 0.9836982, 0.9870645, 0.9899789, 0.9924443, 0.994464, 0.9960423,
+            0.9971835, 0.9978929, 0.9981759, 0.9980386, 0.9974874, 0.9965289, 0.9951703, 0.9934188,
+            0.9912819, 0.9887675, 0.9858835, 0.9826378, 0.9790388, 0.9750947, 0.9708138, 0.9662044,
+            0.961275, 0.9560313, 0.9503978, 0.9443424, 0.937874, 0.931002, 0.9237359, 0.9160858,
+            0.908062, 0.8996751, 0.8909359, 0.8818557, 0.8724458, 0.8627179, 0.8526839, 0.8423561,
+            0.8317468, 0.8208684, 0.809734, 0.7983564, 0.7867486, 0.774924, 0.762896, 0.7506781,
+            0.7382838, 0.7257268, 0.713021, 0.7001801, 0.6872179, 0.6741482, 0.6609849, 0.6477416,
+            0.6344321, 0.62107, 0.6076687, 0.5942417, 0.5808022, 0.5673633, 0.5539377, 0.5405383,
+            0.5271772, 0.5138668, 0.5006188, 0.487445, 0.4743564, 0.4613641, 0.4484786, 0.4357102,
+            0.4230686, 0.4105632, 0.3982032, 0.3859971, 0.3739531, 0.3620788, 0.3503817, 0.3388684,
+            0.3275455, 0.3164188, 0.3054937, 0.2947752, 0.2842679, 0.2739758, 0.2639025, 0.2540511,
+            0.2444244, 0.2350246, 0.2258535, 0.2169126, 0.2082027, 0.1997246, 0.1914783, 0.1834638,
+            0.1756803, 0.1681271, 0.1608029, 0.1537061, 0.1468348, 0.1401869, 0.1337599, 0.1275512,
+            0.1215578, 0.1157765, 0.1102039, 0.1048365, 0.09967054, 0.09470208, 0.08992709, 0.08534138,
+            0.08094065, 0.07672051, 0.07267647, 0.068804, 0.06509847, 0.06155525, 0.05816966, 0.05493698,
+            0.05185252, 0.04891159, 0.04610948, 0.04344154, 0.04090314, 0.03848969, 0.03619665, 0.03401956,
+            0.03195399, 0.0299956, 0.02814013, 0.02638339, 0.02472128, 0.0231498, 0.02166503, 0.02026316,
+            0.01894047, 0.01769334, 0.01651828, 0.01541187, 0.01437082, 0.01339193, 0.01247213, 0.01160843,
+            0.01079796, 0.01003796, 0.00932577, 0.008658834, 0.008034697, 0.007451008, 0.006905513, 0.006396056,
+            0.005920575, 0.005477103, 0.005063762, 0.004678763, 0.004320401, 0.003987057, 0.00367719, 0.003389339,
+            0.003122118, 0.002874213, 0.002644379, 0.002431442, 0.002234289, 0.002051871, 0.001883198, 0.001727337,
+            0.001583411, 0.001450592, 0.001328105, 0.001215219, 0.001111251, 0.001015558, 0.0009275406, 0.0008466349,
+            0.0007723154, 0.0007040904, 0.000641501, 0.0005841193, 0.0005315462, 0.0004834101, 0.0004393652, 0.00039909,
+            0.0003622857, 0.0003286751, 0.000298001, 0.0002700249, 0.000244526, 0.0002213002, 0.0002001582, 0.0001809258,
+            0.0001634417, 0.0001475571, 0.0001331352, 0.0001200496, 0.0001081843, 9.743219e-05, 8.769525e-05, 7.888328e-05,
+            7.091352e-05, 6.371011e-05, 5.720354e-05, 5.133016e-05, 4.603177e-05, 4.125512e-05, 3.695161e-05, 3.307684e-05,
+            2.959034e-05, 2.64552e-05, 2.363782e-05, 2.110761e-05, 1.883674e-05, 1.679994e-05, 1.497425e-05, 1.333883e-05,
+            1.187477e-05, 1.056497e-05, 9.393911e-06, 8.347565e-06, 7.413247e-06, 6.579491e-06, 5.835948e-06, 5.173277e-06,
+            4.583057e-06, 4.057701e-06, 3.590377e-06, 3.174938e-06, 2.805858e-06, 2.478171e-06, 2.18742e-06, 1.929605e-06,
+            1.701139e-06, 1.498809e-06, 1.319739e-06, 1.161355e-06, 1.021357e-06, 8.976868e-07, 7.885106e-07, 6.921902e-07,
+            6.072655e-07, 5.324355e-07, 4.665419e-07, 4.08554e-07, 3.575556e-07, 3.127324e-07, 2.733615e-07, 2.388015e-07,
+            2.084837e-07, 1.81904e-07, 1.586163e-07, 1.382256e-07, 1.203828e-07, 1.047793e-07, 9.114266e-08, 7.923249e-08,
+            6.883671e-08, 5.976846e-08, 5.18632e-08, 4.49761e-08, 3.897979e-08, 3.376233e-08, 2.922541e-08, 2.528273e-08,
+            2.185861e-08, 1.888671e-08, 1.630893e-08, 1.407439e-08, 1.213862e-08, 1.04627e-08, 9.012679e-09, 7.758881e-09,
+            6.675434e-09, 5.739779e-09, 4.932261e-09, 4.235767e-09, 3.63541e-09, 3.118243e-09, 2.673017e-09, 2.289964e-09,
+            1.960609e-09, 1.6776e-09, 1.434568e-09, 1.225996e-09, 1.04711e-09, 8.937798e-10, 7.624373e-10};
+
+    const float CIE_Z[nCIESamples] = {
+            0.0004839873, 0.0005599063, 0.0006467768, 0.0007460214, 0.0008592231, 0.0009881404, 0.001134722, 0.001301124,
+            0.001489727, 0.001703154, 0.00194429, 0.002216302, 0.00252266, 0.00286716, 0.003253948, 0.003687547,
+            0.004172883, 0.004715322, 0.005320698, 0.005995365, 0.006746243, 0.007580881, 0.008507535, 0.009535264,
+            0.01067406, 0.01193498, 0.01333039, 0.01487416, 0.01658205, 0.01847203, 0.02056485, 0.02288456,
+            0.02545932, 0.02832222, 0.03151232, 0.03507582, 0.03906746, 0.04355196, 0.04860568, 0.05431839,
+            0.06079499, 0.06815728, 0.07654558, 0.08612008, 0.09706184, 0.1095731, 0.1238772, 0.1402168,
+            0.1588522, 0.180057, 0.2041136, 0.2313062, 0.2619126, 0.2961947, 0.3343874, 0.3766861,
+            0.4232338, 0.4741077, 0.5293059, 0.5887353, 0.6522002, 0.7193943, 0.7898947, 0.8631603,
+            0.9385335, 1.015247, 1.092437, 1.169154, 1.244392, 1.317104, 1.386237, 1.450755,
+            1.509675, 1.562096, 1.607223, 1.644401, 1.673127, 1.693074, 1.70799, 1.721714,
+            1.734199, 1.745395, 1.755256, 1.76374, 1.770806, 1.776416, 1.780537, 1.783139,
+            1.784194, 1.783681, 1.781581, 1.777882, 1.772574, 1.765654, 1.757123, 1.746987,
+            1.735258, 1.721953, 1.707094, 1.690707, 1.671543, 1.648383, 1.621345, 1.590602,
+            1.556376, 1.518934, 1.478582, 1.435659, 1.390527, 1.343567, 1.295168, 1.245722,
+            1.195612, 1.145209, 1.094868, 1.044914, 0.9956478, 0.947336, 0.9002112, 0.8544705,
+            0.8102753, 0.7677517, 0.7269921, 0.688057, 0.650978, 0.6157607, 0.5823874, 0.5508215,
+            0.5210098, 0.4928867, 0.4663767, 0.4413979, 0.417864, 0.3956872, 0.3747798, 0.3550557,
+            0.3364322, 0.3188305, 0.3021767, 0.2864022, 0.2714438, 0.2572436, 0.2437495, 0.2309144,
+            0.2186958, 0.2070561, 0.1959615, 0.185382, 0.1752907, 0.1656636, 0.1564792, 0.1477177,
+            0.1393616, 0.1313946, 0.1238014, 0.116568, 0.1096811, 0.1031282, 0.09689703, 0.09097607,
+            0.08535399, 0.08001981, 0.07496281, 0.07017249, 0.06563855, 0.06135088, 0.05729957, 0.05347488,
+            0.04986726, 0.04646735, 0.04326598, 0.04025419, 0.03742325, 0.0347646, 0.03226996, 0.02993125,
+            0.02774064, 0.02569053, 0.02377359, 0.02198272, 0.02031109, 0.01875209, 0.01729941, 0.01594696,
+            0.0146889, 0.01351965, 0.01243388, 0.01142649, 0.01049262, 0.009627638, 0.008827152, 0.008086978,
+            0.007403156, 0.00677193, 0.006189746, 0.00565325, 0.005159271, 0.004704825, 0.004287099, 0.003903447,
+            0.003551388, 0.003228589, 0.002932867, 0.002662177, 0.002414606, 0.002188369, 0.001981799, 0.001793345,
+            0.001621559, 0.001465098, 0.001322712, 0.001193243, 0.001075617, 0.0009688375, 0.0008719855, 0.0007842102,
+            0.0007047266, 0.0006328105, 0.000567795, 0.0005090663, 0.0004560601, 0.000408258, 0.0003651844, 0.0003264034,
+            0.0002915157, 0.0002601562, 0.000231991, 0.0002067156, 0.0001840518, 0.0001637464, 0.0001455689, 0.0001293094,
+            0.0001147775, 0.0001018, 9.022029e-05, 7.989606e-05, 7.06987e-05, 6.251185e-05, 5.52304e-05, 4.875947e-05,
+            4.301348e-05, 3.791535e-05, 3.33957e-05, 2.939212e-05, 2.584855e-05, 2.271466e-05, 1.994533e-05, 1.750012e-05,
+            1.534285e-05, 1.344113e-05, 1.176604e-05, 1.029176e-05, 8.995269e-06, 7.856035e-06, 6.855792e-06, 5.978286e-06,
+            5.209076e-06, 4.535337e-06, 3.945693e-06, 3.430062e-06, 2.979515e-06, 2.586152e-06, 2.24299e-06, 1.943863e-06,
+            1.683328e-06, 1.456588e-06, 1.259418e-06, 1.088097e-06, 9.393562e-07, 8.103226e-07, 6.984744e-07, 6.016001e-07,
+            5.17762e-07, 4.452638e-07, 3.826216e-07, 3.285387e-07, 2.818827e-07, 2.416658e-07, 2.07027e-07, 1.772162e-07,
+            1.515811e-07, 1.295542e-07, 1.106427e-07, 9.441888e-08, 8.051187e-08, 6.860028e-08, 5.840591e-08, 4.968811e-08,
+            4.223896e-08, 3.587887e-08, 3.045294e-08, 2.582763e-08, 2.188793e-08, 1.853489e-08, 1.568339e-08, 1.326035e-08,
+            1.120301e-08, 9.457567e-09, 7.977908e-09, 6.724555e-09, 5.663736e-09, 4.766584e-09, 4.00845e-09, 3.368299e-09,
+            2.828197e-09, 2.372867e-09, 1.989309e-09, 1.666464e-09, 1.394937e-09, 1.16675e-09, 9.751386e-10, 8.14366e-10,
+            6.795757e-10, 5.666578e-10, 4.721379e-10, 3.930807e-10, 3.270088e-10, 2.718329e-10, 2.257926e-10, 1.874054e-10,
+            1.554245e-10, 1.288017e-10, 1.066569e-10, 8.825124e-11, 7.296553e-11, 6.028087e-11, 4.976296e-11, 4.104855e-11,
+            3.383408e-11, 2.786607e-11, 2.293306e-11, 1.885877e-11, 1.549635e-11, 1.272361e-11, 1.043894e-11, 8.557896e-12,
+            7.010398e-12, 5.7383e-12, 4.693412e-12, 3.835827e-12, 3.132524e-12, 2.556198e-12, 2.084297e-12, 1.698203e-12,
+            1.382561e-12, 1.124719e-12, 9.142579e-13, 7.426057e-13, 6.02716e-13, 4.888009e-13, 3.961104e-13, 3.20749e-13,
+            2.595251e-13, 2.098255e-13, 1.695127e-13, 1.368393e-13, 1.103785e-13, 8.896577e-14, 7.165167e-14, 5.766265e-14,
+            4.636901e-14, 3.725854e-14, 2.991499e-14, 2.40003e-14, 1.92402e-14, 1.541229e-14, 1.233644e-14, 9.866819e-15,
+            7.885506e-15, 6.29719e-15, 5.024918e-15, 4.0066e-15, 3.192184e-15, 2.541352e-15, 2.021652e-15, 1.60699e-15,
+            1.276394e-15, 1.013027e-15, 8.033825e-16, 6.366322e-16, 5.041035e-16, 3.988556e-16, 3.153382e-16, 2.491165e-16,
+            1.966496e-16, 1.551132e-16, 1.222557e-16, 9.62841e-17, 7.577132e-17, 5.958268e-17, 4.681663e-17, 3.675742e-17,
+            2.883732e-17, 2.260631e-17, 1.770799e-17, 1.386034e-17, 1.084035e-17, 8.471839e-18, 6.615718e-18, 5.162275e-18,
+            4.025039e-18, 3.135913e-18, 2.44131e-18, 1.899095e-18, 1.476166e-18, 1.146539e-18, 8.898302e-19, 6.900658e-19,
+            5.347351e-19, 4.14049e-19, 3.203537e-19, 2.476696e-19, 1.913289e-19, 1.476907e-19, 1.139176e-19, 8.779974e-20,
+            6.761773e-20, 5.203468e-20, 4.001198e-20, 3.074341e-20, 2.360364e-20, 1.810802e-20, 1.388122e-20, 1.063284e-20,
+            8.13834e-21, 6.224254e-21, 4.756677e-21, 3.632326e-21, 2.771603e-21, 2.113207e-21, 1.609971e-21, 1.225628e-21,
+            9.323189e-22, 7.086554e-22, 5.382333e-22, 4.084802e-22, 3.097678e-22, 2.347289e-22, 1.777303e-22, 1.344688e-22,
+            1.016591e-22, 7.679558e-23, 5.796835e-23, 4.372305e-23, 3.2953e-23, 2.481672e-23, 1.867491e-23, 1.404228e-23,
+            1.055071e-23, 7.921195e-24, 5.942437e-24, 4.454545e-24, 3.336622e-24, 2.497328e-24, 1.867708e-24, 1.395749e-24,
+            1.042247e-24, 7.776758e-25, 5.798179e-25, 4.31966e-25, 3.215676e-25, 2.391994e-25, 1.777922e-25, 1.320475e-25,
+            9.799695e-26, 7.267078e-26, 5.38483e-26, 3.987026e-26, 2.94979e-26, 2.18071e-26, 1.610904e-26};
+
+    const float CIE_lambda[nCIESamples] = {
+            360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371,
+            372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383,
+            384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395,
+            396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407,
+            408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419,
+            420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431,
+            432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443,
+            444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455,
+            456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467,
+            468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479,
+            480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491,
+            492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503,
+            504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515,
+            516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527,
+            528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539,
+            540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551,
+            552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563,
+            564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575,
+            576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587,
+            588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599,
+            600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611,
+            612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+            624, 625, 626, 627, 628, 629, 630, 631, 632, 633, 634, 635,
+            636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647,
+            648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 658, 659,
+            660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671,
+            672, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682, 683,
+            684, 685, 686, 687, 688, 689, 690, 691, 692, 693, 694, 695,
+            696, 697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 707,
+            708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719,
+            720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731,
+            732, 733, 734, 735, 736, 737, 738, 739, 740, 741, 742, 743,
+            744, 745, 746, 747, 748, 749, 750, 751, 752, 753, 754, 755,
+            756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767,
+            768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779,
+            780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791,
+            792, 793, 794, 795, 796, 797, 798, 799, 800, 801, 802, 803,
+            804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814, 815,
+            816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827,
+            828, 829, 830};
+
+    const float RGB2SpectLambda[nRGB2SpectSamples] = {
+            380, 390.9677, 401.9355, 412.9032, 423.871, 434.8387, 445.8065, 456.7742,
+            467.7419, 478.7097, 489.6774, 500.6452, 511.6129, 522.5806, 533.5484, 544.5161,
+            555.4839, 566.4516, 577.4194, 588.3871, 599.3549, 610.3226, 621.2903, 632.2581,
+            643.2258, 654.1935, 665.1613, 676.129, 687.0968, 698.0645, 709.0323, 720};
+
+    const float RGBRefl2SpectWhite[nRGB2SpectSamples] = {
+            0.9999934, 0.9999934, 0.9999933, 0.9999926, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 0.9999958,
+            0.9999833, 0.9999893, 1, 1, 1, 1, 1, 1};
+
+    const float RGBRefl2SpectCyan[nRGB2SpectSamples] = {
+            0.9331493, 0.9331493, 0.9331539, 0.9344179, 0.9431084, 0.9596399, 0.9831806, 1,
+            1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 0.8881038, 0.5767561, 0.2423376, 0.02438793, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0};
+
+    const float RGBRefl2SpectMagenta[nRGB2SpectSamples] = {
+            1, 1, 1, 1, 1, 1, 1, 1,
+            0.941541, 0.7399437, 0.4750427, 0.2212872, 0.04262302, 0, 0, 0,
+            0, 0.08142581, 0.2633589, 0.4895449, 0.7072017, 0.8754368, 0.973002, 1,
+            1, 1, 1, 1, 1, 1, 1, 1};
+
+    const float RGBRefl2SpectYellow[nRGB2SpectSamples] = {
+            0, 0, 0, 0, 0, 0, 0, 0.03917574,
+            0.1485971, 0.309472, 0.4944025, 0.6778457, 0.8375811, 0.9514858, 1, 1,
+            1, 1, 1, 1, 0.9977891, 0.9853503, 0.9720345, 0.9622467,
+            0.9567451, 0.9544528, 0.9539065, 0.9540112, 0.9542006, 0.9542846, 0.954286, 0.9542857};
+
+    const float RGBRefl2SpectRed[nRGB2SpectSamples] = {
+            0.06684787, 0.0668479, 0.06684328, 0.0655794, 0.05689036, 0.04036084, 0.01682174, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0.1119296, 0.4232578, 0.7576448, 0.9755837, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1};
+
+    const float RGBRefl2SpectGreen[nRGB2SpectSamples] = {
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0.05845625, 0.2600566, 0.5249629, 0.7787223, 0.9573858, 1, 1, 1,
+            1, 0.9185802, 0.7366467, 0.5104568, 0.2927957, 0.1245583, 0.02699383, 0,
+            0, 0, 0, 0, 0, 0, 0, 0};
+
+    const float RGBRefl2SpectBlue[nRGB2SpectSamples] = {
+            1, 1, 1, 1, 1, 1, 1, 0.960822,
+            0.8514016, 0.6905298, 0.5056031, 0.322163, 0.1624288, 0.04852162, 0, 0,
+            0, 0, 0, 0, 0.002211602, 0.01465025, 0.02796552, 0.03775293,
+            0.04325426, 0.04554646, 0.04609279, 0.04598804, 0.04579868, 0.04571472, 0.04571329, 0.04571353};
+
+    const float RGBIllum2SpectWhite[nRGB2SpectSamples] = {
+            1.08765, 1.08765, 1.087651, 1.087729, 1.088166, 1.089386, 1.09183, 1.095481,
+            1.099652, 1.103438, 1.105905, 1.105939, 1.102197, 1.093159, 1.077564, 1.055231,
+            1.02713, 0.9950974, 0.9615692, 0.9292226, 0.900573, 0.8775124, 0.8608198, 0.8500112,
+            0.8437877, 0.8406274, 0.83923, 0.8387037, 0.8385445, 0.8385143, 0.8385146, 0.8385149};
+
+    const float RGBIllum2SpectCyan[nRGB2SpectSamples] = {
+            0.9993494, 0.9993493, 0.999359, 1.000027, 1.00369, 1.014576, 1.037059, 1.071658,
+            1.114501, 1.159666, 1.200443, 1.229419, 1.238394, 1.218362, 1.16177, 1.067043,
+            0.9389411, 0.7869778, 0.6239804, 0.4642009, 0.3211747, 0.205263, 0.1210253, 0.06638309,
+            0.03492501, 0.01898402, 0.01196637, 0.00934267, 0.008557123, 0.008407077, 0.00840455, 0.008404469};
+
+    const float RGBIllum2SpectMagenta[nRGB2SpectSamples] = {
+            1.286718, 1.286718, 1.286682, 1.284345, 1.27171, 1.232046, 1.14808, 1.01604,
+            0.8435434, 0.6461602, 0.4442085, 0.2581286, 0.1081123, 0.01572112, 0, 0,
+            0.02783819, 0.1213317, 0.2600834, 0.4201738, 0.5776007, 0.7124718, 0.8135321, 0.8799419,
+            0.9180928, 0.9370686, 0.9450846, 0.9478546, 0.9485672, 0.9486668, 0.9486671, 0.9486667};
+
+    const float RGBIllum2SpectYellow[nRGB2SpectSamples] = {
+            0, 0, 0, 0, 0, 0, 0.005874892, 0.06762487,
+            0.1803782, 0.3305866, 0.499078, 0.6684802, 0.8245205, 0.9538977, 1.045403, 1.094167,
+            1.101778, 1.074559, 1.022264, 0.9565278, 0.8891927, 0.8302391, 0.785564, 0.75607,
+            0.7391391, 0.7307737, 0.727294, 0.7261291, 0.7258503, 0.7258188, 0.7258188, 0.725819};
+
+    const float RGBIllum2SpectRed[nRGB2SpectSamples] = {
+            0.04962689, 0.04962697, 0.0496227, 0.04915737, 0.04627144, 0.03916756, 0.0262656, 0.009860164,
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0.03577882, 0.1662578, 0.351764, 0.5515939, 0.7309698, 0.8686092, 0.9599376,
+            1.012322, 1.038016, 1.048522, 1.051909, 1.052645, 1.052701, 1.0527, 1.052699};
+
+    const float RGBIllum2SpectGreen[nRGB2SpectSamples] = {
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0.1062222, 0.2953633, 0.5246775, 0.7556026, 0.9569783, 1.100774, 1.164541, 1.140569,
+            1.036073, 0.8692281, 0.6658874, 0.4555548, 0.2669525, 0.1228558, 0.03457018, 0,
+            0, 0, 0, 0, 0, 0, 0, 0};
+
+    const float RGBIllum2SpectBlue[nRGB2SpectSamples] = {
+            1.211324, 1.211324, 1.211295, 1.209482, 1.199722, 1.168373, 1.101381, 0.9952512,
+            0.854139, 0.6887258, 0.5141588, 0.3451024, 0.1953787, 0.07980158, 0.01219351, 0,
+            0, 0, 0, 0, 0, 0.00804185, 0.01791403, 0.02545015,
+            0.02968164, 0.03135537, 0.03164676, 0.03145689, 0.03124666, 0.03115946, 0.03115713, 0.03115691};
+#endif // PBRT_SAMPLED_SPECTRUM
+}
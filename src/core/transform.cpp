@@ -40,7 +40,66 @@ namespace pbrt{
         m[3][3] = t33;
     }
 
+    Matrix4x4 Transpose(const Matrix4x4 &m) {
+        return Matrix4x4(m.m[0][0], m.m[1][0], m.m[2][0], m.m[3][0], m.m[0][1],
+                         m.m[1][1], m.m[2][1], m.m[3][1], m.m[0][2], m.m[1][2],
+                         m.m[2][2], m.m[3][2], m.m[0][3], m.m[1][3], m.m[2][3],
+                         m.m[3][3]);
+    }
+
+#ifdef __SSE__
+    static inline __m128 Cross(__m128 a, __m128 b) {
+        __m128 a1 = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+        __m128 b1 = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+        __m128 a2 = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 1, 0, 2));
+        __m128 b2 = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 1, 0, 2));
+        return _mm_sub_ps(_mm_mul_ps(a1, b2), _mm_mul_ps(a2, b1));
+    }
+
+    // Inverse of an affine matrix: the rows of the inverse of its 3x3 block
+    // are cross products of the block's columns over its determinant, and
+    // the translation is mapped back through that inverse. Returns false if
+    // the block is singular.
+    static bool InverseAffine(const Matrix4x4 &m, Matrix4x4 *mInv) {
+        __m128 a0 = _mm_loadu_ps(m.m[0]), a1 = _mm_loadu_ps(m.m[1]);
+        __m128 a2 = _mm_loadu_ps(m.m[2]), t = _mm_loadu_ps(m.m[3]);
+        // Columns; the bottom row is $(0, 0, 0, 1)$, so lane 3 of _a0_..._a2_
+        // is zero and lane 3 of _t_ is one
+        _MM_TRANSPOSE4_PS(a0, a1, a2, t);
+        __m128 r0 = Cross(a1, a2), r1 = Cross(a2, a0), r2 = Cross(a0, a1);
+        alignas(16) float d[4];
+        _mm_store_ps(d, _mm_mul_ps(a0, r0));
+        float det = d[0] + d[1] + d[2];
+        if (det == 0) return false;
+        __m128 invDet = _mm_set1_ps(1 / det);
+        r0 = _mm_mul_ps(r0, invDet);
+        r1 = _mm_mul_ps(r1, invDet);
+        r2 = _mm_mul_ps(r2, invDet);
+        __m128 r3 = _mm_setzero_ps();
+        // Back to columns to map the translation through the inverse block
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        alignas(16) float tv[4];
+        _mm_store_ps(tv, t);
+        __m128 tInv = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(r0, _mm_set1_ps(-tv[0])),
+                           _mm_mul_ps(r1, _mm_set1_ps(-tv[1]))),
+                _mm_mul_ps(r2, _mm_set1_ps(-tv[2])));
+        r3 = _mm_add_ps(tInv, _mm_setr_ps(0, 0, 0, 1));
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        _mm_storeu_ps(mInv->m[0], r0);
+        _mm_storeu_ps(mInv->m[1], r1);
+        _mm_storeu_ps(mInv->m[2], r2);
+        _mm_storeu_ps(mInv->m[3], r3);
+        return true;
+    }
+#endif
+
     Matrix4x4 Inverse(const Matrix4x4 &m) {
+#ifdef __SSE__
+        Matrix4x4 affineInv;
+        if (m.IsAffine() && InverseAffine(m, &affineInv)) return affineInv;
+#endif
+        // General matrices: Gauss-Jordan elimination with full pivoting
         int indxc[4], indxr[4];
         int ipiv[4] = {0, 0, 0, 0};
         float minv[4][4];
@@ -135,6 +194,45 @@ namespace pbrt{
         return Transform(m, minv);
     }
 
+    Transform Rotate(float theta, const Vector3f &axis) {
+        Vector3f a = Normalize(axis);
+        float sinTheta = std::sin(Radians(theta));
+        float cosTheta = std::cos(Radians(theta));
+        Matrix4x4 m;
+        // Compute rotation of first basis vector
+        m.m[0][0] = a.x * a.x + (1 - a.x * a.x) * cosTheta;
+        m.m[0][1] = a.x * a.y * (1 - cosTheta) - a.z * sinTheta;
+        m.m[0][2] = a.x * a.z * (1 - cosTheta) + a.y * sinTheta;
+        m.m[0][3] = 0;
+
+        // Compute rotations of second and third basis vectors
+        m.m[1][0] = a.x * a.y * (1 - cosTheta) + a.z * sinTheta;
+        m.m[1][1] = a.y * a.y + (1 - a.y * a.y) * cosTheta;
+        m.m[1][2] = a.y * a.z * (1 - cosTheta) - a.x * sinTheta;
+        m.m[1][3] = 0;
+
+        m.m[2][0] = a.x * a.z * (1 - cosTheta) - a.y * sinTheta;
+        m.m[2][1] = a.y * a.z * (1 - cosTheta) + a.x * sinTheta;
+        m.m[2][2] = a.z * a.z + (1 - a.z * a.z) * cosTheta;
+        m.m[2][3] = 0;
+        return Transform(m, Transpose(m));
+    }
+
+    void Transform::Precompute() {
+        projective = !m.IsAffine();
+#ifdef __SSE__
+        __m128 c0 = _mm_loadu_ps(m.m[0]), c1 = _mm_loadu_ps(m.m[1]);
+        __m128 c2 = _mm_loadu_ps(m.m[2]), c3 = _mm_loadu_ps(m.m[3]);
+        _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+        _mm_storeu_ps(mCols.m[0], c0);
+        _mm_storeu_ps(mCols.m[1], c1);
+        _mm_storeu_ps(mCols.m[2], c2);
+        _mm_storeu_ps(mCols.m[3], c3);
+#else
+        mCols = Transpose(m);
+#endif
+    }
+
     Transform Transform::operator*(const Transform &t2) const {
         return Transform(Matrix4x4::Mul(m, t2.m), Matrix4x4::Mul(t2.mInv, mInv));
     }
@@ -175,9 +273,17 @@ namespace pbrt{
     template<typename T>
     Normal3<T> Transform::operator()(const Normal3<T> &n) const {
         T x = n.x, y = n.y, z = n.z;
+#ifdef __SSE__
+        // Normals transform by the inverse transpose: sum the rows of _mInv_
+        alignas(16) float r[4];
+        _mm_store_ps(r, WeightedRows(mInv, x, y, z));
+        return Normal3<T>(r[0], r[1], r[2]);
+#else
         return Normal3<T>(mInv.m[0][0] * x + mInv.m[1][0] * y + mInv.m[2][0] * z,
                           mInv.m[0][1] * x + mInv.m[1][1] * y + mInv.m[2][1] * z,
-                          mInv.m[0][2] * x + mInv.m[1][2] * y + mInv.m[2][2] * z);    }
+                          mInv.m[0][2] * x + mInv.m[1][2] * y + mInv.m[2][2] * z);
+#endif
+    }
 
     Bounds3f Transform::operator()(const Bounds3f &b) const {
         const Transform &M = *this;
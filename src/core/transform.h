@@ -7,9 +7,18 @@
 
 #include "main.h"
 #include "geometry.h"
+#ifdef __SSE__
+#include <xmmintrin.h>
+#endif
+#ifdef __AVX__
+#include <immintrin.h>
+#endif
 
 namespace pbrt{
-    struct Matrix4x4 {
+    // Rows are not assumed to be aligned: 32-byte AVX rows would need more
+    // than _alignas(16)_, and matrices in containers need not honor even
+    // that, so the SIMD code below loads and stores them unaligned
+    struct alignas(16) Matrix4x4 {
         Matrix4x4() {
             m[0][0] = m[1][1] = m[2][2] = m[3][3] = 1.f;
             m[0][1] = m[0][2] = m[0][3] = m[1][0] = m[1][2] = m[1][3] = m[2][0] =
@@ -24,12 +33,43 @@ namespace pbrt{
 
         static Matrix4x4 Mul(const Matrix4x4 &m1, const Matrix4x4 &m2) {
             Matrix4x4 r;
+#if defined(__AVX__)
+            // Row _i_ of the product is the rows of _m2_ weighted by _m1[i]_;
+            // two rows are computed at a time
+            for (int i = 0; i < 4; i += 2) {
+                auto term = [&](int k) {
+                    __m256 w = _mm256_insertf128_ps(
+                            _mm256_castps128_ps256(_mm_set1_ps(m1.m[i][k])),
+                            _mm_set1_ps(m1.m[i + 1][k]), 1);
+                    return _mm256_mul_ps(w, _mm256_broadcast_ps((const __m128 *)m2.m[k]));
+                };
+                __m256 sum = _mm256_add_ps(term(0), term(1));
+                sum = _mm256_add_ps(sum, term(2));
+                _mm256_storeu_ps(r.m[i], _mm256_add_ps(sum, term(3)));
+            }
+#elif defined(__SSE__)
+            // Row _i_ of the product is the rows of _m2_ weighted by _m1[i]_
+            __m128 rows[4] = {_mm_loadu_ps(m2.m[0]), _mm_loadu_ps(m2.m[1]),
+                              _mm_loadu_ps(m2.m[2]), _mm_loadu_ps(m2.m[3])};
+            for (int i = 0; i < 4; ++i) {
+                __m128 sum = _mm_mul_ps(_mm_set1_ps(m1.m[i][0]), rows[0]);
+                for (int k = 1; k < 4; ++k)
+                    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(m1.m[i][k]), rows[k]));
+                _mm_storeu_ps(r.m[i], sum);
+            }
+#else
             for (int i = 0; i < 4; ++i)
                 for (int j = 0; j < 4; ++j)
                     r.m[i][j] = m1.m[i][0] * m2.m[0][j] + m1.m[i][1] * m2.m[1][j] +
                                 m1.m[i][2] * m2.m[2][j] + m1.m[i][3] * m2.m[3][j];
+#endif
             return r;
         }
+        // True if the bottom row is $(0, 0, 0, 1)$, i.e. the matrix is an
+        // affine 3x4 transformation without a homogeneous divide
+        bool IsAffine() const {
+            return m[3][0] == 0 && m[3][1] == 0 && m[3][2] == 0 && m[3][3] == 1;
+        }
         bool operator==(const Matrix4x4 &m2) const {
             for (int i = 0; i < 4; ++i)
                 for (int j = 0; j < 4; ++j)
@@ -41,16 +81,19 @@ namespace pbrt{
     };
         class Transform {
         public:
-            Transform() {}
+            Transform() { Precompute(); }
             Transform(const float mat[4][4]) {
                 m = Matrix4x4(mat[0][0], mat[0][1], mat[0][2], mat[0][3], mat[1][0],
                               mat[1][1], mat[1][2], mat[1][3], mat[2][0], mat[2][1],
                               mat[2][2], mat[2][3], mat[3][0], mat[3][1], mat[3][2],
                               mat[3][3]);
                 mInv = Inverse(m);
+                Precompute();
+            }
+            Transform(const Matrix4x4 &m) : m(m), mInv(Inverse(m)) { Precompute(); }
+            Transform(const Matrix4x4 &m, const Matrix4x4 &mInv) : m(m), mInv(mInv) {
+                Precompute();
             }
-            Transform(const Matrix4x4 &m) : m(m), mInv(Inverse(m)) {}
-            Transform(const Matrix4x4 &m, const Matrix4x4 &mInv) : m(m), mInv(mInv) {}
             friend Transform Inverse(const Transform &t) {
                 return Transform(t.mInv, t.m);
             }
@@ -59,9 +102,13 @@ namespace pbrt{
             inline Normal3<T> operator()(const Normal3<T> &) const;
 
             const Matrix4x4 &GetMatrix() const { return m; }
+            bool IsAffine() const { return !projective; }
             template <typename T>
             inline Point3<T> operator()(const Point3<T> &p) const;
             template <typename T>
+            inline Point3<T> operator()(const Point3<T> &p,
+                                        Vector3<T> *pError) const;
+            template <typename T>
             inline Vector3<T> operator()(const Vector3<T> &v) const;
             inline Ray operator()(const Ray &r) const;
             Bounds3f operator()(const Bounds3f &b) const;
@@ -72,46 +119,92 @@ namespace pbrt{
                 return t.m == m && t.mInv == mInv;
             }
         private:
+            void Precompute();
+
             // Transform Private Data
             Matrix4x4 m, mInv;
+            // _m_ transposed, so that transforming a point or vector sums its
+            // columns weighted by the coordinates
+            Matrix4x4 mCols;
+            // Set unless the bottom row of _m_ is $(0, 0, 0, 1)$; affine
+            // transforms only use the top 3x4 block and skip the divide
+            bool projective;
     };
 
     Transform Translate(const Vector3f &delta);
     Transform Scale(float x, float y, float z);
+    Transform Rotate(float theta, const Vector3f &axis);
     Transform LookAt(const Point3f &pos, const Point3f &look, const Vector3f &up);
     Transform Orthographic(float znear, float zfar);
     bool SolveLinearSystem2x2(const float A[2][2], const float B[2], float *x0,
                               float *x1);
+#ifdef __SSE__
+    // Sum of the rows of _m_ weighted by _x_, _y_ and _z_
+    inline __m128 WeightedRows(const Matrix4x4 &m, float x, float y, float z) {
+        return _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(_mm_set1_ps(x), _mm_loadu_ps(m.m[0])),
+                           _mm_mul_ps(_mm_set1_ps(y), _mm_loadu_ps(m.m[1]))),
+                _mm_mul_ps(_mm_set1_ps(z), _mm_loadu_ps(m.m[2])));
+    }
+#endif
+
     template <typename T>
     inline Point3<T> Transform::operator()(const Point3<T> &p) const {
         T x = p.x, y = p.y, z = p.z;
+#ifdef __SSE__
+        alignas(16) float r[4];
+        _mm_store_ps(r, _mm_add_ps(WeightedRows(mCols, x, y, z),
+                                   _mm_loadu_ps(mCols.m[3])));
+        if (!projective) return Point3<T>(r[0], r[1], r[2]);
+        return Point3<T>(r[0], r[1], r[2]) / r[3];
+#else
         T xp = m.m[0][0] * x + m.m[0][1] * y + m.m[0][2] * z + m.m[0][3];
         T yp = m.m[1][0] * x + m.m[1][1] * y + m.m[1][2] * z + m.m[1][3];
         T zp = m.m[2][0] * x + m.m[2][1] * y + m.m[2][2] * z + m.m[2][3];
+        if (!projective) return Point3<T>(xp, yp, zp);
         T wp = m.m[3][0] * x + m.m[3][1] * y + m.m[3][2] * z + m.m[3][3];
-        if (wp == 1)
-            return Point3<T>(xp, yp, zp);
-        else
-            return Point3<T>(xp, yp, zp) / wp;
+        return Point3<T>(xp, yp, zp) / wp;
+#endif
     }
 
     template <typename T>
     inline Vector3<T> Transform::operator()(const Vector3<T> &v) const {
         T x = v.x, y = v.y, z = v.z;
+#ifdef __SSE__
+        alignas(16) float r[4];
+        _mm_store_ps(r, WeightedRows(mCols, x, y, z));
+        return Vector3<T>(r[0], r[1], r[2]);
+#else
         return Vector3<T>(m.m[0][0] * x + m.m[0][1] * y + m.m[0][2] * z,
                           m.m[1][0] * x + m.m[1][1] * y + m.m[1][2] * z,
                           m.m[2][0] * x + m.m[2][1] * y + m.m[2][2] * z);
+#endif
+    }
+
+    template <typename T>
+    inline Point3<T> Transform::operator()(const Point3<T> &p,
+                                           Vector3<T> *pError) const {
+        // Bound the rounding error of the affine part of the transform
+        T x = p.x, y = p.y, z = p.z;
+        T xAbsSum = std::abs(m.m[0][0] * x) + std::abs(m.m[0][1] * y) +
+                    std::abs(m.m[0][2] * z) + std::abs(m.m[0][3]);
+        T yAbsSum = std::abs(m.m[1][0] * x) + std::abs(m.m[1][1] * y) +
+                    std::abs(m.m[1][2] * z) + std::abs(m.m[1][3]);
+        T zAbsSum = std::abs(m.m[2][0] * x) + std::abs(m.m[2][1] * y) +
+                    std::abs(m.m[2][2] * z) + std::abs(m.m[2][3]);
+        *pError = gamma(3) * Vector3<T>(xAbsSum, yAbsSum, zAbsSum);
+        return (*this)(p);
     }
 
     inline Ray Transform::operator()(const Ray &r) const {
-        Point3f o = (*this)(r.o);
+        Vector3f oError;
+        Point3f o = (*this)(r.o, &oError);
         Vector3f d = (*this)(r.d);
         // Offset ray origin to edge of error bounds and compute _tMax_
         float lengthSquared = d.LengthSquared();
         float tMax = r.tMax;
         if (lengthSquared > 0) {
-            Vector3f oError(0,0,0);
-            float dt = Dot(Abs(d),oError) / lengthSquared;
+            float dt = Dot(Abs(d), oError) / lengthSquared;
             o += d * dt;
             tMax -= dt;
         }
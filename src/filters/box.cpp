@@ -3,13 +3,16 @@
 //
 
 #include "filters/box.h"
+#include "paramset.h"
 namespace pbrt {
-    float BoxFilter::Evaluate(const Point2f &p) const {
+    float BoxFilter::Evaluate(const Point2f &) const {
         return 1.;
     }
 
-    BoxFilter *CreateBoxFilter() {
-        return new BoxFilter(Vector2f(0.5f,0.5f));
+    BoxFilter *CreateBoxFilter(const ParamSet &ps) {
+        float xw = ps.FindOneFloat("xwidth", 0.5f);
+        float yw = ps.FindOneFloat("ywidth", 0.5f);
+        return new BoxFilter(Vector2f(xw, yw));
     }
 
 }
@@ -12,8 +12,10 @@ namespace pbrt{
     public:
         BoxFilter(const Vector2f &radius): Filter(radius) {}
         float Evaluate(const Point2f &p) const override;
+        bool IsSeparable() const override { return true; }
+        float Evaluate1D(float, int) const override { return 1.; }
     };
-    BoxFilter *CreateBoxFilter();
+    BoxFilter *CreateBoxFilter(const ParamSet &ps);
 }
 
 
@@ -0,0 +1,37 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#ifndef PBRT_WHITTED_GAUSSIAN_H
+#define PBRT_WHITTED_GAUSSIAN_H
+
+#include "filter.h"
+
+namespace pbrt{
+    class GaussianFilter: public Filter{
+    public:
+        GaussianFilter(const Vector2f &radius, float alpha)
+                : Filter(radius),
+                  alpha(alpha),
+                  expX(std::exp(-alpha * radius.x * radius.x)),
+                  expY(std::exp(-alpha * radius.y * radius.y)) {}
+        float Evaluate(const Point2f &p) const override;
+        bool IsSeparable() const override { return true; }
+        float Evaluate1D(float v, int dim) const override {
+            return Gaussian(v, dim == 0 ? expX : expY);
+        }
+
+    private:
+        const float alpha;
+        const float expX, expY;
+
+        // Gaussian shifted down so that it reaches zero at the filter radius
+        float Gaussian(float d, float expv) const {
+            return std::max((float)0, float(std::exp(-alpha * d * d) - expv));
+        }
+    };
+    GaussianFilter *CreateGaussianFilter(const ParamSet &ps);
+}
+
+
+#endif //PBRT_WHITTED_GAUSSIAN_H
@@ -0,0 +1,20 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#include "filters/mitchell.h"
+#include "paramset.h"
+namespace pbrt {
+    float MitchellFilter::Evaluate(const Point2f &p) const {
+        return Mitchell1D(p.x * invRadius.x) * Mitchell1D(p.y * invRadius.y);
+    }
+
+    MitchellFilter *CreateMitchellFilter(const ParamSet &ps) {
+        float xw = ps.FindOneFloat("xwidth", 2.f);
+        float yw = ps.FindOneFloat("ywidth", 2.f);
+        float B = ps.FindOneFloat("B", 1.f / 3.f);
+        float C = ps.FindOneFloat("C", 1.f / 3.f);
+        return new MitchellFilter(Vector2f(xw, yw), B, C);
+    }
+
+}
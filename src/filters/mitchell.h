@@ -0,0 +1,41 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#ifndef PBRT_WHITTED_MITCHELL_H
+#define PBRT_WHITTED_MITCHELL_H
+
+#include "filter.h"
+
+namespace pbrt{
+    class MitchellFilter: public Filter{
+    public:
+        MitchellFilter(const Vector2f &radius, float B, float C)
+                : Filter(radius), B(B), C(C) {}
+        float Evaluate(const Point2f &p) const override;
+        bool IsSeparable() const override { return true; }
+        float Evaluate1D(float v, int dim) const override {
+            return Mitchell1D(v * invRadius[dim]);
+        }
+
+    private:
+        const float B, C;
+
+        // Cubic on $[-1,1]$; negative lobes towards the ends
+        float Mitchell1D(float x) const {
+            x = std::abs(2 * x);
+            if (x > 1)
+                return ((-B - 6 * C) * x * x * x + (6 * B + 30 * C) * x * x +
+                        (-12 * B - 48 * C) * x + (8 * B + 24 * C)) *
+                       (1.f / 6.f);
+            else
+                return ((12 - 9 * B - 6 * C) * x * x * x +
+                        (-18 + 12 * B + 6 * C) * x * x + (6 - 2 * B)) *
+                       (1.f / 6.f);
+        }
+    };
+    MitchellFilter *CreateMitchellFilter(const ParamSet &ps);
+}
+
+
+#endif //PBRT_WHITTED_MITCHELL_H
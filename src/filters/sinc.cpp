@@ -0,0 +1,19 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#include "filters/sinc.h"
+#include "paramset.h"
+namespace pbrt {
+    float LanczosSincFilter::Evaluate(const Point2f &p) const {
+        return WindowedSinc(p.x, radius.x) * WindowedSinc(p.y, radius.y);
+    }
+
+    LanczosSincFilter *CreateSincFilter(const ParamSet &ps) {
+        float xw = ps.FindOneFloat("xwidth", 4.f);
+        float yw = ps.FindOneFloat("ywidth", 4.f);
+        float tau = ps.FindOneFloat("tau", 3.f);
+        return new LanczosSincFilter(Vector2f(xw, yw), tau);
+    }
+
+}
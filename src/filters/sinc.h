@@ -0,0 +1,41 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#ifndef PBRT_WHITTED_SINC_H
+#define PBRT_WHITTED_SINC_H
+
+#include "filter.h"
+
+namespace pbrt{
+    class LanczosSincFilter: public Filter{
+    public:
+        LanczosSincFilter(const Vector2f &radius, float tau)
+                : Filter(radius), tau(tau) {}
+        float Evaluate(const Point2f &p) const override;
+        bool IsSeparable() const override { return true; }
+        float Evaluate1D(float v, int dim) const override {
+            return WindowedSinc(v, radius[dim]);
+        }
+
+    private:
+        const float tau;
+
+        float Sinc(float x) const {
+            x = std::abs(x);
+            if (x < 1e-5) return 1;
+            return std::sin(Pi * x) / (Pi * x);
+        }
+        // Sinc windowed by a Lanczos window, which is itself a wider sinc
+        float WindowedSinc(float x, float radius) const {
+            x = std::abs(x);
+            if (x > radius) return 0;
+            float lanczos = Sinc(x / tau);
+            return Sinc(x) * lanczos;
+        }
+    };
+    LanczosSincFilter *CreateSincFilter(const ParamSet &ps);
+}
+
+
+#endif //PBRT_WHITTED_SINC_H
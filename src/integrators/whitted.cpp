@@ -3,6 +3,7 @@
 //
 
 #include "integrators/whitted.h"
+#include "paramset.h"
 #include "interaction.h"
 #include "camera.h"
 #include "film.h"
@@ -26,17 +27,30 @@ namespace pbrt {
 
         L += isect.Le(wo);
 
-        for (const auto &light : scene.lights) {
-            Vector3f wi;
-            float pdf;
-            VisibilityTester visibility; /* ask a visibility tester function from the light source*/
-            Spectrum Li =
-                    light->Sample_Li(isect, sampler.Get2D(), &wi, &pdf,
-                                     &visibility); /* returns radiance of light source */
-            if (Li.IsBlack() || pdf == 0) continue;
-            Spectrum f = isect.bsdf->f(wo, wi);
-            if (!f.IsBlack() && visibility.Unoccluded(scene))
-                L += f * Li * AbsDot(wi, n) / pdf;
+        for (size_t i = 0; i < scene.lights.size(); ++i) {
+            const auto &light = scene.lights[i];
+            // Use the stratified light samples requested in _Preprocess()_
+            int nSamples = 1;
+            const Point2f *uLightArray = nullptr;
+            if (depth == 0 && i < nLightSamples.size()) {
+                uLightArray = sampler.Get2DArray(nLightSamples[i]);
+                if (uLightArray) nSamples = nLightSamples[i];
+            }
+            Spectrum Ld(0.f);
+            for (int k = 0; k < nSamples; ++k) {
+                Vector3f wi;
+                float pdf;
+                VisibilityTester visibility; /* ask a visibility tester function from the light source*/
+                Point2f uLight = uLightArray ? uLightArray[k] : sampler.Get2D();
+                Spectrum Li =
+                        light->Sample_Li(isect, uLight, &wi, &pdf,
+                                         &visibility); /* returns radiance of light source */
+                if (Li.IsBlack() || pdf == 0) continue;
+                Spectrum f = isect.bsdf->f(wo, wi);
+                if (!f.IsBlack() && visibility.Unoccluded(scene))
+                    Ld += f * Li * AbsDot(wi, n) / pdf;
+            }
+            L += Ld / nSamples;
         }
         if (depth + 1 < maxDepth) {
             // Trace rays for specular reflection and refraction
@@ -47,19 +61,29 @@ namespace pbrt {
         return L;
     }
 
-    WhittedIntegrator * CreateWhittedIntegrator(std::shared_ptr<pbrt::Sampler> sampler, std::shared_ptr<const pbrt::Camera> camera) {
-            int maxDepth = 5;
-            int np;
-            const int *pb = &np;
-            Bounds2i pixelBounds = camera->film->GetSampleBounds();
-            if (pb) {
-                if (np != 4){}
-                else {
-                    pixelBounds = Intersect(pixelBounds,
-                                            Bounds2i{{pb[0], pb[2]}, {pb[1], pb[3]}});
-                    if (pixelBounds.Area() == 0){}
-                }
+    void WhittedIntegrator::Preprocess(const Scene &scene, Sampler &sampler) {
+        nLightSamples.clear();
+        for (const auto &light : scene.lights)
+            nLightSamples.push_back(sampler.RoundCount(light->nSamples));
+        for (int n : nLightSamples) sampler.Request2DArray(n);
+    }
+
+    WhittedIntegrator * CreateWhittedIntegrator(const ParamSet &params, std::shared_ptr<pbrt::Sampler> sampler, std::shared_ptr<const pbrt::Camera> camera) {
+        int maxDepth = params.FindOneInt("maxdepth", 5);
+        int np;
+        const int *pb = params.FindInt("pixelbounds", &np);
+        Bounds2i pixelBounds = camera->film->GetSampleBounds();
+        if (pb) {
+            if (np != 4)
+                std::cerr << "Expected four values for \"pixelbounds\" parameter. Got "
+                          << np << "." << std::endl;
+            else {
+                pixelBounds = Intersect(pixelBounds,
+                                        Bounds2i{{pb[0], pb[2]}, {pb[1], pb[3]}});
+                if (pixelBounds.Area() == 0)
+                    std::cerr << "Degenerate \"pixelbounds\" specified." << std::endl;
             }
-            return new WhittedIntegrator(maxDepth, camera, sampler, pixelBounds);
         }
+        return new WhittedIntegrator(maxDepth, camera, sampler, pixelBounds);
+    }
 }
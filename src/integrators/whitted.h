@@ -14,12 +14,17 @@ namespace pbrt {
     public:
         WhittedIntegrator(int maxDepth, std::shared_ptr<const Camera> camera, std::shared_ptr<Sampler> sampler, const Bounds2i &pixelBounds):
         SamplerIntegrator(camera,sampler,pixelBounds), maxDepth(maxDepth){}
+        void Preprocess(const Scene &scene, Sampler &sampler);
         Spectrum Li(const RayDifferential &ray, const Scene &scene,
                     Sampler &sampler, MemoryArena &arena, int depth) const;
     private:
         const int maxDepth;
+        // Light samples per light at the first intersection; deeper
+        // intersections take a single sample
+        std::vector<int> nLightSamples;
     };
     WhittedIntegrator *CreateWhittedIntegrator(
+            const ParamSet &params,
             std::shared_ptr<Sampler> sampler,
             std::shared_ptr<const Camera> camera);
 }
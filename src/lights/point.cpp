@@ -3,6 +3,7 @@
 //
 
 #include "lights/point.h"
+#include "paramset.h"
 #include "scene.h"
 #include "sampling.h"
 
@@ -20,11 +21,12 @@ namespace pbrt{
         return 4 * Pi * I;
     }
 
-    std::shared_ptr<PointLight> CreatePointLight(const Transform &light2world) {
-        float rgb[3] = {.5,.5,.5};
-        Spectrum I = Spectrum::FromRGB(rgb);
-        Spectrum sc = Spectrum(1.0);
-        Point3f P = Point3f(0,0,0);
+    std::shared_ptr<PointLight> CreatePointLight(const Transform &light2world,
+                                                 const ParamSet &paramSet) {
+        Spectrum I = paramSet.FindOneSpectrum("I", Spectrum(1.0),
+                                              SpectrumType::Illuminant);
+        Spectrum sc = paramSet.FindOneSpectrum("scale", Spectrum(1.0));
+        Point3f P = paramSet.FindOnePoint3f("from", Point3f(0,0,0));
         Transform l2w = Translate(Vector3f(P.x, P.y, P.z)) * light2world;
         return std::make_shared<PointLight>(l2w, I * sc);
     }
@@ -27,6 +27,7 @@ namespace pbrt{
         const Spectrum I;
 
     };
-    std::shared_ptr<PointLight> CreatePointLight(const Transform &light2world);
+    std::shared_ptr<PointLight> CreatePointLight(const Transform &light2world,
+                                                 const ParamSet &paramSet);
     }
 #endif //PBRT_WHITTED_POINT_H
@@ -0,0 +1,23 @@
+#include <iostream>
+#include "renderserver.h"
+
+using namespace pbrt;
+
+// Sends one request to pbrt_daemon and prints its reply, e.g.
+//
+//     pbrt_client /tmp/pbrt.sock image=front.pfm spp=64 lookat=0,0,10,0,0,0,0,1,0
+//     pbrt_client /tmp/pbrt.sock quit
+int main(int argc, char *argv []) {
+    if (argc < 3) {
+        std::cout << "usage: pbrt_client <socket> <request>..." << std::endl;
+        return -1;
+    }
+
+    std::string request = argv[2];
+    for (int i = 3; i < argc; ++i) request += std::string(" ") + argv[i];
+
+    std::string reply;
+    if (!RenderServer::SendRequest(argv[1], request, &reply)) return 1;
+    std::cout << reply << std::endl;
+    return reply.compare(0, 2, "ok") == 0 ? 0 : 1;
+}
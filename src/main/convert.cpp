@@ -0,0 +1,16 @@
+#include <iostream>
+#include "binaryscene.h"
+
+using namespace pbrt;
+
+// Converts a scene description to the binary format, which pbrt_whitted
+// reads like a text scene
+int main(int argc, char *argv []) {
+    if (argc != 3) {
+        std::cout << "usage: pbrt_convert <scene.pbrt> <scene.pbrtb>"
+                  << std::endl;
+        return -1;
+    }
+
+    return ConvertToBinaryScene(argv[1], argv[2]) ? 0 : 1;
+}
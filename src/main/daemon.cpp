@@ -0,0 +1,45 @@
+#include <iostream>
+#include <vector>
+#include "api.h"
+#include "parser.h"
+#include "renderserver.h"
+
+using namespace pbrt;
+
+// Loads a scene once and renders views of it on request; see
+// _RenderServer_ for the protocol and pbrt_client for a client
+int main(int argc, char *argv []) {
+    if (argc < 3) {
+        std::cout << "usage: pbrt_daemon <socket> <scene file>..." << std::endl;
+        return -1;
+    }
+
+    Options options;
+    options.retainScene = true;
+    pbrtInit(options);
+
+    bool ok = true;
+    for (int i = 2; i < argc; ++i)
+        if (!pbrtParseFile(argv[i])) {
+            ok = false;
+            break;
+        }
+
+    std::shared_ptr<const ResidentScene> scene = pbrtResidentScene();
+    if (ok && !scene) {
+        std::cerr << "The scene description has no WorldEnd" << std::endl;
+        ok = false;
+    }
+    if (ok) {
+        std::unique_ptr<RenderServer> server = RenderServer::Create(argv[1], scene);
+        if (server) {
+            std::cout << "Serving on " << argv[1] << std::endl;
+            server->Run();
+        } else
+            ok = false;
+    }
+
+    scene.reset();
+    pbrtCleanup();
+    return ok ? 0 : 1;
+}
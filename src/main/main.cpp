@@ -1,36 +1,107 @@
 #include <iostream>
 #include <vector>
+#include <cstdlib>
+#include <cstring>
 #include "api.h"
 #include "parser.h"
 
 using namespace pbrt;
 
+static void usage(const char *msg = nullptr) {
+    if (msg) std::cerr << "pbrt_whitted: " << msg << std::endl << std::endl;
+    std::cerr << R"(usage: pbrt_whitted [<options>] <filename.pbrt...>
+Rendering options:
+  --nthreads <num>          Use specified number of threads for rendering.
+  --outfile <filename>      Write the final image to the given filename.
+  --cropwindow <x0,x1,y0,y1>
+                            Specify an image crop window.
+  --spp <num>               Override the samples per pixel of the sampler.
+  --samplefilter            Draw samples from the pixel filter's distribution.
+  --adaptive <threshold>    Stop sampling pixels whose relative error is
+                            below the threshold.
+  --adaptivemin <num>       Samples a pixel takes before it may stop (16).
+  --progressive             Render in passes, writing the image after each.
+  --deadline <seconds>      Stop a progressive render after this long.
+  --backing <filename>      Keep the film's pixels in a memory-mapped file.
+  --checkpoint <filename>   Save progress to the file and resume from it.
+  --checkpointinterval <seconds>
+                            Time between checkpoints (300); 0 saves only
+                            at the end of each pass.
+  --preview <socket>        Send merged tiles to a viewer on the socket.
+)";
+    exit(msg ? 1 : 0);
+}
+
+// Returns the value of option _argv[*i]_ and moves past it
+static const char *OptionValue(int argc, char *argv[], int *i) {
+    if (*i + 1 == argc) {
+        std::string msg = std::string("missing value after ") + argv[*i];
+        usage(msg.c_str());
+    }
+    return argv[++*i];
+}
+
 int main(int argc, char *argv []) {
-    /*
+    Options options;
     std::vector<std::string> filenames;
 
-    // don't support any command-line arguments except for file names
     for (int i = 1; i < argc; ++i) {
-        filenames.emplace_back(argv[i]);
+        if (!strcmp(argv[i], "--nthreads"))
+            options.nThreads = atoi(OptionValue(argc, argv, &i));
+        else if (!strcmp(argv[i], "--outfile"))
+            options.imageFile = OptionValue(argc, argv, &i);
+        else if (!strcmp(argv[i], "--cropwindow")) {
+            const char *value = OptionValue(argc, argv, &i);
+            if (sscanf(value, "%f,%f,%f,%f", &options.cropWindow[0][0],
+                       &options.cropWindow[0][1], &options.cropWindow[1][0],
+                       &options.cropWindow[1][1]) != 4)
+                usage("--cropwindow takes four comma-separated values");
+        } else if (!strcmp(argv[i], "--spp"))
+            options.pixelSamples = atoi(OptionValue(argc, argv, &i));
+        else if (!strcmp(argv[i], "--samplefilter"))
+            options.sampleFilter = true;
+        else if (!strcmp(argv[i], "--adaptive"))
+            options.adaptiveThreshold = atof(OptionValue(argc, argv, &i));
+        else if (!strcmp(argv[i], "--adaptivemin"))
+            options.adaptiveMinSamples = atoi(OptionValue(argc, argv, &i));
+        else if (!strcmp(argv[i], "--progressive"))
+            options.progressive = true;
+        else if (!strcmp(argv[i], "--deadline"))
+            options.renderDeadline = atof(OptionValue(argc, argv, &i));
+        else if (!strcmp(argv[i], "--backing"))
+            options.filmBackingFile = OptionValue(argc, argv, &i);
+        else if (!strcmp(argv[i], "--checkpoint"))
+            options.checkpointFile = OptionValue(argc, argv, &i);
+        else if (!strcmp(argv[i], "--checkpointinterval"))
+            options.checkpointInterval = atof(OptionValue(argc, argv, &i));
+        else if (!strcmp(argv[i], "--preview"))
+            options.previewSocket = OptionValue(argc, argv, &i);
+        else if (!strcmp(argv[i], "--help") || !strcmp(argv[i], "-h"))
+            usage();
+        else if (argv[i][0] == '-' && argv[i][1] == '-') {
+            std::string msg = std::string("unknown option ") + argv[i];
+            usage(msg.c_str());
+        } else
+            filenames.emplace_back(argv[i]);
     }
 
     if(filenames.empty()){
         // require at least one file. Don't support reading from stdin
-        std::cout << "No filename was given!" << std::endl;
-        return -1;
-    }else{
-        pbrtParseFile(filenames.at(0));
-    }*/
+        usage("no scene file was given");
+    }
 
-    Options options;
     pbrtInit(options);
 
-    parse();
+    bool ok = true;
+    for (const std::string &f : filenames)
+        if (!pbrtParseFile(f)) {
+            ok = false;
+            break;
+        }
 
     pbrtCleanup();
 
 
 
-    return 0;
+    return ok ? 0 : 1;
 }
-
@@ -6,6 +6,8 @@
 #include "interaction.h"
 #include "reflection.h"
 #include "texture.h"
+#include "paramset.h"
+#include "textures/constant.h"
 
 namespace pbrt{
 
@@ -21,4 +23,19 @@ namespace pbrt{
                 si->bsdf->Add(ARENA_ALLOC(arena, LambertianReflection)(r));
         }
     }
+
+    MatteMaterial *CreateMatteMaterial(const ParamSet &params) {
+        // Only constant values are supported; named textures are not
+        if (!params.FindTexture("Kd").empty() ||
+            !params.FindTexture("sigma").empty())
+            std::cerr << "Textures are not supported; using constant matte "
+                         "parameters" << std::endl;
+        std::shared_ptr<Texture<Spectrum>> Kd =
+                std::make_shared<ConstantTexture<Spectrum>>(
+                        params.FindOneSpectrum("Kd", Spectrum(0.5f)));
+        std::shared_ptr<Texture<float>> sigma =
+                std::make_shared<ConstantTexture<float>>(
+                        params.FindOneFloat("sigma", 0.f));
+        return new MatteMaterial(Kd, sigma);
+    }
 }
\ No newline at end of file
@@ -23,5 +23,7 @@ namespace pbrt{
         std::shared_ptr<Texture<Spectrum>> Kd;
         std::shared_ptr<Texture<float>> sigma;
     };
+
+    MatteMaterial *CreateMatteMaterial(const ParamSet &params);
 }
 #endif //PBRT_WHITTED_MATTE_H
@@ -0,0 +1,77 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#include "bluenoisesampler.h"
+#include "paramset.h"
+namespace pbrt {
+    BlueNoiseSampler::BlueNoiseSampler(int64_t samplesPerPixel, int nSampledDimensions)
+            : PixelSampler(samplesPerPixel, nSampledDimensions) {}
+
+    void BlueNoiseSampler::ShiftedSobol(int dim, int64_t n, float *samples) const {
+        // Dimensions cycle through the masks; each pass over them offsets
+        // the mask lookup along the R2 sequence, so no two dimensions share
+        // a shift pattern
+        int pass = dim / NumBlueNoiseTextures;
+        Point2i offset((int)(pass * 0.7548776662f * BlueNoiseResolution),
+                       (int)(pass * 0.5698402909f * BlueNoiseResolution));
+        uint32_t shift = (uint32_t)(BlueNoise(dim % NumBlueNoiseTextures,
+                                              currentPixel + Vector2i(offset.x, offset.y)) *
+                                    0x1p32f);
+        // Adding the shift in 32-bit fixed point wraps around exactly
+        for (int64_t i = 0; i < n; ++i)
+            samples[i] = std::min((SobolSampleBits(i, dim) + shift) * 0x1p-32f,
+                                  OneMinusEpsilon);
+    }
+
+    void BlueNoiseSampler::StartPixel(const Point2i &p) {
+        PixelSampler::StartPixel(p);
+        // 2D dimensions take Sobol dimensions in pairs, then the 1D ones and
+        // the arrays follow; past the Sobol tables, values are random
+        int dim = 0;
+        auto fill = [&](int64_t n, float *samples) {
+            if (dim < NumSobolDimensions)
+                ShiftedSobol(dim, n, samples);
+            else {
+                ReportRandomDimensions(NumSobolDimensions);
+                for (int64_t i = 0; i < n; ++i) samples[i] = rng.UniformFloat();
+            }
+            ++dim;
+        };
+        std::vector<float> x(samplesPerPixel), y(samplesPerPixel);
+        for (size_t i = 0; i < samples2D.size(); ++i) {
+            fill(samplesPerPixel, &x[0]);
+            fill(samplesPerPixel, &y[0]);
+            for (int64_t j = 0; j < samplesPerPixel; ++j)
+                samples2D[i][j] = Point2f(x[j], y[j]);
+        }
+        for (size_t i = 0; i < samples1D.size(); ++i)
+            fill(samplesPerPixel, &samples1D[i][0]);
+
+        for (size_t i = 0; i < samples1DArraySizes.size(); ++i)
+            fill(samples1DArraySizes[i] * samplesPerPixel,
+                 &sampleArray1D[array1DStarts[i]]);
+        for (size_t i = 0; i < samples2DArraySizes.size(); ++i) {
+            int64_t n = samples2DArraySizes[i] * samplesPerPixel;
+            x.resize(n);
+            y.resize(n);
+            fill(n, &x[0]);
+            fill(n, &y[0]);
+            Point2f *array = &sampleArray2D[array2DStarts[i]];
+            for (int64_t j = 0; j < n; ++j) array[j] = Point2f(x[j], y[j]);
+        }
+        SeekRNG(rng, 0);
+    }
+
+    std::unique_ptr<Sampler> BlueNoiseSampler::Clone(int seed) {
+        auto *bns = new BlueNoiseSampler(*this);
+        bns->seed = seed;
+        return std::unique_ptr<Sampler>(bns);
+    }
+
+    Sampler *CreateBlueNoiseSampler(const ParamSet &params) {
+        int ns = params.FindOneInt("pixelsamples", 4);
+        if (PbrtOptions.pixelSamples > 0) ns = PbrtOptions.pixelSamples;
+        return new BlueNoiseSampler(ns);
+    }
+}
@@ -0,0 +1,33 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#ifndef PBRT_WHITTED_BLUENOISESAMPLER_H
+#define PBRT_WHITTED_BLUENOISESAMPLER_H
+
+#include <core/sampler.h>
+#include "lowdiscrepancy.h"
+#include "bluenoise.h"
+#include <memory>
+
+namespace pbrt{
+    // For low sample counts. Every pixel uses the same Sobol points, each
+    // dimension toroidally shifted by the pixel's value in a blue-noise
+    // mask. Within a pixel the samples stay stratified, while neighboring
+    // pixels get very different shifts. That pushes the error to high
+    // frequencies, where it is much less visible than white noise.
+    class BlueNoiseSampler : public PixelSampler{
+    public:
+        BlueNoiseSampler(int64_t samplesPerPixel, int nSampledDimensions = 4);
+        void StartPixel(const Point2i &p);
+        std::unique_ptr<Sampler> Clone(int seed);
+
+    private:
+        // Sobol dimension _dim_ for the current pixel, shifted by the mask
+        void ShiftedSobol(int dim, int64_t n, float *samples) const;
+    };
+    Sampler *CreateBlueNoiseSampler(const ParamSet &params);
+
+}
+
+#endif //PBRT_WHITTED_BLUENOISESAMPLER_H
@@ -0,0 +1,106 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#include "halton.h"
+#include "paramset.h"
+#include <mutex>
+namespace pbrt {
+    static constexpr int kMaxResolution = 128;
+
+    std::vector<uint16_t> HaltonSampler::radicalInversePermutations;
+    static std::once_flag permutationsComputed;
+
+    static void extendedGCD(uint64_t a, uint64_t b, int64_t *x, int64_t *y) {
+        if (b == 0) {
+            *x = 1;
+            *y = 0;
+            return;
+        }
+        int64_t d = a / b, xp, yp;
+        extendedGCD(b, a % b, &xp, &yp);
+        *x = yp;
+        *y = xp - (d * yp);
+    }
+
+    static uint64_t multiplicativeInverse(int64_t a, int64_t n) {
+        int64_t x, y;
+        extendedGCD(a, n, &x, &y);
+        return Mod(x, n);
+    }
+
+    HaltonSampler::HaltonSampler(int64_t samplesPerPixel, const Bounds2i &sampleBounds)
+            : GlobalSampler(samplesPerPixel) {
+        // The permutations are shared by all instances and fixed, so that
+        // every render sees the same sequence; samplers may be made by
+        // several contexts at once
+        std::call_once(permutationsComputed, []() {
+            RNG rng;
+            radicalInversePermutations = ComputeRadicalInversePermutations(rng);
+        });
+
+        // Find radical inverse base scales and exponents that cover sampling area
+        Vector2i res = sampleBounds.pMax - sampleBounds.pMin;
+        for (int i = 0; i < 2; ++i) {
+            int base = (i == 0) ? 2 : 3;
+            int scale = 1, exp = 0;
+            while (scale < std::min(res[i], kMaxResolution)) {
+                scale *= base;
+                ++exp;
+            }
+            baseScales[i] = scale;
+            baseExponents[i] = exp;
+        }
+
+        // Compute stride in samples for visiting each pixel area
+        sampleStride = baseScales[0] * baseScales[1];
+
+        // Compute multiplicative inverses for _baseScales_
+        multInverse[0] = multiplicativeInverse(baseScales[1], baseScales[0]);
+        multInverse[1] = multiplicativeInverse(baseScales[0], baseScales[1]);
+    }
+
+    std::unique_ptr<Sampler> HaltonSampler::Clone(int seed) {
+        auto *hs = new HaltonSampler(*this);
+        hs->seed = seed;
+        return std::unique_ptr<Sampler>(hs);
+    }
+
+    int64_t HaltonSampler::GetIndexForSample(int64_t sampleNum) const {
+        if (currentPixel != pixelForOffset) {
+            // Compute Halton sample offset for _currentPixel_ by the Chinese
+            // remainder theorem
+            offsetForCurrentPixel = 0;
+            if (sampleStride > 1) {
+                Point2i pm(Mod(currentPixel[0], kMaxResolution),
+                           Mod(currentPixel[1], kMaxResolution));
+                for (int i = 0; i < 2; ++i) {
+                    uint64_t dimOffset =
+                            (i == 0)
+                            ? InverseRadicalInverse<2>(pm[i], baseExponents[i])
+                            : InverseRadicalInverse<3>(pm[i], baseExponents[i]);
+                    offsetForCurrentPixel +=
+                            dimOffset * (sampleStride / baseScales[i]) * multInverse[i];
+                }
+                offsetForCurrentPixel %= sampleStride;
+            }
+            pixelForOffset = currentPixel;
+        }
+        return offsetForCurrentPixel + sampleNum * sampleStride;
+    }
+
+    float HaltonSampler::SampleDimension(int64_t index, int dim) const {
+        if (dim == 0)
+            return RadicalInverse(dim, index >> baseExponents[0]);
+        else if (dim == 1)
+            return RadicalInverse(dim, index / baseScales[1]);
+        else
+            return ScrambledRadicalInverse(dim, index, PermutationForDimension(dim));
+    }
+
+    Sampler *CreateHaltonSampler(const ParamSet &params, const Bounds2i &sampleBounds) {
+        int ns = params.FindOneInt("pixelsamples", 16);
+        if (PbrtOptions.pixelSamples > 0) ns = PbrtOptions.pixelSamples;
+        return new HaltonSampler(ns, sampleBounds);
+    }
+}
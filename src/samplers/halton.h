@@ -0,0 +1,42 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#ifndef PBRT_WHITTED_HALTON_H
+#define PBRT_WHITTED_HALTON_H
+
+#include <core/sampler.h>
+#include "lowdiscrepancy.h"
+#include <limits>
+#include <memory>
+
+namespace pbrt{
+    // Halton sequence over the whole image. The first two dimensions
+    // (bases 2 and 3) are scaled so that a window of at most 128x128 pixels
+    // is covered exactly once by every _sampleStride_ consecutive points.
+    class HaltonSampler : public GlobalSampler{
+    public:
+        HaltonSampler(int64_t samplesPerPixel, const Bounds2i &sampleBounds);
+        std::unique_ptr<Sampler> Clone(int seed);
+        int64_t GetIndexForSample(int64_t sampleNum) const;
+        float SampleDimension(int64_t index, int dimension) const;
+        int MaxDimension() const { return PrimeTableSize; }
+
+    private:
+        static std::vector<uint16_t> radicalInversePermutations;
+        Point2i baseScales, baseExponents;
+        int sampleStride;
+        int multInverse[2];
+        mutable Point2i pixelForOffset = Point2i(std::numeric_limits<int>::max(),
+                                                 std::numeric_limits<int>::max());
+        mutable int64_t offsetForCurrentPixel;
+
+        const uint16_t *PermutationForDimension(int dim) const {
+            return &radicalInversePermutations[PrimeSums[dim]];
+        }
+    };
+    Sampler *CreateHaltonSampler(const ParamSet &params, const Bounds2i &sampleBounds);
+
+}
+
+#endif //PBRT_WHITTED_HALTON_H
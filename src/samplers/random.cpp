@@ -3,28 +3,48 @@
 //
 
 #include "random.h"
+#include "paramset.h"
 namespace pbrt {
-    RandomSampler::RandomSampler(int ns, int seed) : Sampler(ns), rng(seed) {}
+    RandomSampler::RandomSampler(int ns, int seed) : Sampler(ns) {
+        this->seed = seed;
+    }
 
     std::unique_ptr<Sampler> RandomSampler::Clone(int seed) {
         auto *rs = new RandomSampler(*this);
-        rs->rng.SetSequence(seed);
+        rs->seed = seed;
         return std::unique_ptr<Sampler>(rs);
     }
 
     void RandomSampler::StartPixel(const Point2i &p) {
         Sampler::StartPixel(p);
+        Seek(samplesPerPixel);
+        for (float &v : sampleArray1D) v = Next();
+        for (Point2f &v : sampleArray2D) v = {Next(), Next()};
+        Seek(0);
+    }
+
+    bool RandomSampler::SetSampleNumber(int64_t sampleNum) {
+        bool more = Sampler::SetSampleNumber(sampleNum);
+        Seek(currentPixelSampleIndex);
+        return more;
+    }
+
+    void RandomSampler::Seek(int64_t block) {
+        SeekRNG(rng, block);
+        bufferPos = BufferSize;
     }
 
     float RandomSampler::Get1D() {
-        return rng.UniformFloat();
+        return Next();
     }
 
     Point2f RandomSampler::Get2D() {
-        return {rng.UniformFloat(), rng.UniformFloat()};
+        return {Next(), Next()};
     }
 
-    Sampler *CreateRandomSampler() {
-        return new RandomSampler(4);
+    Sampler *CreateRandomSampler(const ParamSet &params) {
+        int ns = params.FindOneInt("pixelsamples", 4);
+        if (PbrtOptions.pixelSamples > 0) ns = PbrtOptions.pixelSamples;
+        return new RandomSampler(ns);
     }
 }
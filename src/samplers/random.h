@@ -14,15 +14,29 @@ namespace pbrt{
     public:
         RandomSampler(int ns, int seed = 0);
         void StartPixel(const Point2i &);
+        bool SetSampleNumber(int64_t sampleNum);
         float Get1D();
         Point2f Get2D();
         std::unique_ptr<Sampler> Clone(int seed);
 
     private:
-        RNG rng;
+        void Seek(int64_t block);
+        // The pixel's PCG32 stream, generated in bulk; the buffer is
+        // dropped whenever the stream is moved, so keep it short
+        float Next() {
+            if (bufferPos == BufferSize) {
+                rng.UniformFloat(buffer, BufferSize);
+                bufferPos = 0;
+            }
+            return buffer[bufferPos++];
+        }
 
+        RNG8 rng;
+        static constexpr int BufferSize = 2 * RNG8::Width;
+        float buffer[BufferSize];
+        int bufferPos = BufferSize;
     };
-    Sampler *CreateRandomSampler();
+    Sampler *CreateRandomSampler(const ParamSet &params);
 
 }
 
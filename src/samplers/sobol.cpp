@@ -0,0 +1,105 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#include "sobol.h"
+#include "paramset.h"
+#include "random.h"
+namespace pbrt {
+    SobolSampler::SobolSampler(int64_t samplesPerPixel, const Bounds2i &sampleBounds)
+            : GlobalSampler(RoundUpPow2(samplesPerPixel)), sampleBounds(sampleBounds) {
+        if (!IsPowerOf2(samplesPerPixel))
+            std::cerr << "Non power-of-two sample count rounded up to "
+                      << this->samplesPerPixel << " for Sobol sampler" << std::endl;
+        Vector2i extent = sampleBounds.Diagonal();
+        resolution = RoundUpPow2(std::max(extent.x, extent.y));
+        log2Resolution = Log2Int(resolution);
+        int m = log2Resolution;
+        // _CreateSobolSampler()_ keeps _2m_ within the index bits
+        if (2 * m + Log2Int(this->samplesPerPixel) > SobolMatrixSize)
+            std::cerr << "Too many pixels and samples for the Sobol sampler; "
+                         "samples will repeat" << std::endl;
+
+        // Column _c_ of the first two generator matrices, truncated to the
+        // top _m_ bits of x and y, packed as the pixel bits (x << m) | y
+        auto pixelBits = [&](int c) -> uint64_t {
+            if (m == 0) return 0;
+            uint64_t x = SobolMatrices32[c] >> (32 - m);
+            uint64_t y = SobolMatrices32[SobolMatrixSize + c] >> (32 - m);
+            return (x << m) | y;
+        };
+        for (int c = 0; c < SobolMatrixSize; ++c)
+            sampleToPixel[c] = c + 2 * m < SobolMatrixSize ? pixelBits(c + 2 * m) : 0;
+
+        // Invert the square matrix of the low _2m_ index bits over GF(2).
+        // Both dimensions form a (0,2)-sequence, so it is always regular.
+        int n = 2 * m;
+        uint64_t rows[SobolMatrixSize], inverse[SobolMatrixSize];
+        for (int r = 0; r < n; ++r) {
+            rows[r] = 0;
+            for (int c = 0; c < n; ++c)
+                if (pixelBits(c) & (1ull << r)) rows[r] |= 1ull << c;
+            inverse[r] = 1ull << r;
+        }
+        for (int c = 0; c < n; ++c) {
+            int pivot = c;
+            while (!(rows[pivot] & (1ull << c))) ++pivot;
+            std::swap(rows[c], rows[pivot]);
+            std::swap(inverse[c], inverse[pivot]);
+            for (int r = 0; r < n; ++r)
+                if (r != c && (rows[r] & (1ull << c))) {
+                    rows[r] ^= rows[c];
+                    inverse[r] ^= inverse[c];
+                }
+        }
+        // Store by columns so that lookups XOR one word per set pixel bit
+        for (int k = 0; k < SobolMatrixSize; ++k) {
+            pixelToIndex[k] = 0;
+            for (int r = 0; r < n; ++r)
+                if (k < n && (inverse[r] & (1ull << k))) pixelToIndex[k] |= 1ull << r;
+        }
+    }
+
+    std::unique_ptr<Sampler> SobolSampler::Clone(int seed) {
+        auto *ss = new SobolSampler(*this);
+        ss->seed = seed;
+        return std::unique_ptr<Sampler>(ss);
+    }
+
+    int64_t SobolSampler::GetIndexForSample(int64_t sampleNum) const {
+        int m2 = 2 * log2Resolution;
+        Vector2i p = currentPixel - sampleBounds.pMin;
+        uint64_t pixel = ((uint64_t)p.x << log2Resolution) | (uint64_t)p.y;
+        // Remove the pixel bits contributed by the high (sample number)
+        // index bits, then solve for the low ones
+        for (uint64_t s = sampleNum, c = 0; s && c < SobolMatrixSize; s >>= 1, ++c)
+            if (s & 1) pixel ^= sampleToPixel[c];
+        uint64_t index = (uint64_t)sampleNum << m2;
+        for (int k = 0; pixel; pixel >>= 1, ++k)
+            if (pixel & 1) index ^= pixelToIndex[k];
+        return index;
+    }
+
+    float SobolSampler::SampleDimension(int64_t index, int dim) const {
+        float s = SobolSample(index, dim);
+        // Remap Sobol$'$ dimensions used for pixel samples
+        if (dim == 0 || dim == 1) {
+            s = s * resolution + sampleBounds.pMin[dim];
+            s = Clamp(s - currentPixel[dim], (float)0, OneMinusEpsilon);
+        }
+        return s;
+    }
+
+    Sampler *CreateSobolSampler(const ParamSet &params, const Bounds2i &sampleBounds) {
+        int ns = params.FindOneInt("pixelsamples", 16);
+        if (PbrtOptions.pixelSamples > 0) ns = PbrtOptions.pixelSamples;
+        // Both pixel coordinates must fit in the index bits together
+        Vector2i extent = sampleBounds.Diagonal();
+        if (std::max(extent.x, extent.y) > 1 << (SobolMatrixSize / 2)) {
+            std::cerr << "Image too large for the Sobol sampler; using random"
+                      << std::endl;
+            return CreateRandomSampler(params);
+        }
+        return new SobolSampler(ns, sampleBounds);
+    }
+}
@@ -0,0 +1,38 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#ifndef PBRT_WHITTED_SOBOL_H
+#define PBRT_WHITTED_SOBOL_H
+
+#include <core/sampler.h>
+#include "lowdiscrepancy.h"
+#include <memory>
+
+namespace pbrt{
+    // Sobol sequence over the whole image: the first two dimensions are
+    // scaled to cover the sample bounds, and each pixel's samples are the
+    // sequence points that land in it.
+    class SobolSampler : public GlobalSampler{
+    public:
+        SobolSampler(int64_t samplesPerPixel, const Bounds2i &sampleBounds);
+        std::unique_ptr<Sampler> Clone(int seed);
+        int64_t GetIndexForSample(int64_t sampleNum) const;
+        float SampleDimension(int64_t index, int dimension) const;
+        int MaxDimension() const { return NumSobolDimensions; }
+
+    private:
+        const Bounds2i sampleBounds;
+        int resolution, log2Resolution;
+        // Maps the pixel bits of a sample to the low _2 * log2Resolution_
+        // index bits (the inverse of the first two generator matrices,
+        // truncated to the pixel grid), and the sample number's index bits
+        // to their contribution to the pixel bits
+        uint64_t pixelToIndex[SobolMatrixSize];
+        uint64_t sampleToPixel[SobolMatrixSize];
+    };
+    Sampler *CreateSobolSampler(const ParamSet &params, const Bounds2i &sampleBounds);
+
+}
+
+#endif //PBRT_WHITTED_SOBOL_H
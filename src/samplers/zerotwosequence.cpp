@@ -0,0 +1,46 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#include "zerotwosequence.h"
+#include "paramset.h"
+namespace pbrt {
+    ZeroTwoSequenceSampler::ZeroTwoSequenceSampler(int64_t samplesPerPixel,
+                                                   int nSampledDimensions)
+            : PixelSampler(RoundUpPow2(samplesPerPixel), nSampledDimensions) {
+        if (!IsPowerOf2(samplesPerPixel))
+            std::cerr << "Pixel samples being rounded up to power of 2 (from "
+                      << samplesPerPixel << " to " << this->samplesPerPixel << ")"
+                      << std::endl;
+    }
+
+    void ZeroTwoSequenceSampler::StartPixel(const Point2i &p) {
+        PixelSampler::StartPixel(p);
+        // Generate 1D and 2D pixel sample components using $(0,2)$-sequence
+        for (size_t i = 0; i < samples1D.size(); ++i)
+            VanDerCorput(1, samplesPerPixel, &samples1D[i][0], rng);
+        for (size_t i = 0; i < samples2D.size(); ++i)
+            Sobol2D(1, samplesPerPixel, &samples2D[i][0], rng);
+
+        // Generate 1D and 2D array samples using $(0,2)$-sequence
+        for (size_t i = 0; i < samples1DArraySizes.size(); ++i)
+            VanDerCorput(samples1DArraySizes[i], samplesPerPixel,
+                         &sampleArray1D[array1DStarts[i]], rng);
+        for (size_t i = 0; i < samples2DArraySizes.size(); ++i)
+            Sobol2D(samples2DArraySizes[i], samplesPerPixel,
+                    &sampleArray2D[array2DStarts[i]], rng);
+        SeekRNG(rng, 0);
+    }
+
+    std::unique_ptr<Sampler> ZeroTwoSequenceSampler::Clone(int seed) {
+        auto *lds = new ZeroTwoSequenceSampler(*this);
+        lds->seed = seed;
+        return std::unique_ptr<Sampler>(lds);
+    }
+
+    Sampler *CreateZeroTwoSequenceSampler(const ParamSet &params) {
+        int ns = params.FindOneInt("pixelsamples", 16);
+        if (PbrtOptions.pixelSamples > 0) ns = PbrtOptions.pixelSamples;
+        return new ZeroTwoSequenceSampler(ns);
+    }
+}
@@ -0,0 +1,27 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#ifndef PBRT_WHITTED_ZEROTWOSEQUENCE_H
+#define PBRT_WHITTED_ZEROTWOSEQUENCE_H
+
+#include <core/sampler.h>
+#include "lowdiscrepancy.h"
+#include <memory>
+
+namespace pbrt{
+    // Padded (0,2)-sequence: each of the first _nSampledDimensions_ 1D and
+    // 2D dimensions gets its own randomly scrambled (0,2)-sequence per
+    // pixel, and the dimensions are decorrelated by shuffling.
+    class ZeroTwoSequenceSampler : public PixelSampler{
+    public:
+        ZeroTwoSequenceSampler(int64_t samplesPerPixel, int nSampledDimensions = 4);
+        void StartPixel(const Point2i &p);
+        std::unique_ptr<Sampler> Clone(int seed);
+        int RoundCount(int count) const { return RoundUpPow2(count); }
+    };
+    Sampler *CreateZeroTwoSequenceSampler(const ParamSet &params);
+
+}
+
+#endif //PBRT_WHITTED_ZEROTWOSEQUENCE_H
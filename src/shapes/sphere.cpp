@@ -3,6 +3,7 @@
 //
 
 #include "sphere.h"
+#include "paramset.h"
 namespace pbrt{
 
     Bounds3f Sphere::ObjectBound() const {
@@ -86,8 +87,30 @@ namespace pbrt{
         return true;
     }
 
-    std::shared_ptr<Shape> CreateSphereShape(const Transform *o2w, const Transform *w2o) {
-        return std::make_shared<Sphere>(o2w, w2o, 0.3f, -0.3f,
-                                        0.3f, 360.f);
+    bool Sphere::IntersectP(const Ray &r, bool) const {
+        Ray ray = (*WorldToObject)(r);
+
+        float ox(ray.o.x), oy(ray.o.y), oz(ray.o.z);
+        float dx(ray.d.x), dy(ray.d.y), dz(ray.d.z);
+        float a = dx * dx + dy * dy + dz * dz;
+        float b = 2 * (dx * ox + dy * oy + dz * oz);
+        float c = ox * ox + oy * oy + oz * oz - float(radius) * float(radius);
+
+        float t0, t1;
+        if (!Quadratic(a, b, c, &t0, &t1)) return false;
+
+        // Same hit as _Intersect()_, without computing the interaction
+        if (t0 > ray.tMax || t1 <= 0) return false;
+        return t0 > 0 || t1 <= ray.tMax;
+    }
+
+    std::shared_ptr<Shape> CreateSphereShape(const Transform *o2w, const Transform *w2o,
+                                             const ParamSet &params) {
+        float radius = params.FindOneFloat("radius", 1.f);
+        float zmin = params.FindOneFloat("zmin", -radius);
+        float zmax = params.FindOneFloat("zmax", radius);
+        float phimax = params.FindOneFloat("phimax", 360.f);
+        return std::make_shared<Sphere>(o2w, w2o, radius, zmin,
+                                        zmax, phimax);
     }
 }
\ No newline at end of file
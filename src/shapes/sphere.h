@@ -23,6 +23,7 @@ namespace pbrt{
 
         bool Intersect(const Ray &r, float *tHit, SurfaceInteraction *isect,
                        bool testAlphaTexture) const;
+        bool IntersectP(const Ray &r, bool testAlphaTexture) const;
 
     private:
         const float radius;
@@ -31,6 +32,7 @@ namespace pbrt{
 
     };
     std::shared_ptr<Shape> CreateSphereShape(const Transform *o2w,
-                                             const Transform *w2o);
+                                             const Transform *w2o,
+                                             const ParamSet &params);
     }
 #endif //PBRT_WHITTED_SPHERE_H
@@ -0,0 +1,74 @@
+#include <cstdio>
+#include "api.h"
+#include "parser.h"
+#include "binaryscene.h"
+#include "test.h"
+
+using namespace pbrt;
+
+// A scene converted to a binary scene batches its shapes and must render
+// the same image as the text it came from.
+
+// Renders _sceneFile_ in a context of its own to _imageFile_
+static bool RenderScene(const std::string &sceneFile,
+                        const std::string &imageFile) {
+    Options options;
+    options.imageFile = imageFile;
+    RenderContext *ctx = pbrtCreateContext(options);
+    pbrtSetContext(ctx);
+    bool ok = pbrtParseFile(sceneFile);
+    pbrtDestroyContext(ctx);
+    return ok;
+}
+
+static void TestBinaryScene() {
+    // Spheres that differ only in position and radius become one batch
+    std::ofstream("pbrt_test.pbrt") << R"(
+LookAt 0 0 10  0 0 0  0 1 0
+Camera "orthographic" "float screenwindow" [-3 3 -2 2]
+Film "image" "integer xresolution" [48] "integer yresolution" [32]
+Sampler "random" "integer pixelsamples" [4]
+Integrator "whitted"
+WorldBegin
+LightSource "point" "rgb I" [40 40 40] "point from" [3 4 8]
+Material "matte" "rgb Kd" [.8 .3 .2]
+AttributeBegin
+  Translate -1 0 0
+  Shape "sphere" "float radius" [0.5]
+AttributeEnd
+AttributeBegin
+  Translate 1 0.5 0
+  Shape "sphere" "float radius" [0.75]
+AttributeEnd
+AttributeBegin
+  Material "matte" "rgb Kd" [.2 .8 .3]
+  Translate 0 -1 -1
+  Shape "sphere" "float radius" [1]
+AttributeEnd
+WorldEnd
+)";
+    CHECK(ConvertToBinaryScene("pbrt_test.pbrt", "pbrt_test.pbrtb"));
+    CHECK(BinaryScene::IsBinaryScene("pbrt_test.pbrtb"));
+    CHECK(!BinaryScene::IsBinaryScene("pbrt_test.pbrt"));
+    std::unique_ptr<BinaryScene> scene = BinaryScene::Open("pbrt_test.pbrtb");
+    CHECK(scene && scene->ShapeBatches().size() == 2);
+
+    CHECK(RenderScene("pbrt_test.pbrt", "pbrt_test_text.pfm"));
+    CHECK(RenderScene("pbrt_test.pbrtb", "pbrt_test_binary.pfm"));
+    std::string text = ReadWholeFile("pbrt_test_text.pfm");
+    CHECK(!text.empty() && text == ReadWholeFile("pbrt_test_binary.pfm"));
+
+    remove("pbrt_test.pbrt");
+    remove("pbrt_test.pbrtb");
+    remove("pbrt_test_text.pfm");
+    remove("pbrt_test_binary.pfm");
+}
+
+int main() {
+    pbrtInit(Options());
+
+    TestBinaryScene();
+
+    pbrtCleanup();
+    return TestResult();
+}
@@ -0,0 +1,113 @@
+#include <vector>
+#include <cstdio>
+#include "api.h"
+#include "checkpoint.h"
+#include "film.h"
+#include "paramset.h"
+#include "filters/box.h"
+#include "test.h"
+
+using namespace pbrt;
+
+// Interrupting a tiled render and resuming it from its checkpoint must
+// give the same image, and a checkpoint of another render is ignored.
+
+// Renders a gradient into _filename_ tile by tile, merging through a
+// checkpoint at _checkpointFile_ if one is given. With _stopAfter_ >= 0,
+// returns after that many tiles as if the render had been interrupted.
+// Each pixel's state counts the tiles that rendered it.
+static bool RenderTiles(const std::string &filename,
+                        const std::string &checkpointFile, uint64_t renderHash,
+                        int stopAfter, std::vector<uint32_t> *state,
+                        bool *resumed = nullptr) {
+    const int tileSize = 16, spp = 4;
+    Film film(Point2i(100, 60), Bounds2f(Point2f(0, 0), Point2f(1, 1)),
+              std::unique_ptr<Filter>(CreateBoxFilter(ParamSet())), filename, 1);
+    Bounds2i sampleBounds = film.GetSampleBounds();
+    Point2i nTiles((sampleBounds.Diagonal().x + tileSize - 1) / tileSize,
+                   (sampleBounds.Diagonal().y + tileSize - 1) / tileSize);
+    film.SetTiling(tileSize);
+    state->assign(sampleBounds.Area(), 0);
+
+    std::unique_ptr<Checkpoint> checkpoint;
+    if (!checkpointFile.empty())
+        checkpoint.reset(new Checkpoint(
+                checkpointFile, 0, &film, sampleBounds, tileSize, spp, 1,
+                renderHash, {{state->data(), sizeof(uint32_t)}}));
+    if (resumed) *resumed = checkpoint && checkpoint->Resumed();
+
+    int nRendered = 0;
+    for (int ty = 0; ty < nTiles.y; ++ty)
+        for (int tx = 0; tx < nTiles.x; ++tx) {
+            int tileIndex = ty * nTiles.x + tx;
+            Point2i p0 = sampleBounds.pMin + Vector2i(tx, ty) * tileSize;
+            Bounds2i tileBounds(p0, Min(p0 + Vector2i(tileSize, tileSize),
+                                        sampleBounds.pMax));
+            if (checkpoint && checkpoint->TileDone(tileIndex)) {
+                film.MergeFilmTile(film.GetFilmTile(tileBounds));
+                continue;
+            }
+            if (stopAfter >= 0 && nRendered++ == stopAfter) return false;
+
+            std::unique_ptr<FilmTile> tile = film.GetFilmTile(tileBounds);
+            for (Point2i p : tileBounds) {
+                for (int s = 0; s < spp; ++s) {
+                    Point2f pFilm(p.x + ((s & 1) ? 0.25f : 0.75f),
+                                  p.y + ((s & 2) ? 0.3f : 0.6f));
+                    float rgb[3] = {pFilm.x / 100, pFilm.y / 60, 0.5f};
+                    tile->AddSample(pFilm, Spectrum::FromRGB(rgb));
+                }
+                Vector2i d = p - sampleBounds.pMin;
+                ++(*state)[d.y * sampleBounds.Diagonal().x + d.x];
+            }
+            if (checkpoint)
+                checkpoint->MergeFilmTile(std::move(tile), tileIndex);
+            else
+                film.MergeFilmTile(std::move(tile));
+        }
+    if (checkpoint) checkpoint->Wait();
+    bool written = film.WriteImage();
+    if (checkpoint && written) checkpoint->Finish();
+    return written;
+}
+
+static void TestCheckpoint() {
+    const std::string checkpointFile = "pbrt_test.checkpoint";
+    std::vector<uint32_t> referenceState, state;
+    remove(checkpointFile.c_str());
+    CHECK(RenderTiles("pbrt_test_ref.pfm", "", 1, -1, &referenceState));
+
+    // Interrupted, then resumed: the same image, and no pixel rendered twice
+    bool resumed;
+    CHECK(!RenderTiles("pbrt_test_ckpt.pfm", checkpointFile, 1, 9, &state,
+                       &resumed));
+    CHECK(!resumed);
+    CHECK(RenderTiles("pbrt_test_ckpt.pfm", checkpointFile, 1, -1, &state,
+                      &resumed));
+    CHECK(resumed);
+    CHECK(state == referenceState);
+    CHECK(ReadWholeFile("pbrt_test_ckpt.pfm") ==
+          ReadWholeFile("pbrt_test_ref.pfm"));
+    // Finish() removes the file once the image is written
+    CHECK(!std::ifstream(checkpointFile));
+
+    // A checkpoint saved for another render is not resumed
+    CHECK(!RenderTiles("pbrt_test_ckpt.pfm", checkpointFile, 1, 3, &state));
+    CHECK(RenderTiles("pbrt_test_ckpt.pfm", checkpointFile, 2, -1, &state,
+                      &resumed));
+    CHECK(!resumed);
+    CHECK(state == referenceState);
+
+    remove(checkpointFile.c_str());
+    remove("pbrt_test_ref.pfm");
+    remove("pbrt_test_ckpt.pfm");
+}
+
+int main() {
+    pbrtInit(Options());
+
+    TestCheckpoint();
+
+    pbrtCleanup();
+    return TestResult();
+}
@@ -0,0 +1,137 @@
+#include <cmath>
+#include <memory>
+#include <vector>
+#include "film.h"
+#include "rng.h"
+#include "filters/box.h"
+#include "filters/gaussian.h"
+#include "filters/mitchell.h"
+#include "filters/sinc.h"
+#include "test.h"
+
+using namespace pbrt;
+
+// Separable filters must match their 2D form, film tiles must splat them
+// the same way either way, and filter importance sampling must draw
+// offsets in proportion to the filter.
+
+static std::vector<std::unique_ptr<Filter>> TestFilters() {
+    std::vector<std::unique_ptr<Filter>> filters;
+    filters.emplace_back(new BoxFilter(Vector2f(0.5f, 0.5f)));
+    filters.emplace_back(new BoxFilter(Vector2f(1.5f, 0.75f)));
+    filters.emplace_back(new GaussianFilter(Vector2f(2, 1.5f), 2));
+    filters.emplace_back(new MitchellFilter(Vector2f(2, 1.5f), 1.f / 3.f, 1.f / 3.f));
+    filters.emplace_back(new LanczosSincFilter(Vector2f(4, 3), 3));
+    return filters;
+}
+
+static void TestSeparable() {
+    for (const std::unique_ptr<Filter> &filter : TestFilters()) {
+        CHECK(filter->IsSeparable());
+        int nBad = 0;
+        for (int y = -20; y <= 20; ++y)
+            for (int x = -20; x <= 20; ++x) {
+                Point2f p(x / 20.f * filter->radius.x, y / 20.f * filter->radius.y);
+                float f = filter->Evaluate(p);
+                float f1 = filter->Evaluate1D(p.x, 0) * filter->Evaluate1D(p.y, 1);
+                if (std::abs(f - f1) > 1e-6f * std::max(1.f, std::abs(f))) ++nBad;
+            }
+        CHECK(nBad == 0);
+    }
+}
+
+static void TestSplats() {
+    // Tables as the film builds them
+    const int size = 16;
+    for (const std::unique_ptr<Filter> &filter : TestFilters()) {
+        float table[size * size], tableX[size], tableY[size];
+        for (int y = 0; y < size; ++y)
+            for (int x = 0; x < size; ++x)
+                table[y * size + x] = filter->Evaluate(
+                        Point2f((x + 0.5f) * filter->radius.x / size,
+                                (y + 0.5f) * filter->radius.y / size));
+        for (int i = 0; i < size; ++i) {
+            tableX[i] = filter->Evaluate1D((i + 0.5f) * filter->radius.x / size, 0);
+            tableY[i] = filter->Evaluate1D((i + 0.5f) * filter->radius.y / size, 1);
+        }
+
+        Bounds2i bounds(Point2i(0, 0), Point2i(16, 12));
+        FilmTile general(bounds, filter->radius, table, size, FilterSplat::General);
+        FilmTile separable(bounds, filter->radius, table, size,
+                           FilterSplat::Separable, tableX, tableY);
+        bool box = filter->radius.x <= 0.5f;
+        FilmTile boxTile(bounds, filter->radius, table, size, FilterSplat::Box);
+        RNG rng;
+        for (int i = 0; i < 500; ++i) {
+            // Samples near and beyond the tile's edges too
+            Point2f p(-2 + 20 * rng.UniformFloat(), -2 + 16 * rng.UniformFloat());
+            float rgb[3] = {rng.UniformFloat(), rng.UniformFloat(), rng.UniformFloat()};
+            Spectrum L = Spectrum::FromRGB(rgb);
+            general.AddSample(p, L);
+            separable.AddSample(p, L);
+            if (box) boxTile.AddSample(p, L);
+        }
+
+        auto close = [](const FilmTilePixel &a, const FilmTilePixel &b) {
+            float ca[3], cb[3];
+            a.contribSum.ToRGB(ca);
+            b.contribSum.ToRGB(cb);
+            float tolerance = 1e-4f * std::max(1.f, std::abs(a.filterWeightSum));
+            for (int c = 0; c < 3; ++c)
+                if (std::abs(ca[c] - cb[c]) > tolerance) return false;
+            return std::abs(a.filterWeightSum - b.filterWeightSum) <= tolerance;
+        };
+        int nBad = 0;
+        for (Point2i p : bounds) {
+            if (!close(general.GetPixel(p), separable.GetPixel(p))) ++nBad;
+            if (box && !close(general.GetPixel(p), boxTile.GetPixel(p))) ++nBad;
+        }
+        CHECK(nBad == 0);
+    }
+}
+
+static void TestFilterSampling() {
+    for (const std::unique_ptr<Filter> &filter : TestFilters()) {
+        FilterSampler sampler(filter.get());
+
+        // Integrals of _f_, _|f|_ and _f x^2_ over the filter's extent
+        const int n = 400;
+        double integral = 0, absIntegral = 0, moment = 0;
+        for (int y = 0; y < n; ++y)
+            for (int x = 0; x < n; ++x) {
+                Point2f p(((x + 0.5f) / n * 2 - 1) * filter->radius.x,
+                          ((y + 0.5f) / n * 2 - 1) * filter->radius.y);
+                double f = filter->Evaluate(p);
+                integral += f;
+                absIntegral += std::abs(f);
+                moment += f * p.x * p.x;
+            }
+
+        // Each sample's weight times the integral of _|f|_ estimates the
+        // integral of _f_, and likewise for the moment
+        const int nSamples = 1 << 18;
+        double weightSum = 0, momentSum = 0;
+        bool inside = true;
+        RNG rng;
+        for (int i = 0; i < nSamples; ++i) {
+            FilterSample fs =
+                    sampler.Sample(Point2f(rng.UniformFloat(), rng.UniformFloat()));
+            inside &= std::abs(fs.p.x) <= filter->radius.x &&
+                      std::abs(fs.p.y) <= filter->radius.y;
+            inside &= fs.weight == 1 || fs.weight == -1;
+            weightSum += fs.weight;
+            momentSum += fs.weight * fs.p.x * fs.p.x;
+        }
+        CHECK(inside);
+        CHECK(std::abs(weightSum / nSamples - integral / absIntegral) < 0.01);
+        CHECK(std::abs(momentSum / nSamples - moment / absIntegral) < 0.02);
+    }
+}
+
+int main() {
+    TestSeparable();
+    TestSplats();
+    TestFilterSampling();
+
+    return TestResult();
+}
@@ -0,0 +1,209 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <unistd.h>
+#include "imageio.h"
+#include "sampling.h"
+#include "test.h"
+
+using namespace pbrt;
+
+// Images read back from each format must hold the pixels written, tiles
+// may be streamed in any order, and failed writes must be reported.
+
+static const int width = 37, height = 23;
+
+static std::vector<float> TestImage() {
+    std::vector<float> rgb(3 * width * height);
+    for (int y = 0; y < height; ++y)
+        for (int x = 0; x < width; ++x)
+            for (int c = 0; c < 3; ++c)
+                rgb[3 * (y * width + x) + c] = x + 100.f * y + 0.25f * c;
+    return rgb;
+}
+
+template <typename T>
+static T Get(const std::string &file, size_t offset) {
+    T v;
+    memcpy(&v, &file[offset], sizeof(T));
+    return v;
+}
+
+static uint32_t GetBigEndian32(const std::string &file, size_t offset) {
+    const uint8_t *p = (const uint8_t *)&file[offset];
+    return uint32_t(p[0]) << 24 | uint32_t(p[1]) << 16 | uint32_t(p[2]) << 8 | p[3];
+}
+
+static uint32_t Crc32(const uint8_t *data, size_t size) {
+    uint32_t crc = ~0u;
+    for (size_t i = 0; i < size; ++i) {
+        crc ^= data[i];
+        for (int k = 0; k < 8; ++k) crc = (crc & 1) ? 0xedb88320u ^ (crc >> 1) : crc >> 1;
+    }
+    return ~crc;
+}
+
+// Writes the image tile by tile in a random order
+static bool WriteTiled(const std::string &name, const std::vector<float> &rgb,
+                       int tileSize) {
+    Bounds2i bounds(Point2i(0, 0), Point2i(width, height));
+    std::unique_ptr<ImageTileWriter> writer =
+            ImageTileWriter::Create(name, bounds, Point2i(width, height), tileSize);
+    if (!writer) return false;
+    std::vector<Bounds2i> tiles;
+    for (int y = 0; y < height; y += tileSize)
+        for (int x = 0; x < width; x += tileSize)
+            tiles.push_back(Bounds2i(
+                    Point2i(x, y),
+                    Point2i(std::min(x + tileSize, width), std::min(y + tileSize, height))));
+    RNG rng;
+    Shuffle(&tiles[0], tiles.size(), 1, rng);
+    for (const Bounds2i &tile : tiles) {
+        std::vector<float> tileRGB;
+        for (int y = tile.pMin.y; y < tile.pMax.y; ++y)
+            tileRGB.insert(tileRGB.end(), &rgb[3 * (y * width + tile.pMin.x)],
+                           &rgb[3 * (y * width + tile.pMax.x)]);
+        if (!writer->WriteTile(tile, tileRGB.data())) return false;
+    }
+    return writer->Close();
+}
+
+static void TestPFM() {
+    std::vector<float> rgb = TestImage();
+    Bounds2i bounds(Point2i(0, 0), Point2i(width, height));
+    CHECK(WriteImage("pbrt_test.pfm", rgb.data(), bounds, Point2i(width, height)));
+    std::string file = ReadWholeFile("pbrt_test.pfm");
+    std::string header = "PF\n37 23\n-1\n";
+    CHECK(file.size() == header.size() + rgb.size() * sizeof(float));
+    CHECK(file.compare(0, header.size(), header) == 0);
+    // Scanlines are stored from the bottom up
+    bool same = true;
+    for (int y = 0; y < height; ++y)
+        for (int i = 0; i < 3 * width; ++i)
+            same &= Get<float>(file, header.size() + sizeof(float) *
+                                     (3 * width * (height - 1 - y) + i)) ==
+                    rgb[3 * width * y + i];
+    CHECK(same);
+
+    CHECK(WriteTiled("pbrt_test_tiled.pfm", rgb, 8));
+    CHECK(ReadWholeFile("pbrt_test_tiled.pfm") == file);
+    remove("pbrt_test.pfm");
+    remove("pbrt_test_tiled.pfm");
+}
+
+static void TestEXR() {
+    std::vector<float> rgb = TestImage();
+    const int tileSize = 8;
+    CHECK(WriteTiled("pbrt_test.exr", rgb, tileSize));
+    std::string file = ReadWholeFile("pbrt_test.exr");
+    CHECK(file.size() > 8 && Get<int32_t>(file, 0) == 20000630);
+
+    // Skip the header's attributes to the tile offset table
+    size_t pos = 8;
+    while (pos < file.size() && file[pos] != 0) {
+        pos = file.find('\0', pos) + 1;  // name
+        pos = file.find('\0', pos) + 1;  // type
+        pos += 4 + Get<int32_t>(file, pos);
+    }
+    ++pos;
+    int nTilesX = (width + tileSize - 1) / tileSize;
+    int nTilesY = (height + tileSize - 1) / tileSize;
+    CHECK(pos + 8 * nTilesX * nTilesY <= file.size());
+
+    // Every tile is where the table says, with its B, G and R scanlines
+    bool same = true;
+    for (int ty = 0; ty < nTilesY; ++ty)
+        for (int tx = 0; tx < nTilesX; ++tx) {
+            uint64_t offset = Get<uint64_t>(file, pos + 8 * (ty * nTilesX + tx));
+            int w = std::min(tileSize, width - tx * tileSize);
+            int h = std::min(tileSize, height - ty * tileSize);
+            same &= offset + 20 + 12 * w * h <= file.size();
+            if (!same) break;
+            same &= Get<int32_t>(file, offset) == tx &&
+                    Get<int32_t>(file, offset + 4) == ty &&
+                    Get<int32_t>(file, offset + 16) == 12 * w * h;
+            for (int y = 0; y < h; ++y)
+                for (int c = 0; c < 3; ++c)
+                    for (int x = 0; x < w; ++x) {
+                        size_t at = offset + 20 + 4 * (3 * w * y + (2 - c) * w + x);
+                        int px = tx * tileSize + x, py = ty * tileSize + y;
+                        same &= Get<float>(file, at) == rgb[3 * (py * width + px) + c];
+                    }
+        }
+    CHECK(same);
+    remove("pbrt_test.exr");
+}
+
+static void TestPNG() {
+    // Values that map to 0 and 255 whatever the rounding
+    std::vector<float> rgb(3 * width * height);
+    for (size_t i = 0; i < rgb.size(); ++i) rgb[i] = (i % 7 < 3) ? 1.5f : -1.f;
+    Bounds2i bounds(Point2i(0, 0), Point2i(width, height));
+    CHECK(WriteImage("pbrt_test.png", rgb.data(), bounds, Point2i(width, height)));
+    std::string file = ReadWholeFile("pbrt_test.png");
+    CHECK(file.compare(0, 8, "\x89PNG\r\n\x1a\n") == 0);
+
+    // Walk the chunks, checking their CRCs and collecting the image data
+    std::string idat;
+    bool crcsMatch = true, ended = false;
+    size_t pos = 8;
+    while (pos + 12 <= file.size() && !ended) {
+        uint32_t length = GetBigEndian32(file, pos);
+        if (pos + 12 + length > file.size()) break;
+        std::string type = file.substr(pos + 4, 4);
+        crcsMatch &= Crc32((const uint8_t *)&file[pos + 4], length + 4) ==
+                     GetBigEndian32(file, pos + 8 + length);
+        if (type == "IHDR")
+            CHECK(GetBigEndian32(file, pos + 8) == (uint32_t)width &&
+                  GetBigEndian32(file, pos + 12) == (uint32_t)height);
+        else if (type == "IDAT")
+            idat += file.substr(pos + 8, length);
+        ended = type == "IEND";
+        pos += 12 + length;
+    }
+    CHECK(crcsMatch && ended && pos == file.size());
+
+    // The zlib stream holds stored blocks of filtered scanlines
+    std::string raw;
+    size_t p = 2;
+    bool final = false;
+    while (!final && p + 5 <= idat.size()) {
+        final = idat[p] & 1;
+        size_t n = (uint8_t)idat[p + 1] | (uint8_t)idat[p + 2] << 8;
+        raw += idat.substr(p + 5, n);
+        p += 5 + n;
+    }
+    CHECK(final && raw.size() == (3 * width + 1) * height);
+    bool same = raw.size() == (3 * width + 1) * height;
+    for (int y = 0; same && y < height; ++y) {
+        same &= raw[y * (3 * width + 1)] == 0;
+        for (int i = 0; i < 3 * width; ++i)
+            same &= (uint8_t)raw[y * (3 * width + 1) + 1 + i] ==
+                    (rgb[3 * width * y + i] > 0 ? 255 : 0);
+    }
+    CHECK(same);
+    remove("pbrt_test.png");
+}
+
+static void TestFailedWrites() {
+    // Writes to a full device must fail rather than leave a short file
+    std::vector<float> rgb = TestImage();
+    Bounds2i bounds(Point2i(0, 0), Point2i(width, height));
+    for (const char *name : {"pbrt_test_full.png", "pbrt_test_full.pfm",
+                             "pbrt_test_full.exr"}) {
+        if (symlink("/dev/full", name) != 0) continue;
+        CHECK(!WriteImage(name, rgb.data(), bounds, Point2i(width, height)));
+        remove(name);
+    }
+    CHECK(!WriteImage("pbrt_test.bmp", rgb.data(), bounds, Point2i(width, height)));
+}
+
+int main() {
+    TestPFM();
+    TestEXR();
+    TestPNG();
+    TestFailedWrites();
+
+    return TestResult();
+}
@@ -0,0 +1,157 @@
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <vector>
+#include "api.h"
+#include "parser.h"
+#include "test.h"
+
+using namespace pbrt;
+
+// Adaptive sampling must spend fewer samples than the maximum and still
+// give an image close to a uniformly sampled one. Progressive passes must
+// add up to the single-pass image, and a deadline must stop after the
+// first pass with a complete image.
+
+static const int width = 48, height = 32;
+
+// Spheres over a black background, with edges for adaptive sampling to
+// spend its samples on
+static std::string SceneText(int spp) {
+    return R"(
+LookAt 0 0 10  0 0 0  0 1 0
+Camera "orthographic" "float screenwindow" [-3 3 -2 2]
+Film "image" "integer xresolution" [48] "integer yresolution" [32]
+Sampler "sobol" "integer pixelsamples" [)" + std::to_string(spp) + R"(]
+Integrator "whitted"
+WorldBegin
+LightSource "point" "rgb I" [40 40 40] "point from" [3 4 8]
+Material "matte" "rgb Kd" [.8 .3 .2]
+AttributeBegin
+  Translate -1 0 0
+  Shape "sphere" "float radius" [0.5]
+AttributeEnd
+AttributeBegin
+  Material "matte" "rgb Kd" [.2 .8 .3]
+  Translate 1 -0.5 -1
+  Shape "sphere" "float radius" [1.2]
+AttributeEnd
+WorldEnd
+)";
+}
+
+// Renders the scene with _options_ and returns its pixels, empty if the
+// render failed; _log_ receives what it printed
+static std::vector<float> Render(Options options, int spp, std::string *log) {
+    const char *filename = "pbrt_test_integrator.pfm";
+    options.imageFile = filename;
+    std::ostringstream out;
+    std::streambuf *coutBuf = std::cout.rdbuf(out.rdbuf());
+    RenderContext *ctx = pbrtCreateContext(options);
+    pbrtSetContext(ctx);
+    bool ok = pbrtParseString(SceneText(spp));
+    pbrtDestroyContext(ctx);
+    std::cout.rdbuf(coutBuf);
+    if (log) *log = out.str();
+
+    std::string file = ReadWholeFile(filename);
+    remove(filename);
+    std::string header = "PF\n48 32\n-1\n";
+    std::vector<float> rgb(3 * width * height);
+    if (!ok || file.size() != header.size() + rgb.size() * sizeof(float))
+        return std::vector<float>();
+    memcpy(rgb.data(), &file[header.size()], rgb.size() * sizeof(float));
+    return rgb;
+}
+
+// Root mean square difference of two images, relative to the first's mean
+static double RelativeRMSE(const std::vector<float> &ref,
+                           const std::vector<float> &image) {
+    if (ref.size() != image.size() || ref.empty()) return INFINITY;
+    double sum = 0, sumSquaredError = 0;
+    for (size_t i = 0; i < ref.size(); ++i) {
+        sum += ref[i];
+        sumSquaredError += (double(image[i]) - ref[i]) * (double(image[i]) - ref[i]);
+    }
+    return std::sqrt(sumSquaredError / ref.size()) / (sum / ref.size());
+}
+
+static void TestAdaptive() {
+    const int maxSpp = 64;
+    std::string log;
+    std::vector<float> uniform = Render(Options(), maxSpp, &log);
+    CHECK(!uniform.empty());
+    CHECK(log.find("Adaptive") == std::string::npos);
+
+    Options options;
+    options.adaptiveThreshold = 0.05f;
+    std::vector<float> adaptive = Render(options, maxSpp, &log);
+    CHECK(!adaptive.empty());
+    long long taken = 0, total = 0;
+    size_t pos = log.find("Adaptive sampling took ");
+    CHECK(pos != std::string::npos &&
+          sscanf(log.c_str() + pos, "Adaptive sampling took %lld of %lld", &taken,
+                 &total) == 2);
+    // Every pixel takes at least the first batch, and the flat background
+    // stops there
+    long long nPixels = width * height;
+    CHECK(total == nPixels * maxSpp);
+    CHECK(taken >= nPixels * options.adaptiveMinSamples && taken < total / 2);
+    CHECK(RelativeRMSE(uniform, adaptive) < 0.02);
+
+    // The background is black whatever the sample count
+    bool blackStaysBlack = true;
+    for (size_t i = 0; i < uniform.size(); ++i)
+        if (uniform[i] == 0) blackStaysBlack &= adaptive[i] == 0;
+    CHECK(blackStaysBlack);
+}
+
+static void TestProgressive() {
+    const int spp = 16;
+    std::string log;
+    std::vector<float> singlePass = Render(Options(), spp, &log);
+    CHECK(!singlePass.empty());
+    CHECK(log.find("Pass ") == std::string::npos);
+
+    // Passes end at 1, 1 + 1, 2 + 2, ... samples per pixel
+    Options options;
+    options.progressive = true;
+    std::vector<float> progressive = Render(options, spp, &log);
+    CHECK(log.find("Pass 1 of 5: 1 samples per pixel") != std::string::npos);
+    CHECK(log.find("Pass 5 of 5: 16 samples per pixel") != std::string::npos);
+    CHECK(RelativeRMSE(singlePass, progressive) < 1e-5);
+
+    // A deadline that has passed by the end of the first pass leaves the
+    // image of its one sample per pixel
+    options.renderDeadline = 1e-6f;
+    std::vector<float> firstPass = Render(options, spp, &log);
+    CHECK(log.find("Pass 1 of 5") != std::string::npos);
+    CHECK(log.find("Pass 2 of 5") == std::string::npos);
+    std::vector<float> onePerPixel = Render(Options(), 1, nullptr);
+    CHECK(RelativeRMSE(onePerPixel, firstPass) < 1e-5);
+
+    // Adaptive sampling skips converged pixels in later passes
+    const int maxSpp = 64;
+    std::vector<float> uniform = Render(Options(), maxSpp, nullptr);
+    options.renderDeadline = 0;
+    options.adaptiveThreshold = 0.05f;
+    std::vector<float> adaptive = Render(options, maxSpp, &log);
+    long long taken = 0, total = 0;
+    size_t pos = log.find("Adaptive sampling took ");
+    CHECK(pos != std::string::npos &&
+          sscanf(log.c_str() + pos, "Adaptive sampling took %lld of %lld", &taken,
+                 &total) == 2);
+    CHECK(total == (long long)width * height * maxSpp && taken < total / 2);
+    CHECK(RelativeRMSE(uniform, adaptive) < 0.02);
+}
+
+int main() {
+    pbrtInit(Options());
+
+    TestAdaptive();
+    TestProgressive();
+
+    pbrtCleanup();
+    return TestResult();
+}
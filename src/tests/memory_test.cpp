@@ -0,0 +1,123 @@
+#include <cstring>
+#include <vector>
+#include "memory.h"
+#include "rng.h"
+#include "test.h"
+
+using namespace pbrt;
+
+// Arena allocations must meet their alignment and never overlap, blocks
+// must be reused after a reset instead of allocated again, and the
+// statistics must add up.
+
+struct alignas(32) Vector8 {
+    Vector8() {
+        for (int i = 0; i < 8; ++i) v[i] = float(i);
+    }
+    float v[8];
+};
+
+struct Allocation {
+    uint8_t *ptr;
+    size_t size;
+};
+
+// Allocates from _arena_ in a pattern fixed by _seed_, checking alignments,
+// and fills each allocation with its index
+static std::vector<Allocation> AllocatePattern(MemoryArena &arena, uint64_t seed) {
+    RNG rng(seed);
+    std::vector<Allocation> allocations;
+    bool aligned = true;
+    for (int i = 0; i < 2000; ++i) {
+        size_t size = 1 + rng.UniformUInt32(i % 100 == 0 ? 100000 : 500);
+        size_t align = size_t(1) << rng.UniformUInt32(7);
+        uint8_t *ptr = (uint8_t *)(i % 2 ? arena.Alloc(size, align) : arena.Alloc(size));
+        aligned &= (uintptr_t)ptr % (i % 2 ? std::max<size_t>(align, 16) : 16) == 0;
+        memset(ptr, i & 0xff, size);
+        allocations.push_back({ptr, size});
+    }
+    CHECK(aligned);
+    return allocations;
+}
+
+static bool Intact(const std::vector<Allocation> &allocations) {
+    for (size_t i = 0; i < allocations.size(); ++i)
+        for (size_t j = 0; j < allocations[i].size; ++j)
+            if (allocations[i].ptr[j] != (i & 0xff)) return false;
+    return true;
+}
+
+static void TestAllocations() {
+    MemoryArena arena(16384);
+    std::vector<Allocation> allocations = AllocatePattern(arena, 1);
+    CHECK(Intact(allocations));
+
+    size_t requested = 0;
+    for (const Allocation &a : allocations) requested += a.size;
+    CHECK(arena.BytesInUse() >= requested);
+    CHECK(arena.TotalAllocated() >= arena.BytesInUse());
+    CHECK(arena.HighWaterMark() == arena.BytesInUse());
+    CHECK(arena.BlockCount() > 1);
+
+    // Typed allocations are aligned and constructed
+    Vector8 *v = arena.Alloc<Vector8>(5);
+    bool constructed = true;
+    for (int i = 0; i < 5; ++i) constructed &= v[i].v[7] == 7.f;
+    CHECK((uintptr_t)v % alignof(Vector8) == 0 && constructed);
+    Vector8 *w = ARENA_ALLOC(arena, Vector8)();
+    CHECK((uintptr_t)w % alignof(Vector8) == 0 && w->v[3] == 3.f);
+}
+
+static void TestReuse() {
+    // Once the arena has held a pattern, repeating it after a reset fits
+    // in the blocks already there. The first repeat may still add a block,
+    // as the block current at the reset is where it starts.
+    MemoryArena arena(16384);
+    AllocatePattern(arena, 2);
+    arena.Reset();
+    AllocatePattern(arena, 2);
+    size_t inUse = arena.BytesInUse(), total = arena.TotalAllocated();
+    size_t nBlocks = arena.BlockCount();
+    arena.Reset();
+    CHECK(arena.BytesInUse() == 0);
+    CHECK(arena.HighWaterMark() == inUse);
+
+    std::vector<Allocation> allocations = AllocatePattern(arena, 2);
+    CHECK(Intact(allocations));
+    CHECK(arena.BlockCount() == nBlocks);
+    CHECK(arena.TotalAllocated() == total);
+    CHECK(arena.BytesInUse() == inUse);
+
+    // A smaller frame leaves the high-water mark alone
+    arena.Reset();
+    arena.Alloc(100);
+    CHECK(arena.BytesInUse() == 112);
+    CHECK(arena.HighWaterMark() == inUse);
+}
+
+static void TestLargeBlocks() {
+    // Allocations larger than a block get one of their own, mapped directly
+    // when they reach the huge page size
+    MemoryArena arena(4096);
+    size_t size = MemoryArena::HugePageSize + 12345;
+    uint8_t *big = (uint8_t *)arena.Alloc(size);
+    memset(big, 0xab, size);
+    uint8_t *small = (uint8_t *)arena.Alloc(100);
+    memset(small, 0xcd, 100);
+    CHECK(big[0] == 0xab && big[size - 1] == 0xab && small[99] == 0xcd);
+    CHECK(arena.TotalAllocated() >= size + 4096);
+    size_t nBlocks = arena.BlockCount();
+
+    arena.Reset();
+    uint8_t *again = (uint8_t *)arena.Alloc(size);
+    memset(again, 0xef, size);
+    CHECK(arena.BlockCount() == nBlocks);
+}
+
+int main() {
+    TestAllocations();
+    TestReuse();
+    TestLargeBlocks();
+
+    return TestResult();
+}
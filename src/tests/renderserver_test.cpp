@@ -0,0 +1,45 @@
+#include "api.h"
+#include "renderserver.h"
+#include "test.h"
+
+using namespace pbrt;
+
+// The render server must accept well-formed requests and reject the rest
+// with a message.
+
+static void TestParseRequest() {
+    SceneView view;
+    std::string error;
+    CHECK(RenderServer::ParseRequest(
+            "image=a.pfm camera=front spp=16 crop=0,0.5,0.25,1 "
+            "lookat=1,2,3,0,0,0,0,1,0", &view, &error));
+    CHECK(view.imageFile == "a.pfm" && view.camera == "front");
+    CHECK(view.pixelSamples == 16);
+    CHECK(view.hasCropWindow && view.cropWindow[1] == 0.5f &&
+          view.cropWindow[2] == 0.25f);
+    CHECK(view.hasLookAt && view.lookAt[2] == 3 && view.lookAt[7] == 1);
+
+    const char *bad[] = {
+        "",                          // no image
+        "camera=front",              // no image
+        "image=",                    // empty value
+        "image=a.pfm spp=0",
+        "image=a.pfm spp=4x",
+        "image=a.pfm crop=0,1,0",    // too few values
+        "image=a.pfm crop=0,1,0,1,0",
+        "image=a.pfm lookat=1,2,3",
+        "image=a.pfm size=64",       // unknown parameter
+    };
+    for (const char *line : bad) {
+        SceneView badView;
+        error.clear();
+        CHECK(!RenderServer::ParseRequest(line, &badView, &error));
+        CHECK(!error.empty());
+    }
+}
+
+int main() {
+    TestParseRequest();
+
+    return TestResult();
+}
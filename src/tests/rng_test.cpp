@@ -0,0 +1,91 @@
+#include <vector>
+#include "rng.h"
+#include "test.h"
+
+using namespace pbrt;
+
+// _RNG8_ must produce exactly the values of scalar _RNG_s, whichever of its
+// code paths the CPU selects, for independent and interleaved lanes alike.
+
+static void TestIndependentLanes() {
+    uint64_t seq[RNG8::Width];
+    RNG lanes[RNG8::Width];
+    for (int l = 0; l < RNG8::Width; ++l) {
+        seq[l] = 1000003ull * l + 7;
+        lanes[l].SetSequence(seq[l]);
+    }
+    RNG8 rng8;
+    rng8.SetSequence(seq);
+
+    // One group at a time, then many at once
+    bool same = true;
+    for (int k = 0; k < 100; ++k) {
+        uint32_t out[RNG8::Width];
+        rng8.UniformUInt32(out);
+        for (int l = 0; l < RNG8::Width; ++l) same &= out[l] == lanes[l].UniformUInt32();
+    }
+    std::vector<uint32_t> out(RNG8::Width * 333);
+    rng8.UniformUInt32(out.data(), out.size());
+    for (size_t k = 0; k < out.size() / RNG8::Width; ++k)
+        for (int l = 0; l < RNG8::Width; ++l)
+            same &= out[RNG8::Width * k + l] == lanes[l].UniformUInt32();
+    CHECK(same);
+
+    // Skipping ahead in every lane
+    rng8.Advance(12345);
+    for (int l = 0; l < RNG8::Width; ++l) lanes[l].Advance(12345);
+    uint32_t next[RNG8::Width];
+    rng8.UniformUInt32(next);
+    same = true;
+    for (int l = 0; l < RNG8::Width; ++l) same &= next[l] == lanes[l].UniformUInt32();
+    CHECK(same);
+}
+
+static void TestInterleaved() {
+    RNG rng(42);
+    RNG8 rng8;
+    rng8.SetInterleavedSequence(42);
+
+    // Lengths that leave partial groups, which still step every lane
+    bool same = true;
+    for (size_t n : {size_t(1), size_t(8), size_t(13), size_t(1000)}) {
+        std::vector<uint32_t> out(n);
+        rng8.UniformUInt32(out.data(), n);
+        for (size_t i = 0; i < n; ++i) same &= out[i] == rng.UniformUInt32();
+        for (size_t i = n; i % RNG8::Width; ++i) rng.UniformUInt32();
+    }
+    CHECK(same);
+
+    // Advancing each lane by _d_ skips _Width * d_ values of the stream
+    rng8.Advance(1000);
+    rng.Advance(RNG8::Width * 1000);
+    std::vector<uint32_t> out(64);
+    rng8.UniformUInt32(out.data(), out.size());
+    same = true;
+    for (uint32_t v : out) same &= v == rng.UniformUInt32();
+    CHECK(same);
+}
+
+static void TestUniformFloat() {
+    // Long enough to cross the internal chunks, with a partial tail
+    RNG rng(7);
+    RNG8 rng8;
+    rng8.SetInterleavedSequence(7);
+    std::vector<float> out(1003);
+    rng8.UniformFloat(out.data(), out.size());
+    bool same = true, inRange = true;
+    for (float f : out) {
+        same &= f == rng.UniformFloat();
+        inRange &= f >= 0 && f < 1;
+    }
+    CHECK(same);
+    CHECK(inRange);
+}
+
+int main() {
+    TestIndependentLanes();
+    TestInterleaved();
+    TestUniformFloat();
+
+    return TestResult();
+}
@@ -0,0 +1,83 @@
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "lowdiscrepancy.h"
+#include "rng.h"
+#include "samplers/sobol.h"
+#include "test.h"
+
+using namespace pbrt;
+
+// Properties of the Sobol generator matrices, and of the sampler's mapping
+// from pixels to sequence indices.
+
+static void TestSobolMatrices() {
+    // Dimension 0 is the van der Corput sequence
+    for (uint64_t i = 0; i < 4096; ++i) {
+        uint32_t reversed = 0;
+        for (int b = 0; b < 32; ++b) reversed |= uint32_t((i >> b) & 1) << (31 - b);
+        CHECK(SobolSampleBits(i, 0) == reversed);
+    }
+
+    // Every dimension is a (0, 1)-sequence: each block of $2^m$ points,
+    // here from any start, puts one point in each interval of size $2^{-m}$
+    for (int dim = 0; dim < NumSobolDimensions; ++dim)
+        for (int m : {1, 4, 10})
+            for (uint64_t start : {0ull, 1ull << 20, 3ull << 33}) {
+                std::vector<int> count(1 << m, 0);
+                for (uint64_t i = 0; i < (1ull << m); ++i)
+                    ++count[SobolSampleBits(start + i, dim) >> (32 - m)];
+                CHECK(std::count(count.begin(), count.end(), 1) == (1 << m));
+            }
+
+    // The first two dimensions form a (0, 2)-sequence: $2^m$ points put one
+    // point in every elementary interval of area $2^{-m}$
+    const int m = 10;
+    for (int a = 0; a <= m; ++a) {
+        std::vector<int> count(1 << m, 0);
+        for (uint64_t i = 0; i < (1ull << m); ++i) {
+            // Top _a_ bits of x and _m - a_ bits of y
+            uint64_t x = uint64_t(SobolSampleBits(i, 0)) >> (32 - a);
+            uint64_t y = uint64_t(SobolSampleBits(i, 1)) >> (32 - (m - a));
+            ++count[x << (m - a) | y];
+        }
+        CHECK(std::count(count.begin(), count.end(), 1) == (1 << m));
+    }
+}
+
+static void TestSobolInversion() {
+    // The index of each sample must map back into the pixel it was drawn
+    // for, including extents that need more than 32 bits of index
+    const int extents[][2] = {{1, 1},      {100, 60},    {640, 480},
+                              {70000, 3},  {3, 200000},  {1 << 20, 5}};
+    RNG rng;
+    for (const auto &extent : extents)
+        for (int spp : {1, 16, 1024}) {
+            Bounds2i sampleBounds(Point2i(-3, 7),
+                                  Point2i(-3 + extent[0], 7 + extent[1]));
+            SobolSampler sampler(spp, sampleBounds);
+            int resolution = RoundUpPow2(std::max(extent[0], extent[1]));
+            int nBad = 0;
+            for (int i = 0; i < 50; ++i) {
+                Point2i p(sampleBounds.pMin.x + rng.UniformUInt32(extent[0]),
+                          sampleBounds.pMin.y + rng.UniformUInt32(extent[1]));
+                sampler.StartPixel(p);
+                for (int s = 0; s < std::min(spp, 8); ++s) {
+                    int64_t index = sampler.GetIndexForSample(s);
+                    double x = SobolSampleBits(index, 0) * 0x1p-32 * resolution,
+                           y = SobolSampleBits(index, 1) * 0x1p-32 * resolution;
+                    if ((int)std::floor(x) + sampleBounds.pMin.x != p.x ||
+                        (int)std::floor(y) + sampleBounds.pMin.y != p.y)
+                        ++nBad;
+                }
+            }
+            CHECK(nBad == 0);
+        }
+}
+
+int main() {
+    TestSobolMatrices();
+    TestSobolInversion();
+
+    return TestResult();
+}
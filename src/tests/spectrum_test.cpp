@@ -0,0 +1,126 @@
+#include <cmath>
+#include <new>
+#include "rng.h"
+#include "spectrum.h"
+#include "test.h"
+
+using namespace pbrt;
+
+// The vectorized spectrum operations must give exactly the per-sample
+// results, whatever the number of samples and wherever the spectrum is
+// stored, and must keep the pad lanes zero.
+
+// Exposes a spectrum's samples, pad lanes included
+template <int N>
+class Samples : public CoefficientSpectrum<N> {
+public:
+    static const int nLanes = CoefficientSpectrum<N>::nLanes;
+    Samples(const CoefficientSpectrum<N> &s) : CoefficientSpectrum<N>(s) {}
+    float &operator[](int i) { return this->c[i]; }
+    float operator[](int i) const { return this->c[i]; }
+    bool PadIsZero() const {
+        for (int i = N; i < nLanes; ++i)
+            if (this->c[i] != 0) return false;
+        return true;
+    }
+};
+
+template <int N>
+static Samples<N> RandomSpectrum(RNG &rng) {
+    Samples<N> s(0.f);
+    for (int i = 0; i < N; ++i) s[i] = 4 * rng.UniformFloat() - 2;
+    return s;
+}
+
+template <int N>
+static void TestArithmetic() {
+    RNG rng(N);
+    for (int iter = 0; iter < 100; ++iter) {
+        // Operands and results at addresses that are not 32-byte aligned
+        Misaligned<Samples<N>> aStorage, bStorage, rStorage;
+        Samples<N> &a = *new (aStorage.Get()) Samples<N>(RandomSpectrum<N>(rng));
+        Samples<N> &b = *new (bStorage.Get()) Samples<N>(RandomSpectrum<N>(rng));
+        Samples<N> &r = *new (rStorage.Get()) Samples<N>(a);
+        float f = 4 * rng.UniformFloat() - 2;
+
+        Samples<N> sum = a + b, difference = a - b, product = a * b, quotient = a / b;
+        Samples<N> scaled = a * f, divided = a / f, clamped = a.Clamp(-0.5f, 1);
+        bool same = true;
+        for (int i = 0; i < N; ++i)
+            same &= sum[i] == a[i] + b[i] && difference[i] == a[i] - b[i] &&
+                    product[i] == a[i] * b[i] && quotient[i] == a[i] / b[i] &&
+                    scaled[i] == a[i] * f && divided[i] == a[i] / f &&
+                    clamped[i] == std::min(std::max(a[i], -0.5f), 1.f);
+        CHECK(same);
+        CHECK(sum.PadIsZero() && difference.PadIsZero() && product.PadIsZero() &&
+              quotient.PadIsZero() && scaled.PadIsZero() && divided.PadIsZero() &&
+              clamped.PadIsZero());
+
+        // The compound forms store to the misaligned result
+        r += b;
+        same = true;
+        for (int i = 0; i < N; ++i) same &= r[i] == sum[i];
+        r *= b;
+        for (int i = 0; i < N; ++i) same &= r[i] == sum[i] * b[i];
+        r /= f;
+        for (int i = 0; i < N; ++i) same &= r[i] == sum[i] * b[i] / f;
+        CHECK(same && r.PadIsZero());
+
+        CHECK(a == a && a != b && !(a == b));
+        CHECK(!a.HasNaNs() && !a.IsBlack());
+    }
+}
+
+template <int N>
+static void TestSpecialValues() {
+    // Dividing by zero leaves NaNs and infinities in the samples only
+    Samples<N> zero(0.f), one(1.f);
+    Samples<N> nan = zero / zero, inf = one / zero, infScaled = one * Infinity;
+    CHECK(nan.HasNaNs() && nan.PadIsZero());
+    CHECK(!inf.HasNaNs() && inf.PadIsZero() && std::isinf(inf[N - 1]));
+    CHECK(!infScaled.HasNaNs() && infScaled.PadIsZero());
+    CHECK(Samples<N>(one / Infinity).IsBlack());
+    CHECK(zero.IsBlack() && !one.IsBlack());
+
+    // A difference in the last sample alone is seen
+    Samples<N> last(one);
+    last[N - 1] = 2;
+    CHECK(last != one && !last.IsBlack());
+    last[N - 1] = NAN;
+    CHECK(last.HasNaNs() && last != last);
+}
+
+template <int N>
+static void TestDot() {
+    // The vector sum is reassociated, so it is only close to the serial one
+    RNG rng(N + 1);
+    Misaligned<Samples<N>> aStorage;
+    Samples<N> &a = *new (aStorage.Get()) Samples<N>(RandomSpectrum<N>(rng));
+    Samples<N> b = RandomSpectrum<N>(rng);
+    double dot = 0, absDot = 0;
+    for (int i = 0; i < N; ++i) {
+        dot += double(a[i]) * b[i];
+        absDot += std::abs(double(a[i]) * b[i]);
+    }
+    float d = SpectrumDot<Samples<N>::nLanes>(&a[0], &b[0]);
+    CHECK(std::abs(d - dot) <= 1e-6 * N * absDot);
+}
+
+template <int N>
+static void TestSpectrum() {
+    TestArithmetic<N>();
+    TestSpecialValues<N>();
+    TestDot<N>();
+}
+
+int main() {
+    // Widths that fill one SSE vector partly or exactly, several vectors,
+    // and the sampled spectrum's
+    TestSpectrum<3>();
+    TestSpectrum<4>();
+    TestSpectrum<8>();
+    TestSpectrum<13>();
+    TestSpectrum<nSpectralSamples>();
+
+    return TestResult();
+}
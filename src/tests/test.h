@@ -0,0 +1,49 @@
+//
+// Created by Thierry Backes on 2026-10-19.
+//
+
+#ifndef PBRT_WHITTED_TEST_H
+#define PBRT_WHITTED_TEST_H
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+// Shared by the test executables in this directory, one per area of the
+// renderer. Each runs its checks from _main()_, which returns
+// _TestResult()_: nonzero if any check failed. Files are written to the
+// current directory and removed afterwards.
+
+static int failures = 0;
+
+#define CHECK(cond)                                                          \
+    do {                                                                     \
+        if (!(cond)) {                                                       \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: "   \
+                      << #cond << std::endl;                                 \
+            ++failures;                                                      \
+        }                                                                    \
+    } while (false)
+
+static inline int TestResult() {
+    if (failures == 0) std::cout << "All tests passed" << std::endl;
+    return failures == 0 ? 0 : 1;
+}
+
+static inline std::string ReadWholeFile(const std::string &filename) {
+    std::ifstream in(filename, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in),
+                       std::istreambuf_iterator<char>());
+}
+
+// Storage for a _T_ 16 bytes past a 32-byte boundary: enough for the
+// 16-byte alignment that spectra and matrices declare, but not for aligned
+// AVX loads and stores
+template <typename T>
+struct Misaligned {
+    alignas(32) unsigned char storage[sizeof(T) + 16];
+    T *Get() { return reinterpret_cast<T *>(storage + 16); }
+};
+
+#endif //PBRT_WHITTED_TEST_H
@@ -0,0 +1,166 @@
+#include <algorithm>
+#include <cmath>
+#include <new>
+#include "rng.h"
+#include "transform.h"
+#include "test.h"
+
+using namespace pbrt;
+
+// The vectorized matrix and transform code must match a serial evaluation
+// in double precision, including for matrices stored where aligned AVX
+// accesses would fault, and transformed ray origins must be offset past
+// their rounding error.
+
+static Matrix4x4 RandomMatrix(RNG &rng, bool affine) {
+    Matrix4x4 m;
+    for (int i = 0; i < 4; ++i)
+        for (int j = 0; j < 4; ++j) m.m[i][j] = 4 * rng.UniformFloat() - 2;
+    if (affine) {
+        m.m[3][0] = m.m[3][1] = m.m[3][2] = 0;
+        m.m[3][3] = 1;
+    }
+    return m;
+}
+
+// Row _i_ of _m_ applied to $(x, y, z, w)$, and the sum of the terms'
+// magnitudes
+static double ApplyRow(const Matrix4x4 &m, int i, double x, double y, double z,
+                       double w, double *absSum) {
+    *absSum = std::abs(m.m[i][0] * x) + std::abs(m.m[i][1] * y) +
+              std::abs(m.m[i][2] * z) + std::abs(m.m[i][3] * w);
+    return m.m[i][0] * x + m.m[i][1] * y + m.m[i][2] * z + m.m[i][3] * w;
+}
+
+static void TestMul() {
+    RNG rng;
+    bool close = true;
+    for (int iter = 0; iter < 1000; ++iter) {
+        // The product is built in place, 16 bytes off a 32-byte boundary
+        Misaligned<Matrix4x4> aStorage, bStorage, rStorage;
+        Matrix4x4 &a = *new (aStorage.Get()) Matrix4x4(RandomMatrix(rng, false));
+        Matrix4x4 &b = *new (bStorage.Get()) Matrix4x4(RandomMatrix(rng, false));
+        Matrix4x4 &r = *new (rStorage.Get()) Matrix4x4(Matrix4x4::Mul(a, b));
+        for (int i = 0; i < 4; ++i)
+            for (int j = 0; j < 4; ++j) {
+                double ref = 0, absSum = 0;
+                for (int k = 0; k < 4; ++k) {
+                    ref += double(a.m[i][k]) * b.m[k][j];
+                    absSum += std::abs(double(a.m[i][k]) * b.m[k][j]);
+                }
+                close &= std::abs(r.m[i][j] - ref) <= gamma(4) * absSum;
+            }
+    }
+    CHECK(close);
+}
+
+static void TestInverse() {
+    // Affine matrices take the vectorized path, the others elimination
+    RNG rng(1);
+    for (bool affine : {true, false}) {
+        int nBad = 0;
+        for (int iter = 0; iter < 1000; ++iter) {
+            Misaligned<Matrix4x4> mStorage;
+            Matrix4x4 &m = *new (mStorage.Get()) Matrix4x4(RandomMatrix(rng, affine));
+            Matrix4x4 mInv = Inverse(m), id = Matrix4x4::Mul(m, mInv);
+            // Random matrices are well conditioned often enough
+            float maxError = 0;
+            for (int i = 0; i < 4; ++i)
+                for (int j = 0; j < 4; ++j)
+                    maxError = std::max(maxError, std::abs(id.m[i][j] - (i == j)));
+            if (maxError > 1e-3f) ++nBad;
+            if (affine)
+                CHECK(mInv.m[3][0] == 0 && mInv.m[3][1] == 0 && mInv.m[3][2] == 0 &&
+                      mInv.m[3][3] == 1);
+        }
+        CHECK(nBad < 20);
+    }
+}
+
+static void TestPointsAndVectors() {
+    RNG rng(2);
+    bool close = true, bounded = true;
+    for (int iter = 0; iter < 1000; ++iter) {
+        bool affine = iter % 2 == 0;
+        Misaligned<Transform> tStorage;
+        Transform &t = *new (tStorage.Get()) Transform(RandomMatrix(rng, affine));
+        const Matrix4x4 &m = t.GetMatrix();
+        CHECK(t.IsAffine() == affine);
+        Point3f p(8 * rng.UniformFloat() - 4, 8 * rng.UniformFloat() - 4,
+                  8 * rng.UniformFloat() - 4);
+
+        double ref[4], absSum[4];
+        for (int i = 0; i < 4; ++i) ref[i] = ApplyRow(m, i, p.x, p.y, p.z, 1, &absSum[i]);
+        Vector3f pError;
+        Point3f tp = t(p, &pError);
+        if (affine) {
+            // The error bound must hold for the vectorized evaluation order
+            for (int i = 0; i < 3; ++i) {
+                close &= std::abs(tp[i] - ref[i]) <= gamma(4) * absSum[i];
+                bounded &= std::abs(tp[i] - ref[i]) <= pError[i];
+            }
+        } else if (std::abs(ref[3]) > 0.1) {
+            for (int i = 0; i < 3; ++i)
+                close &= std::abs(tp[i] - ref[i] / ref[3]) <=
+                         gamma(6) * (absSum[i] + absSum[3] * std::abs(ref[i] / ref[3])) /
+                         std::abs(ref[3]);
+        }
+
+        Vector3f v(p.x, p.y, p.z), tv = t(v);
+        for (int i = 0; i < 3; ++i) {
+            ref[i] = ApplyRow(m, i, v.x, v.y, v.z, 0, &absSum[i]);
+            close &= std::abs(tv[i] - ref[i]) <= gamma(4) * absSum[i];
+        }
+    }
+    CHECK(close);
+    CHECK(bounded);
+}
+
+static void TestRays() {
+    // The origin moves along the direction by about its error bound, less
+    // what adding the offset rounds off, and the end of the ray stays put
+    RNG rng(3);
+    bool offset = true, sameEnd = true;
+    for (int iter = 0; iter < 1000; ++iter) {
+        Transform t(RandomMatrix(rng, true));
+        Ray r(Point3f(8 * rng.UniformFloat() - 4, 8 * rng.UniformFloat() - 4,
+                      8 * rng.UniformFloat() - 4),
+              Vector3f(2 * rng.UniformFloat() - 1, 2 * rng.UniformFloat() - 1,
+                       2 * rng.UniformFloat() - 1),
+              1 + 9 * rng.UniformFloat());
+        Vector3f oError;
+        Point3f o = t(r.o, &oError);
+        Ray tr = t(r);
+        offset &= Dot(tr.o - o, tr.d) >= 0.5f * Dot(Abs(tr.d), oError) &&
+                  tr.tMax <= r.tMax;
+        Point3f end = t(r(r.tMax)), trEnd = tr(tr.tMax);
+        float scale = std::max({std::abs(end.x), std::abs(end.y), std::abs(end.z), 1.f});
+        sameEnd &= Distance(end, trEnd) <= 1e-5f * scale;
+    }
+    CHECK(offset);
+    CHECK(sameEnd);
+}
+
+static void TestComposition() {
+    RNG rng(4);
+    bool close = true;
+    for (int iter = 0; iter < 1000; ++iter) {
+        Transform t1(RandomMatrix(rng, true)), t2(RandomMatrix(rng, true));
+        Transform t12 = t1 * t2;
+        Point3f p(rng.UniformFloat(), rng.UniformFloat(), rng.UniformFloat());
+        Point3f a = t12(p), b = t1(t2(p));
+        float scale = std::max({std::abs(a.x), std::abs(a.y), std::abs(a.z), 1.f});
+        close &= Distance(a, b) <= 1e-4f * scale;
+    }
+    CHECK(close);
+}
+
+int main() {
+    TestMul();
+    TestInverse();
+    TestPointsAndVectors();
+    TestRays();
+    TestComposition();
+
+    return TestResult();
+}
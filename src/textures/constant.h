@@ -9,6 +9,7 @@
 namespace pbrt{
     template <typename T>
     class ConstantTexture : public Texture<T> {
+    public:
         ConstantTexture(const T &value) : value(value) {}
         T Evaluate(const SurfaceInteraction &) const { return value; }
 